@@ -1,11 +1,13 @@
 #include "rr_clock_spatial_lookup.h"
 
+#include <algorithm>
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
 namespace openfpga {  // begin namespace openfpga
 
-RRClockSpatialLookup::RRClockSpatialLookup() {}
+RRClockSpatialLookup::RRClockSpatialLookup() { clear(); }
 
 RRNodeId RRClockSpatialLookup::find_node(int x, int y, const ClockTreeId& tree,
                                          const ClockLevelId& lvl,
@@ -25,38 +27,37 @@ RRNodeId RRClockSpatialLookup::find_node(int x, int y, const ClockTreeId& tree,
    * range
    * - Return an invalid id if any out-of-range is detected
    */
-  if (size_t(dir) >= rr_node_indices_.size()) {
+  if (size_t(dir) >= dim_sizes_[DIM_DIR]) {
     VTR_LOGV(verbose, "Direction out of range\n");
     return RRNodeId::INVALID();
   }
 
-  if (size_t(x) >= rr_node_indices_[dir].dim_size(0)) {
+  if (size_t(x) >= dim_sizes_[DIM_X]) {
     VTR_LOGV(verbose, "X out of range\n");
     return RRNodeId::INVALID();
   }
 
-  if (size_t(y) >= rr_node_indices_[dir].dim_size(1)) {
+  if (size_t(y) >= dim_sizes_[DIM_Y]) {
     VTR_LOG("Y out of range\n");
     return RRNodeId::INVALID();
   }
 
-  if (size_t(tree) >= rr_node_indices_[dir][x][y].size()) {
+  if (size_t(tree) >= dim_sizes_[DIM_TREE]) {
     VTR_LOGV(verbose, "Tree id out of range\n");
     return RRNodeId::INVALID();
   }
 
-  if (size_t(lvl) == rr_node_indices_[dir][x][y][size_t(tree)].size()) {
+  if (size_t(lvl) >= dim_sizes_[DIM_LVL]) {
     VTR_LOGV(verbose, "Level id out of range\n");
     return RRNodeId::INVALID();
   }
 
-  if (size_t(pin) ==
-      rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].size()) {
+  if (size_t(pin) >= dim_sizes_[DIM_PIN]) {
     VTR_LOGV(verbose, "Pin id out of range\n");
     return RRNodeId::INVALID();
   }
 
-  return rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)][size_t(pin)];
+  return find_node_unchecked(x, y, tree, lvl, pin, direction);
 }
 
 void RRClockSpatialLookup::add_node(RRNodeId node, int x, int y,
@@ -66,69 +67,84 @@ void RRClockSpatialLookup::add_node(RRNodeId node, int x, int y,
                                     const Direction& direction) {
   size_t dir = size_t(direction);
   VTR_ASSERT(node); /* Must have a valid node id to be added */
-  VTR_ASSERT_SAFE(2 == rr_node_indices_[dir].ndims());
-
-  resize_nodes(x, y, direction);
-
-  if (size_t(tree) >= rr_node_indices_[dir][x][y].size()) {
-    rr_node_indices_[dir][x][y].resize(size_t(tree) + 1);
-  }
-
-  if (size_t(lvl) >= rr_node_indices_[dir][x][y][size_t(tree)].size()) {
-    rr_node_indices_[dir][x][y][size_t(tree)].resize(size_t(lvl) + 1);
-  }
+  VTR_ASSERT(dir < dim_sizes_[DIM_DIR]);
+  VTR_ASSERT(x >= 0);
+  VTR_ASSERT(y >= 0);
 
-  if (size_t(pin) >=
-      rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].size()) {
-    rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].resize(size_t(pin) +
-                                                                  1);
-  }
+  resize_nodes(x + 1, y + 1, size_t(tree) + 1, size_t(lvl) + 1,
+               size_t(pin) + 1);
 
   /* Resize on demand finished; Register the node */
-  rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)][size_t(pin)] = node;
+  rr_node_indices_[node_index(dir, x, y, size_t(tree), size_t(lvl),
+                              size_t(pin))] = node;
 }
 
 void RRClockSpatialLookup::reserve_nodes(int x, int y, int tree, int lvl,
                                          int pin) {
-  for (Direction dir : {Direction::INC, Direction::DEC}) {
-    resize_nodes(x, y, dir);
-    for (int ix = 0; ix < x; ++ix) {
-      for (int iy = 0; iy < y; ++iy) {
-        rr_node_indices_[size_t(dir)][ix][iy].resize(tree);
-        for (int itree = 0; itree < tree; ++itree) {
-          rr_node_indices_[size_t(dir)][ix][iy][itree].resize(lvl);
-          for (int ilvl = 0; ilvl < lvl; ++ilvl) {
-            rr_node_indices_[size_t(dir)][ix][iy][itree][ilvl].resize(pin);
-          }
-        }
-      }
-    }
-  }
+  VTR_ASSERT(x >= 0);
+  VTR_ASSERT(y >= 0);
+  VTR_ASSERT(tree >= 0);
+  VTR_ASSERT(lvl >= 0);
+  VTR_ASSERT(pin >= 0);
+  resize_nodes(x, y, tree, lvl, pin);
 }
 
-void RRClockSpatialLookup::resize_nodes(int x, int y,
-                                        const Direction& direction) {
+void RRClockSpatialLookup::resize_nodes(size_t x, size_t y, size_t tree,
+                                        size_t lvl, size_t pin) {
   /* Expand the fast look-up if the new node is out-of-range
    * This may seldom happen because the rr_graph building function
-   * should ensure the fast look-up well organized
+   * should reserve the fast look-up with the maximum sizes
    */
-  size_t dir = size_t(direction);
-  VTR_ASSERT(dir < rr_node_indices_.size());
-  VTR_ASSERT(x >= 0);
-  VTR_ASSERT(y >= 0);
+  std::array<size_t, NUM_DIMS> new_dim_sizes = dim_sizes_;
+  new_dim_sizes[DIM_X] = std::max(new_dim_sizes[DIM_X], x);
+  new_dim_sizes[DIM_Y] = std::max(new_dim_sizes[DIM_Y], y);
+  new_dim_sizes[DIM_TREE] = std::max(new_dim_sizes[DIM_TREE], tree);
+  new_dim_sizes[DIM_LVL] = std::max(new_dim_sizes[DIM_LVL], lvl);
+  new_dim_sizes[DIM_PIN] = std::max(new_dim_sizes[DIM_PIN], pin);
+  if (new_dim_sizes == dim_sizes_) {
+    return;
+  }
+
+  /* Strides of the new layout, where the pin is the innermost dimension */
+  std::array<size_t, NUM_DIMS> new_strides;
+  new_strides[DIM_PIN] = 1;
+  for (int idim = DIM_LVL; idim >= DIM_DIR; --idim) {
+    new_strides[idim] = new_strides[idim + 1] * new_dim_sizes[idim + 1];
+  }
 
-  if ((x >= int(rr_node_indices_[dir].dim_size(0))) ||
-      (y >= int(rr_node_indices_[dir].dim_size(1)))) {
-    rr_node_indices_[dir].resize(
-      {std::max(rr_node_indices_[dir].dim_size(0), size_t(x) + 1),
-       std::max(rr_node_indices_[dir].dim_size(1), size_t(y) + 1)});
+  /* Move the existing nodes to the new layout */
+  std::vector<RRNodeId> new_rr_node_indices(
+    new_strides[DIM_DIR] * new_dim_sizes[DIM_DIR], RRNodeId::INVALID());
+  for (size_t idir = 0; idir < dim_sizes_[DIM_DIR]; ++idir) {
+    for (size_t ix = 0; ix < dim_sizes_[DIM_X]; ++ix) {
+      for (size_t iy = 0; iy < dim_sizes_[DIM_Y]; ++iy) {
+        for (size_t itree = 0; itree < dim_sizes_[DIM_TREE]; ++itree) {
+          for (size_t ilvl = 0; ilvl < dim_sizes_[DIM_LVL]; ++ilvl) {
+            size_t old_offset = node_index(idir, ix, iy, itree, ilvl, 0);
+            size_t new_offset =
+              idir * new_strides[DIM_DIR] + ix * new_strides[DIM_X] +
+              iy * new_strides[DIM_Y] + itree * new_strides[DIM_TREE] +
+              ilvl * new_strides[DIM_LVL];
+            std::copy_n(rr_node_indices_.begin() + old_offset,
+                        dim_sizes_[DIM_PIN],
+                        new_rr_node_indices.begin() + new_offset);
+          }
+        }
+      }
+    }
   }
+
+  dim_sizes_ = new_dim_sizes;
+  strides_ = new_strides;
+  rr_node_indices_ = std::move(new_rr_node_indices);
 }
 
 void RRClockSpatialLookup::clear() {
-  for (auto& data : rr_node_indices_) {
-    data.clear();
-  }
+  /* Only INC and DEC directions are supported */
+  dim_sizes_.fill(0);
+  dim_sizes_[DIM_DIR] = 2;
+  strides_.fill(0);
+  rr_node_indices_.clear();
 }
 
 }  // end namespace openfpga
@@ -15,7 +15,15 @@
  *
  *   - Update the look-up with new nodes
  *   - Find the id of a node with given information, e.g., x, y, type etc.
+ *
+ * The look-up is stored in a dense flat array, indexed by
+ * [INC|DEC][0..grid_width][0..grid_height][tree_id][level_id][clock_pin_id]
+ * whose strides are precomputed. Therefore, a look-up costs only a few
+ * multiply-adds and one memory access
  */
+#include <array>
+#include <vector>
+
 #include "clock_network_fwd.h"
 #include "physical_types.h"
 #include "rr_graph_fwd.h"
@@ -60,6 +68,22 @@ class RRClockSpatialLookup {
                      const ClockLevelId& lvl, const ClockTreePinId& pin,
                      const Direction& direction, const bool& verbose) const;
 
+  /**
+   * @brief Returns the index of the specified routing resource node without
+   * any range check, which is the fast path for callers which have already
+   * ensured that all the parameters are in the range of the look-up, e.g.,
+   * those used to reserve the look-up
+   *
+   * @note An invalid id will be returned if the node does not exist
+   */
+  RRNodeId find_node_unchecked(size_t x, size_t y, const ClockTreeId& tree,
+                               const ClockLevelId& lvl,
+                               const ClockTreePinId& pin,
+                               const Direction& direction) const {
+    return rr_node_indices_[node_index(size_t(direction), x, y, size_t(tree),
+                                       size_t(lvl), size_t(pin))];
+  }
+
   /* -- Mutators -- */
  public:
   /**
@@ -94,18 +118,30 @@ class RRClockSpatialLookup {
   /** @brief Clear all the data inside */
   void clear();
 
+ private: /* Private accessors */
+  /** @brief Index of a node in the flat array */
+  size_t node_index(size_t dir, size_t x, size_t y, size_t tree, size_t lvl,
+                    size_t pin) const {
+    return dir * strides_[DIM_DIR] + x * strides_[DIM_X] +
+           y * strides_[DIM_Y] + tree * strides_[DIM_TREE] +
+           lvl * strides_[DIM_LVL] + pin;
+  }
+
  private: /* Private mutators */
-  /** @brief Resize the nodes upon needs */
-  void resize_nodes(int x, int y, const Direction& direction);
+  /** @brief Resize the nodes upon needs. Existing nodes are kept */
+  void resize_nodes(size_t x, size_t y, size_t tree, size_t lvl, size_t pin);
 
   /* -- Internal data storage -- */
  private:
+  /* Dimensions of the look-up */
+  enum e_dim { DIM_DIR, DIM_X, DIM_Y, DIM_TREE, DIM_LVL, DIM_PIN, NUM_DIMS };
+  /* Size and stride of each dimension */
+  std::array<size_t, NUM_DIMS> dim_sizes_;
+  std::array<size_t, NUM_DIMS> strides_;
   /* Fast look-up:
    * [INC|DEC][0..grid_width][0..grid_height][tree_id][level_id][clock_pin_id]
    */
-  std::array<vtr::NdMatrix<std::vector<std::vector<std::vector<RRNodeId>>>, 2>,
-             2>
-    rr_node_indices_;
+  std::vector<RRNodeId> rr_node_indices_;
 };
 
 }  // end namespace openfpga
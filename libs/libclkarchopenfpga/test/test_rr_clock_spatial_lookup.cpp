@@ -0,0 +1,177 @@
+/********************************************************************
+ * Unit test functions to validate the correctness and the performance of
+ * the clock node look-up of routing resource graphs
+ * 1. all the nodes registered can be found, while others are invalid
+ * 2. nodes are kept when the look-up is expanded by adding new nodes
+ * 3. a benchmark which runs millions of look-ups on a large grid
+ * Usage: test_rr_clock_spatial_lookup [<grid_size> [<num_lookups>]]
+ *******************************************************************/
+#include <chrono>
+#include <cstdlib>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from clock architecture library */
+#include "rr_clock_spatial_lookup.h"
+
+using namespace openfpga;
+
+/* Sizes of the clock network under test */
+constexpr size_t NUM_TREES = 4;
+constexpr size_t NUM_LEVELS = 5;
+constexpr size_t NUM_PINS = 4;
+
+/* A unique node id for each location of the look-up. Only 2/3 of the
+ * locations are registered, others should be found as invalid */
+static RRNodeId reference_node(const size_t& grid_size, const size_t& x,
+                               const size_t& y, const size_t& tree,
+                               const size_t& lvl, const size_t& pin,
+                               const Direction& direction) {
+  size_t index = ((((size_t(direction) * grid_size + x) * grid_size + y) *
+                     NUM_TREES +
+                   tree) *
+                    NUM_LEVELS +
+                  lvl) *
+                   NUM_PINS +
+                 pin;
+  if (0 == index % 3) {
+    return RRNodeId::INVALID();
+  }
+  return RRNodeId(index);
+}
+
+/* A simple linear congruential generator, which is stable across platforms */
+static size_t next_random(size_t& seed) {
+  seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return seed >> 33;
+}
+
+static size_t check_lookup(const RRClockSpatialLookup& lookup,
+                           const size_t& grid_size) {
+  size_t num_errors = 0;
+  for (Direction dir : {Direction::INC, Direction::DEC}) {
+    for (size_t x = 0; x < grid_size; ++x) {
+      for (size_t y = 0; y < grid_size; ++y) {
+        for (size_t tree = 0; tree < NUM_TREES; ++tree) {
+          for (size_t lvl = 0; lvl < NUM_LEVELS; ++lvl) {
+            for (size_t pin = 0; pin < NUM_PINS; ++pin) {
+              RRNodeId expected =
+                reference_node(grid_size, x, y, tree, lvl, pin, dir);
+              RRNodeId found = lookup.find_node(
+                x, y, ClockTreeId(tree), ClockLevelId(lvl), ClockTreePinId(pin),
+                dir, false);
+              RRNodeId found_unchecked = lookup.find_node_unchecked(
+                x, y, ClockTreeId(tree), ClockLevelId(lvl), ClockTreePinId(pin),
+                dir);
+              if (found != expected || found_unchecked != expected) {
+                num_errors++;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  /* Out-of-range look-ups */
+  if (lookup.find_node(grid_size, 0, ClockTreeId(0), ClockLevelId(0),
+                       ClockTreePinId(0), Direction::INC, false) ||
+      lookup.find_node(0, 0, ClockTreeId(NUM_TREES), ClockLevelId(0),
+                       ClockTreePinId(0), Direction::INC, false) ||
+      lookup.find_node(0, 0, ClockTreeId(0), ClockLevelId(NUM_LEVELS + 1),
+                       ClockTreePinId(0), Direction::INC, false) ||
+      lookup.find_node(0, 0, ClockTreeId(0), ClockLevelId(0),
+                       ClockTreePinId(NUM_PINS + 1), Direction::INC, false) ||
+      lookup.find_node(-1, 0, ClockTreeId(0), ClockLevelId(0),
+                       ClockTreePinId(0), Direction::INC, false)) {
+    num_errors++;
+  }
+  return num_errors;
+}
+
+int main(int argc, const char** argv) {
+  /* Ensure we have at most two arguments */
+  VTR_ASSERT(3 >= argc);
+  size_t grid_size = 100;
+  if (2 <= argc) {
+    grid_size = std::atoi(argv[1]);
+  }
+  size_t num_lookups = 10000000;
+  if (3 <= argc) {
+    num_lookups = std::atoi(argv[2]);
+  }
+  VTR_ASSERT(2 <= grid_size);
+
+  /* Build the look-up in two steps: the first half of the grid is added to
+   * a reserved look-up, and the rest is added on demand, which expands the
+   * look-up */
+  RRClockSpatialLookup lookup;
+  lookup.reserve_nodes(grid_size / 2, grid_size / 2, NUM_TREES, NUM_LEVELS - 1,
+                       NUM_PINS);
+  for (size_t half : {0, 1}) {
+    for (Direction dir : {Direction::INC, Direction::DEC}) {
+      for (size_t x = 0; x < grid_size; ++x) {
+        for (size_t y = 0; y < grid_size; ++y) {
+          bool first_half = (x < grid_size / 2) && (y < grid_size / 2);
+          if (first_half != (0 == half)) {
+            continue;
+          }
+          for (size_t tree = 0; tree < NUM_TREES; ++tree) {
+            for (size_t lvl = 0; lvl < NUM_LEVELS; ++lvl) {
+              for (size_t pin = 0; pin < NUM_PINS; ++pin) {
+                RRNodeId node =
+                  reference_node(grid_size, x, y, tree, lvl, pin, dir);
+                if (!node) {
+                  continue;
+                }
+                lookup.add_node(node, x, y, ClockTreeId(tree),
+                                ClockLevelId(lvl), ClockTreePinId(pin), dir);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  size_t num_errors = check_lookup(lookup, grid_size);
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("Found %lu mismatches in the clock node look-up!\n",
+                  num_errors);
+    return 1;
+  }
+  VTR_LOG("Validated the clock node look-up on a %lux%lu grid.\n", grid_size,
+          grid_size);
+
+  /* Benchmark: random look-ups */
+  for (bool checked : {true, false}) {
+    size_t seed = 1;
+    size_t num_valid_nodes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t ilookup = 0; ilookup < num_lookups; ++ilookup) {
+      size_t rand = next_random(seed);
+      size_t x = rand % grid_size;
+      size_t y = (rand / grid_size) % grid_size;
+      ClockTreeId tree(rand % NUM_TREES);
+      ClockLevelId lvl((rand / NUM_TREES) % NUM_LEVELS);
+      ClockTreePinId pin((rand / 7) % NUM_PINS);
+      Direction dir = (rand & 0x100) ? Direction::INC : Direction::DEC;
+      RRNodeId node =
+        checked ? lookup.find_node(x, y, tree, lvl, pin, dir, false)
+                : lookup.find_node_unchecked(x, y, tree, lvl, pin, dir);
+      if (node) {
+        num_valid_nodes++;
+      }
+    }
+    std::chrono::duration<double> runtime =
+      std::chrono::steady_clock::now() - start;
+    VTR_LOG(
+      "%s look-ups: %lu look-ups (%lu valid nodes) took %g seconds (%g "
+      "million look-ups per second).\n",
+      checked ? "Checked" : "Unchecked", num_lookups, num_valid_nodes,
+      runtime.count(), num_lookups / runtime.count() / 1e6);
+  }
+
+  return 0;
+}
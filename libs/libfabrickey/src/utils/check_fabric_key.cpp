@@ -7,6 +7,7 @@
  ***********************************************************************/
 #include "check_fabric_key.h"
 
+#include "openfpga_progress_reporter.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -20,17 +21,13 @@ namespace openfpga {
 int check_fabric_key_alias(const FabricKey& input_key, const bool& verbose) {
   /* Check each key now */
   size_t num_errors = 0;
-  float progress = 0.;
-  size_t num_keys_checked = 0;
+  ProgressReporter progress("Checked key alias", input_key.num_keys(),
+                            verbose);
 
   std::map<std::string, size_t> alias_count;
   for (FabricKeyId key_id : input_key.keys()) {
     /* Note that this is slow. May consider to build a map first */
     std::string curr_alias = input_key.key_alias(key_id);
-    progress = static_cast<float>(num_keys_checked) /
-               static_cast<float>(input_key.num_keys()) * 100.0;
-    VTR_LOGV(verbose, "[%lu%] Checking key alias '%s'\r", size_t(progress),
-             curr_alias.c_str());
     if (curr_alias.empty()) {
       VTR_LOG_ERROR(
         "Empty key alias (id='%lu') found in keys which is invalid!\n",
@@ -43,8 +40,9 @@ int check_fabric_key_alias(const FabricKey& input_key, const bool& verbose) {
     } else {
       alias_count[curr_alias] += 1;
     }
-    num_keys_checked++;
+    progress.update();
   }
+  progress.finish();
   for (const auto& kv : alias_count) {
     if (kv.second > 1) {
       std::string key_id_str;
@@ -73,18 +71,14 @@ int check_fabric_key_names_and_values(const FabricKey& input_key,
                                       const bool& verbose) {
   /* Check each key now */
   size_t num_errors = 0;
-  float progress = 0.;
-  size_t num_keys_checked = 0;
+  ProgressReporter progress("Checked key names and values",
+                            input_key.num_keys(), verbose);
 
   std::map<std::string, std::map<size_t, size_t>> key_value_count;
   for (FabricKeyId key_id : input_key.keys()) {
     /* Note that this is slow. May consider to build a map first */
     std::string curr_name = input_key.key_name(key_id);
     size_t curr_value = input_key.key_value(key_id);
-    progress = static_cast<float>(num_keys_checked) /
-               static_cast<float>(input_key.num_keys()) * 100.0;
-    VTR_LOGV(verbose, "[%lu%] Checking key names and values '(%s, %lu)'\r",
-             size_t(progress), curr_name.c_str(), curr_value);
     if (curr_name.empty()) {
       VTR_LOG_ERROR(
         "Empty key name (id='%lu') found in keys which is invalid!\n",
@@ -97,8 +91,9 @@ int check_fabric_key_names_and_values(const FabricKey& input_key,
     } else {
       key_value_count[curr_name][curr_value] += 1;
     }
-    num_keys_checked++;
+    progress.update();
   }
+  progress.finish();
   for (const auto& key_name_kv : key_value_count) {
     for (const auto& key_value_kv : key_name_kv.second) {
       if (key_value_kv.second > 1) {
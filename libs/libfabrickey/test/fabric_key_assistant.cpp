@@ -12,6 +12,7 @@
 #include "command_echo.h"
 #include "command_exit_codes.h"
 #include "command_parser.h"
+#include "openfpga_progress_reporter.h"
 #include "read_xml_fabric_key.h"
 #include "write_xml_fabric_key.h"
 
@@ -34,18 +35,15 @@ static int check_input_and_ref_key_alias_match(
   const openfpga::FabricKey& input_key, const openfpga::FabricKey& ref_key,
   const bool& verbose) {
   size_t num_errors = 0;
-  size_t num_ref_keys_checked = 0;
   VTR_LOG(
     "Checking key alias matching between reference key and input keys...\n");
+  openfpga::ProgressReporter ref_progress("Checked key alias",
+                                          ref_key.num_keys(), verbose);
   for (openfpga::FabricKeyId key_id : ref_key.keys()) {
     /* Note that this is slow. May consider to build a map first */
     std::string curr_alias = ref_key.key_alias(key_id);
     std::vector<openfpga::FabricKeyId> input_found_keys =
       input_key.find_key_by_alias(curr_alias);
-    float progress = static_cast<float>(num_ref_keys_checked) /
-                     static_cast<float>(ref_key.num_keys()) * 100.0;
-    VTR_LOGV(verbose, "[%lu%] Checking key alias '%s'\r", size_t(progress),
-             curr_alias.c_str());
     if (input_found_keys.empty()) {
       VTR_LOG_ERROR(
         "Invalid alias '%s' in the reference key (id='%lu'), which does not "
@@ -60,23 +58,21 @@ static int check_input_and_ref_key_alias_match(
         curr_alias.c_str(), size_t(key_id), input_found_keys.size());
       num_errors++;
     }
-    num_ref_keys_checked++;
+    ref_progress.update();
   }
+  ref_progress.finish();
   VTR_LOG(
     "Checking key alias matching between reference key and input keys... %s\n",
     num_errors ? "[Fail]" : "[Pass]");
   /* If failed, provide a detailed diff on the key alias */
   if (num_errors) {
-    size_t num_input_keys_checked = 0;
+    openfpga::ProgressReporter input_progress("Checked key alias",
+                                              input_key.num_keys(), verbose);
     for (openfpga::FabricKeyId key_id : input_key.keys()) {
       /* Note that this is slow. May consider to build a map first */
       std::string curr_alias = input_key.key_alias(key_id);
       std::vector<openfpga::FabricKeyId> ref_found_keys =
         ref_key.find_key_by_alias(curr_alias);
-      float progress = static_cast<float>(num_input_keys_checked) /
-                       static_cast<float>(input_key.num_keys()) * 100.0;
-      VTR_LOGV(verbose, "[%lu%] Checking key alias '%s'\r", size_t(progress),
-               curr_alias.c_str());
       if (ref_found_keys.empty()) {
         VTR_LOG_ERROR(
           "Invalid alias '%s' in the input key (id='%lu'), which does not "
@@ -91,8 +87,9 @@ static int check_input_and_ref_key_alias_match(
           curr_alias.c_str(), size_t(key_id), ref_found_keys.size());
         num_errors++;
       }
-      num_input_keys_checked++;
+      input_progress.update();
     }
+    input_progress.finish();
   }
   return num_errors ? openfpga::CMD_EXEC_FATAL_ERROR
                     : openfpga::CMD_EXEC_SUCCESS;
@@ -150,18 +147,14 @@ static int update_input_key(openfpga::FabricKey& input_key,
                             const openfpga::FabricKey& ref_key,
                             const bool& verbose) {
   size_t num_errors = 0;
-  size_t num_keys_checked = 0;
-  float progress = 0.;
   VTR_LOG("Pairing key alias between reference key and input keys...\n");
+  openfpga::ProgressReporter progress("Paired key alias", input_key.num_keys(),
+                                      verbose);
   for (openfpga::FabricKeyId key_id : input_key.keys()) {
     /* Note that this is slow. May consider to build a map first */
     std::string curr_alias = input_key.key_alias(key_id);
     std::vector<openfpga::FabricKeyId> ref_found_keys =
       ref_key.find_key_by_alias(curr_alias);
-    progress = static_cast<float>(num_keys_checked) /
-               static_cast<float>(input_key.num_keys()) * 100.0;
-    VTR_LOGV(verbose, "[%lu%] Pairing key alias '%s'\r", size_t(progress),
-             curr_alias.c_str());
     if (ref_found_keys.empty()) {
       VTR_LOG_ERROR(
         "Invalid alias '%s' in the input key (id='%lu'), which does not "
@@ -179,11 +172,9 @@ static int update_input_key(openfpga::FabricKey& input_key,
     /* Now we have a key, get the name and value, and update input key */
     input_key.set_key_name(key_id, ref_key.key_name(ref_found_keys[0]));
     input_key.set_key_value(key_id, ref_key.key_value(ref_found_keys[0]));
-    VTR_LOGV(verbose, "[%lu%] Pairing key alias '%s' -> ('%s', %lu)\r",
-             size_t(progress), curr_alias.c_str(),
-             input_key.key_name(key_id).c_str(), input_key.key_value(key_id));
-    num_keys_checked++;
+    progress.update();
   }
+  progress.finish();
   return num_errors ? openfpga::CMD_EXEC_FATAL_ERROR
                     : openfpga::CMD_EXEC_SUCCESS;
 }
@@ -108,6 +108,17 @@ std::vector<ConfigBitId> BitstreamManager::block_bits(
   return bits;
 }
 
+size_t BitstreamManager::block_sum_of_bits(
+  const ConfigBlockId& block_id) const {
+  /* Ensure the input ids are valid */
+  VTR_ASSERT(true == valid_block_id(block_id));
+
+  if (true == block_sums_of_bits_.empty()) {
+    build_block_sums_of_bits();
+  }
+  return block_sums_of_bits_[block_id];
+}
+
 /* Find the child block in a bitstream manager with a given name */
 ConfigBlockId BitstreamManager::find_child_block(
   const ConfigBlockId& block_id, const std::string& child_block_name) const {
@@ -201,6 +212,8 @@ ConfigBlockId BitstreamManager::create_block() {
   parent_block_ids_.push_back(ConfigBlockId::INVALID());
   child_block_ids_.emplace_back();
 
+  block_sums_of_bits_.clear();
+
   return block;
 }
 
@@ -257,6 +270,8 @@ void BitstreamManager::add_child_block(const ConfigBlockId& parent_block,
   child_block_ids_[parent_block].push_back(child_block);
   /* Register the block in the parent of the block */
   parent_block_ids_[child_block] = parent_block;
+
+  block_sums_of_bits_.clear();
 }
 
 void BitstreamManager::add_block_bits(
@@ -271,6 +286,8 @@ void BitstreamManager::add_block_bits(
   for (const bool& bit : block_bitstream) {
     add_bit(block, bit);
   }
+
+  block_sums_of_bits_.clear();
 }
 
 void BitstreamManager::add_path_id_to_block(const ConfigBlockId& block,
@@ -363,6 +380,40 @@ void BitstreamManager::overwrite_bitstream(const std::string& path,
   }
 }
 
+/******************************************************************************
+ * Private builders
+ ******************************************************************************/
+/********************************************************************
+ * Compute the total number of bits under each block in a single
+ * bottom-up pass: blocks are sorted in a breadth-first order from the
+ * top blocks, so that visiting them in the reversed order, the number of
+ * a block is final when it is added to its parent block
+ *******************************************************************/
+void BitstreamManager::build_block_sums_of_bits() const {
+  block_sums_of_bits_.resize(num_blocks_, 0);
+
+  std::vector<ConfigBlockId> sorted_blocks;
+  sorted_blocks.reserve(num_blocks_);
+  for (const ConfigBlockId& block : blocks()) {
+    if ((true == valid_block_id(block)) &&
+        (ConfigBlockId::INVALID() == parent_block_ids_[block])) {
+      sorted_blocks.push_back(block);
+    }
+  }
+  for (size_t iblk = 0; iblk < sorted_blocks.size(); ++iblk) {
+    for (const ConfigBlockId& child : child_block_ids_[sorted_blocks[iblk]]) {
+      sorted_blocks.push_back(child);
+    }
+  }
+
+  for (auto it = sorted_blocks.rbegin(); it != sorted_blocks.rend(); ++it) {
+    block_sums_of_bits_[*it] += block_bit_lengths_[*it];
+    if (ConfigBlockId::INVALID() != parent_block_ids_[*it]) {
+      block_sums_of_bits_[parent_block_ids_[*it]] += block_sums_of_bits_[*it];
+    }
+  }
+}
+
 /******************************************************************************
  * Public Validators
  ******************************************************************************/
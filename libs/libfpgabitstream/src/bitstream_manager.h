@@ -152,6 +152,12 @@ class BitstreamManager {
   /* Find all the bits that belong to a block */
   std::vector<ConfigBitId> block_bits(const ConfigBlockId& block_id) const;
 
+  /* Find the total number of bits under a block, including the bits of all
+   * its child blocks. The numbers of all the blocks are computed in one pass
+   * at the first call, and cached until the bitstream manager is modified.
+   * Note that the first call is not thread-safe */
+  size_t block_sum_of_bits(const ConfigBlockId& block_id) const;
+
   /* Find the child block in a bitstream manager with a given name */
   ConfigBlockId find_child_block(const ConfigBlockId& block_id,
                                  const std::string& child_block_name) const;
@@ -216,6 +222,9 @@ class BitstreamManager {
   /* Set bit to the bitstream at the given path */
   void overwrite_bitstream(const std::string& path, const bool& value);
 
+ private: /* Internal builders */
+  void build_block_sums_of_bits() const;
+
  public: /* Public Validators */
   bool valid_bit_id(const ConfigBitId& bit_id) const;
 
@@ -272,6 +281,10 @@ class BitstreamManager {
   /* value of a bit in the Bitstream */
   vtr::vector<ConfigBitId, char> bit_values_;
   vtr::vector<ConfigBitId, ConfigBlockId> bit_parent_blocks_;
+
+  /* Cached total number of bits under each block, which is empty when the
+   * cache should be rebuilt */
+  mutable vtr::vector<ConfigBlockId, size_t> block_sums_of_bits_;
 };
 
 } /* end namespace openfpga */
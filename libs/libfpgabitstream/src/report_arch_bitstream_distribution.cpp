@@ -44,8 +44,7 @@ static void rec_report_block_bitstream_distribution_to_xml_file(
   fp << "<block";
   fp << " name=\"" << bitstream_manager.block_name(block) << "\"";
   fp << " number_of_bits=\""
-     << rec_find_bitstream_manager_block_sum_of_bits(bitstream_manager, block)
-     << "\"";
+     << bitstream_manager.block_sum_of_bits(block) << "\"";
   fp << ">" << std::endl;
 
   /* Dive to child blocks if this block has any */
@@ -49,9 +49,12 @@ bool ModuleNameMap::tag_exist(const std::string& name) const {
 
 std::vector<std::string> ModuleNameMap::tags() const {
   std::vector<std::string> keys;
+  keys.reserve(tag2names_.size());
   for (auto const& element : tag2names_) {
     keys.push_back(element.first);
   }
+  /* Sort the keys so that the outputs depending on them are deterministic */
+  std::sort(keys.begin(), keys.end());
   return keys;
 }
 
@@ -81,6 +84,11 @@ int ModuleNameMap::set_tag_to_name_pair(const std::string& tag,
   return CMD_EXEC_SUCCESS;
 }
 
+void ModuleNameMap::reserve(const size_t& num_pairs) {
+  tag2names_.reserve(num_pairs);
+  name2tags_.reserve(num_pairs);
+}
+
 void ModuleNameMap::clear() {
   tag2names_.clear();
   name2tags_.clear();
@@ -4,8 +4,8 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 /* Begin namespace openfpga */
@@ -28,13 +28,15 @@ class ModuleNameMap {
   /** @brief Get tag with a given name */
   std::string tag(const std::string& name) const;
 
-  /** @brief return a list of all the current keys */
+  /** @brief return a list of all the current keys, sorted alphabetically */
   std::vector<std::string> tags() const;
 
  public: /* Public mutators */
   /** @brief Create the one-on-one mapping between an built-in name and a
    * customized name. Return 0 for success, return 1 for fail */
   int set_tag_to_name_pair(const std::string& tag, const std::string& name);
+  /** @brief Reserve the storage for a given number of tag-to-name pairs */
+  void reserve(const size_t& num_pairs);
   /** @brief Reset to empty status. Clear all the storage */
   void clear();
 
@@ -42,9 +44,11 @@ class ModuleNameMap {
   /* built-in name -> customized_name
    * Create a double link to check any customized name is mapped to more than 1
    * built-in name!
+   * Hash maps are used as look-ups are performed once per module during
+   * renaming
    */
-  std::map<std::string, std::string> tag2names_;
-  std::map<std::string, std::string> name2tags_;
+  std::unordered_map<std::string, std::string> tag2names_;
+  std::unordered_map<std::string, std::string> name2tags_;
 };
 
 } /* End namespace openfpga*/
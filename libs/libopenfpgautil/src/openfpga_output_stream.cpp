@@ -0,0 +1,204 @@
+/********************************************************************
+ * Member functions for the buffered and compressed output streams
+ *******************************************************************/
+#ifdef OPENFPGA_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_output_stream.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Size of the user-space buffer of a file stream */
+constexpr size_t OUTPUT_STREAM_BUFFER_SIZE = 1 << 20;
+
+/**************************************************
+ * OutputStreamBuffer
+ *************************************************/
+OutputStreamBuffer::OutputStreamBuffer(const size_t& buffer_size)
+  : buffer_size_(buffer_size),
+    file_buf_(nullptr),
+    zstream_(nullptr),
+    failed_(false) {
+  VTR_ASSERT(0 < buffer_size_);
+}
+
+OutputStreamBuffer::~OutputStreamBuffer() { finish(); }
+
+bool OutputStreamBuffer::start(std::streambuf* file_buf,
+                               const bool& compress) {
+  VTR_ASSERT(nullptr == file_buf_);
+  failed_ = false;
+
+  if (true == compress) {
+#ifdef OPENFPGA_WITH_ZLIB
+    zstream_ = new z_stream();
+    /* Add 16 to the window bits to output a gzip header. Netlists are
+     * highly redundant, the fastest level is good enough */
+    if (Z_OK != deflateInit2(zstream_, Z_BEST_SPEED, Z_DEFLATED,
+                             15 + 16, 8, Z_DEFAULT_STRATEGY)) {
+      delete zstream_;
+      zstream_ = nullptr;
+      failed_ = true;
+      return false;
+    }
+    compressed_buffer_.resize(buffer_size_);
+#else
+    VTR_LOG_ERROR("Compression is not supported without zlib!\n");
+    failed_ = true;
+    return false;
+#endif
+  }
+
+  file_buf_ = file_buf;
+  /* Buffers are allocated only when a file is opened */
+  buffer_.resize(buffer_size_);
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+  return true;
+}
+
+bool OutputStreamBuffer::finish() {
+  if (nullptr == file_buf_) {
+    return !failed_;
+  }
+  write_buffer(true);
+  if (-1 == file_buf_->pubsync()) {
+    failed_ = true;
+  }
+#ifdef OPENFPGA_WITH_ZLIB
+  if (nullptr != zstream_) {
+    deflateEnd(zstream_);
+    delete zstream_;
+    zstream_ = nullptr;
+  }
+#endif
+  file_buf_ = nullptr;
+  /* Release the memory, as a stream may stay alive after being closed */
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+  compressed_buffer_.clear();
+  compressed_buffer_.shrink_to_fit();
+  setp(nullptr, nullptr);
+  return !failed_;
+}
+
+OutputStreamBuffer::int_type OutputStreamBuffer::overflow(int_type ch) {
+  if ((nullptr == file_buf_) || (false == write_buffer(false))) {
+    return traits_type::eof();
+  }
+  if (false == traits_type::eq_int_type(ch, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+  }
+  return traits_type::not_eof(ch);
+}
+
+/* Flushes do not write anything, the data is written by chunks */
+int OutputStreamBuffer::sync() { return failed_ ? -1 : 0; }
+
+/********************************************************************
+ * Write the pending data in the buffer to the file buffer, and reset
+ * the buffer. When finish is true, end the compressed stream
+ *******************************************************************/
+bool OutputStreamBuffer::write_buffer(const bool& finish) {
+  std::streamsize num_chars = pptr() - pbase();
+#ifdef OPENFPGA_WITH_ZLIB
+  if (nullptr != zstream_) {
+    zstream_->next_in = reinterpret_cast<Bytef*>(pbase());
+    zstream_->avail_in = static_cast<uInt>(num_chars);
+    int flush = finish ? Z_FINISH : Z_NO_FLUSH;
+    int status = Z_OK;
+    do {
+      zstream_->next_out = reinterpret_cast<Bytef*>(compressed_buffer_.data());
+      zstream_->avail_out = static_cast<uInt>(compressed_buffer_.size());
+      status = deflate(zstream_, flush);
+      if (Z_STREAM_ERROR == status) {
+        failed_ = true;
+        break;
+      }
+      std::streamsize num_compressed_chars =
+        compressed_buffer_.size() - zstream_->avail_out;
+      if ((0 < num_compressed_chars) &&
+          (num_compressed_chars != file_buf_->sputn(compressed_buffer_.data(),
+                                                    num_compressed_chars))) {
+        failed_ = true;
+        break;
+      }
+    } while ((0 == zstream_->avail_out) ||
+             (finish && (Z_STREAM_END != status)));
+    setp(buffer_.data(), buffer_.data() + buffer_.size());
+    return !failed_;
+  }
+#else
+  (void)finish;
+#endif
+  if ((0 < num_chars) && (num_chars != file_buf_->sputn(pbase(), num_chars))) {
+    failed_ = true;
+  }
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+  return !failed_;
+}
+
+/**************************************************
+ * OutputFileStream
+ *************************************************/
+OutputFileStream::OutputFileStream(const bool& compress)
+  : compress_(compress), buffer_(OUTPUT_STREAM_BUFFER_SIZE) {}
+
+OutputFileStream::~OutputFileStream() { close(); }
+
+bool OutputFileStream::compression_supported() {
+#ifdef OPENFPGA_WITH_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::string OutputFileStream::file_name(const std::string& fname,
+                                        const bool& compress) {
+  if (true == compress) {
+    return fname + ".gz";
+  }
+  return fname;
+}
+
+void OutputFileStream::open(const std::string& fname,
+                            std::ios_base::openmode mode) {
+  if (true == compress_) {
+    mode |= std::fstream::binary;
+  }
+  std::fstream::open(file_name(fname, compress_), mode);
+  if (false == std::fstream::is_open()) {
+    return;
+  }
+  /* Characters are redirected to the buffer, which writes them to the
+   * file buffer of the stream */
+  if (false == buffer_.start(std::fstream::rdbuf(), compress_)) {
+    std::fstream::close();
+    setstate(std::ios_base::failbit);
+    return;
+  }
+  std::ios::rdbuf(&buffer_);
+}
+
+void OutputFileStream::close() {
+  if (false == std::fstream::is_open()) {
+    return;
+  }
+  bool status = buffer_.finish();
+  /* Restore the file buffer, so that the stream can be opened again */
+  std::ios::rdbuf(std::fstream::rdbuf());
+  std::fstream::close();
+  if (false == status) {
+    setstate(std::ios_base::failbit);
+  }
+}
+
+}  // namespace openfpga
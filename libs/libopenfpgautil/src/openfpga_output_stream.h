@@ -0,0 +1,97 @@
+#ifndef OPENFPGA_OUTPUT_STREAM_H
+#define OPENFPGA_OUTPUT_STREAM_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/* Type of zlib stream, which is hidden from the users of this header */
+struct z_stream_s;
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * A stream buffer which collects the characters to output in a large
+ * user-space buffer, and writes them to a file buffer by chunks.
+ * Unlike std::filebuf, flushes requested by the stream (e.g., std::endl)
+ * do not write anything, so that printing a netlist line by line is as
+ * cheap as printing it by chunks. The buffer is written only when it is
+ * full and when finish() is called.
+ *
+ * When compression is enabled, the data is compressed in gzip format
+ * before being written to the file buffer. Compression is available only
+ * when OpenFPGA is built with zlib (OPENFPGA_WITH_ZLIB)
+ *******************************************************************/
+class OutputStreamBuffer : public std::streambuf {
+ public: /* Constructors */
+  OutputStreamBuffer(const size_t& buffer_size);
+  ~OutputStreamBuffer();
+
+ public: /* Public mutators */
+  /* Start to output to a file buffer. Return false if fails */
+  bool start(std::streambuf* file_buf, const bool& compress);
+  /* Output all the pending data and end the compressed stream.
+   * Return false if any data cannot be written */
+  bool finish();
+
+ protected: /* Interface of std::streambuf */
+  int_type overflow(int_type ch) override;
+  int sync() override;
+
+ private: /* Internal functions */
+  bool write_buffer(const bool& finish);
+
+ private: /* Internal data */
+  size_t buffer_size_;
+  std::vector<char> buffer_;
+  std::vector<char> compressed_buffer_;
+  std::streambuf* file_buf_;
+  z_stream_s* zstream_;
+  bool failed_;
+};
+
+/********************************************************************
+ * A file stream to output netlists through an OutputStreamBuffer. It can
+ * be used wherever a std::fstream is expected, e.g.,
+ *
+ *   OutputFileStream fp(compress);
+ *   fp.open(fname);
+ *   check_file_stream(fname.c_str(), fp);
+ *   fp << ...;
+ *   fp.close();
+ *
+ * When compression is enabled, ".gz" is appended to the file name.
+ * Note that data is written to the file only when the stream is closed,
+ * either by close() or by the destructor
+ *******************************************************************/
+class OutputFileStream : public std::fstream {
+ public: /* Constructors */
+  OutputFileStream(const bool& compress = false);
+  ~OutputFileStream();
+
+ public: /* Public accessors */
+  /* Identify if compression is supported by the current build */
+  static bool compression_supported();
+  /* Name of the file which is actually written */
+  static std::string file_name(const std::string& fname,
+                               const bool& compress);
+
+ public: /* Public mutators */
+  void open(const std::string& fname,
+            std::ios_base::openmode mode = std::fstream::out |
+                                           std::fstream::trunc);
+  void close();
+
+ private: /* Internal data */
+  bool compress_;
+  OutputStreamBuffer buffer_;
+};
+
+}  // namespace openfpga
+
+#endif
@@ -0,0 +1,120 @@
+/********************************************************************
+ * Member functions for the progress reporter of long loops
+ *******************************************************************/
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+/* Headers from openfpgautil library */
+#include "openfpga_progress_reporter.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Minimum time between two updates of a progress line */
+constexpr std::chrono::milliseconds PROGRESS_REPORT_INTERVAL(100);
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+ProgressReporter::ProgressReporter(const std::string& message,
+                                   const size_t& num_elements,
+                                   const bool& enabled)
+  : message_(message),
+    num_elements_(num_elements),
+    enabled_(enabled && (0 < num_elements) && is_terminal()),
+    printed_(false),
+    finished_(false),
+    num_done_(0),
+    next_report_(num_elements_to_percentage(1)),
+    last_report_time_(std::chrono::steady_clock::now()) {}
+
+ProgressReporter::~ProgressReporter() { finish(); }
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+bool ProgressReporter::is_terminal() {
+  /* The standard output does not change during a run */
+#ifdef _WIN32
+  static const bool terminal = (0 != _isatty(_fileno(stdout)));
+#else
+  static const bool terminal = (0 != isatty(fileno(stdout)));
+#endif
+  return terminal;
+}
+
+bool ProgressReporter::enabled() const { return enabled_; }
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void ProgressReporter::update(const size_t& num_elements) {
+  if (false == enabled_) {
+    return;
+  }
+  size_t num_done =
+    num_done_.fetch_add(num_elements, std::memory_order_relaxed) +
+    num_elements;
+  if (num_done < next_report_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  report(num_done);
+}
+
+void ProgressReporter::finish() {
+  std::lock_guard<std::mutex> lock(report_mutex_);
+  if (true == finished_) {
+    return;
+  }
+  finished_ = true;
+  /* Nothing to clean when no progress line has been printed */
+  if (false == printed_) {
+    return;
+  }
+  size_t num_done = num_done_.load();
+  std::printf("[%3lu%%] %s (%lu/%lu)\n", 100 * num_done / num_elements_,
+              message_.c_str(), num_done, num_elements_);
+  std::fflush(stdout);
+}
+
+/**************************************************
+ * Private Functions
+ *************************************************/
+/********************************************************************
+ * Print the progress line if it is due. Only one thread can report at
+ * a time, other threads skip reporting rather than waiting
+ *******************************************************************/
+void ProgressReporter::report(const size_t& num_done) {
+  std::unique_lock<std::mutex> lock(report_mutex_, std::try_to_lock);
+  if ((false == lock.owns_lock()) || (true == finished_) ||
+      (num_done < next_report_.load())) {
+    return;
+  }
+  size_t percentage = 100 * num_done / num_elements_;
+  next_report_.store(num_elements_to_percentage(percentage + 1));
+
+  /* The last element is always reported */
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if ((num_done < num_elements_) &&
+      (now - last_report_time_ < PROGRESS_REPORT_INTERVAL)) {
+    return;
+  }
+  last_report_time_ = now;
+  printed_ = true;
+  std::printf("[%3lu%%] %s (%lu/%lu)\r", percentage, message_.c_str(),
+              num_done, num_elements_);
+  std::fflush(stdout);
+}
+
+/* Find the number of done elements which reaches a percentage */
+size_t ProgressReporter::num_elements_to_percentage(
+  const size_t& percentage) const {
+  return (percentage * num_elements_ + 99) / 100;
+}
+
+}  // namespace openfpga
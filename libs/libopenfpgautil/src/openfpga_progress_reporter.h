@@ -0,0 +1,71 @@
+#ifndef OPENFPGA_PROGRESS_REPORTER_H
+#define OPENFPGA_PROGRESS_REPORTER_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * A progress reporter for long loops over many elements, e.g.,
+ *
+ *   ProgressReporter progress("Sorted edges of GSBs", num_gsbs);
+ *   for (...) {
+ *     ...
+ *     progress.update();
+ *   }
+ *   progress.finish();
+ *
+ * The progress line is rewritten in place on the terminal, and it is
+ * updated at most once per percent and once per time interval, so that
+ * the cost of a loop iteration is only an increment in most cases.
+ * Progress is reported only when the standard output is a terminal.
+ * Otherwise, e.g., when the output is redirected to a file, nothing is
+ * printed. The progress line is not written to log files.
+ *
+ * The elements can be updated by multiple threads concurrently
+ *******************************************************************/
+class ProgressReporter {
+ public: /* Constructors */
+  ProgressReporter(const std::string& message, const size_t& num_elements,
+                   const bool& enabled = true);
+  ~ProgressReporter();
+
+ public: /* Public accessors */
+  /* Identify if the standard output is a terminal */
+  static bool is_terminal();
+  bool enabled() const;
+
+ public: /* Public mutators */
+  /* Mark a number of elements as done */
+  void update(const size_t& num_elements = 1);
+  /* Print the final progress line if any has been printed, and end the
+   * line. Called by the destructor if not called before */
+  void finish();
+
+ private: /* Internal functions */
+  void report(const size_t& num_done);
+  size_t num_elements_to_percentage(const size_t& percentage) const;
+
+ private: /* Internal data */
+  std::string message_;
+  size_t num_elements_;
+  bool enabled_;
+  bool printed_;
+  bool finished_;
+  std::atomic<size_t> num_done_;
+  /* Number of done elements which triggers the next report */
+  std::atomic<size_t> next_report_;
+  std::chrono::steady_clock::time_point last_report_time_;
+  std::mutex report_mutex_;
+};
+
+}  // namespace openfpga
+
+#endif
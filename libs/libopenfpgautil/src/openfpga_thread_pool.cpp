@@ -0,0 +1,77 @@
+/********************************************************************
+ * Functions to run independent jobs with a pool of worker threads
+ *******************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/* Headers from vtrutil library */
+#include "vtr_log.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_thread_pool.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * Parse the number of threads given by users. Only a non-negative
+ * integer is accepted
+ *******************************************************************/
+bool read_num_threads(const std::string& num_threads_str,
+                      size_t& num_threads) {
+  char* end = nullptr;
+  long num = std::strtol(num_threads_str.c_str(), &end, 10);
+  if (num_threads_str.empty() || '\0' != *end || 0 > num) {
+    VTR_LOG_ERROR(
+      "Invalid number of threads '%s' which should be 0 or a positive "
+      "number!\n",
+      num_threads_str.c_str());
+    return false;
+  }
+  num_threads = size_t(num);
+  return true;
+}
+
+size_t find_num_workers(const size_t& num_threads, const size_t& num_jobs) {
+  size_t num_workers = num_threads;
+  if (0 == num_workers) {
+    num_workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return std::max(size_t(1), std::min(num_workers, num_jobs));
+}
+
+/********************************************************************
+ * Each worker takes the next job from a shared counter, so that the
+ * workers are balanced even when the runtime of jobs varies a lot
+ *******************************************************************/
+void run_parallel_jobs(
+  const size_t& num_jobs, const size_t& num_workers,
+  const std::function<void(const size_t& ijob, const size_t& iworker)>&
+    run_job) {
+  std::atomic<size_t> next_job(0);
+  auto run_worker = [&](const size_t& iworker) {
+    for (size_t ijob = next_job++; ijob < num_jobs; ijob = next_job++) {
+      run_job(ijob, iworker);
+    }
+  };
+
+  /* Serial run is a special case with only 1 worker */
+  if (1 >= num_workers) {
+    run_worker(0);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+    workers.emplace_back(run_worker, iworker);
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
+}  // namespace openfpga
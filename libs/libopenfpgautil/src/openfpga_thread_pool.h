@@ -0,0 +1,36 @@
+#ifndef OPENFPGA_THREAD_POOL_H
+#define OPENFPGA_THREAD_POOL_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <functional>
+#include <string>
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Parse the number of threads given by users, where 0 means all the
+ * available cores. Return false with an error message if invalid */
+bool read_num_threads(const std::string& num_threads_str, size_t& num_threads);
+
+/* Find the number of workers to run a number of jobs with a number of
+ * threads, where 0 threads means all the available cores. There is at least
+ * 1 worker and no more workers than jobs */
+size_t find_num_workers(const size_t& num_threads, const size_t& num_jobs);
+
+/* Run jobs with a number of workers. Each worker fetches job ids in an
+ * increasing order until all the jobs are taken. A job is given its id and
+ * the id of the worker running it. With 1 worker, the jobs are run one by
+ * one in the calling thread */
+void run_parallel_jobs(
+  const size_t& num_jobs, const size_t& num_workers,
+  const std::function<void(const size_t& ijob, const size_t& iworker)>&
+    run_job);
+
+}  // namespace openfpga
+
+#endif
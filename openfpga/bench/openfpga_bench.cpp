@@ -0,0 +1,574 @@
+/********************************************************************
+ * Micro-benchmarks for the core data structures of OpenFPGA
+ *
+ * Each benchmark builds a synthetic fixture whose size is scaled by
+ * the command-line options, so that no architecture or benchmark file
+ * is required:
+ * - module_manager_add_module_net: add nets, sources and sinks to
+ *   <num_modules> modules, each of which has <num_nets> nets
+ * - verilog_module_writer: write the modules above to a Verilog file
+ * - verilog_module_writer_buffered: same as above through an
+ *   OutputFileStream
+ * - verilog_module_writer_compressed: same as above through a compressed
+ *   OutputFileStream, which is skipped when zlib is not available
+ * - bitstream_manager_add_bit: add <num_bits> bits to a BitstreamManager
+ * - fabric_bitstream_add_bit: add <num_bits> bits to a FabricBitstream
+ * - mux_graph_build: build the graphs of tree-like, one-level and
+ *   multi-level multiplexers with 2 to <mux_size> inputs
+ * - decoder_library_find: add decoders with 2 to <num_nets> outputs and
+ *   all the combinations of optional ports to a DecoderLibrary, finding
+ *   each of them before adding it, and find them again <repeat> times
+ * - mux_library_find: add the multiplexers above to a MuxLibrary and find
+ *   each of them <repeat> times
+ * - fabric_hierarchy_writer: write the hierarchy of a tiled fabric, whose
+ *   top module has <num_modules> rows, each of which has an instance of
+ *   <num_modules> tile modules sharing the same logic block, to a text file
+ *
+ * The runtime, the throughput and the peak memory of each benchmark are
+ * reported in either JSON or CSV. Note that the peak memory is the one of
+ * the whole process. Use the --benchmark option to run a single benchmark
+ * when an accurate peak memory is required.
+ *
+ * Usage:
+ *   openfpga_bench [--benchmark <name>] [--num_modules <int>]
+ *                  [--num_nets <int>] [--num_bits <int>]
+ *                  [--mux_size <int>] [--repeat <int>]
+ *                  [--format <json|csv>] [--output_dir <dir>]
+ *******************************************************************/
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
+
+/* Headers from openfpgashell library */
+#include "command_exit_codes.h"
+
+/* Headers from archopenfpga library */
+#include "circuit_library.h"
+
+/* Headers from fpgabitstream library */
+#include "bitstream_manager.h"
+
+/* Headers from openfpga library */
+#include "decoder_library.h"
+#include "decoder_library_utils.h"
+#include "fabric_bitstream.h"
+#include "fabric_hierarchy_writer.h"
+#include "fabric_verilog_options.h"
+#include "module_manager.h"
+#include "mux_graph.h"
+#include "mux_library.h"
+#include "verilog_module_writer.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Options to scale the synthetic fixtures */
+struct t_bench_options {
+  std::string benchmark;
+  size_t num_modules = 100;
+  size_t num_nets = 1000;
+  size_t num_bits = 1000000;
+  size_t mux_size = 64;
+  size_t repeat = 10;
+  std::string format = "json";
+  std::string output_dir = ".";
+};
+
+/* Measurements of a benchmark */
+struct t_bench_result {
+  std::string name;
+  size_t num_ops = 0;
+  float runtime = 0.;
+  float max_rss_mib = 0.;
+  float delta_max_rss_mib = 0.;
+};
+
+/********************************************************************
+ * Run a benchmark and measure its runtime and memory usage. The
+ * benchmark returns the number of operations it has done
+ *******************************************************************/
+static t_bench_result run_benchmark(const std::string& name,
+                                    const std::function<size_t()>& bench) {
+  t_bench_result result;
+  result.name = name;
+  vtr::Timer timer;
+  result.num_ops = bench();
+  result.runtime = timer.elapsed_sec();
+  result.max_rss_mib = timer.max_rss_mib();
+  result.delta_max_rss_mib = timer.delta_max_rss_mib();
+  return result;
+}
+
+/********************************************************************
+ * Build a leaf module with a 1-bit input and a 1-bit output, and
+ * <num_modules> parent modules, each of which has <num_nets>/2 instances
+ * of the leaf module. The nets are added by the benchmark
+ *******************************************************************/
+static void build_bench_modules(ModuleManager& module_manager,
+                                const t_bench_options& options) {
+  ModuleId leaf_module = module_manager.add_module("bench_leaf");
+  module_manager.add_port(leaf_module, BasicPort("in", 1),
+                          ModuleManager::MODULE_INPUT_PORT);
+  module_manager.add_port(leaf_module, BasicPort("out", 1),
+                          ModuleManager::MODULE_OUTPUT_PORT);
+
+  size_t num_instances = std::max(size_t(1), options.num_nets / 2);
+  for (size_t imod = 0; imod < options.num_modules; ++imod) {
+    ModuleId parent_module =
+      module_manager.add_module("bench_module_" + std::to_string(imod));
+    module_manager.add_port(parent_module, BasicPort("in", num_instances),
+                            ModuleManager::MODULE_INPUT_PORT);
+    module_manager.add_port(parent_module, BasicPort("out", num_instances),
+                            ModuleManager::MODULE_OUTPUT_PORT);
+    for (size_t inst = 0; inst < num_instances; ++inst) {
+      module_manager.add_child_module(parent_module, leaf_module, false);
+    }
+  }
+}
+
+/********************************************************************
+ * Each input of a parent module drives the input of a leaf instance,
+ * whose output drives an output of the parent module
+ *******************************************************************/
+static size_t bench_module_manager_add_module_net(
+  ModuleManager& module_manager) {
+  ModuleId leaf_module = module_manager.find_module("bench_leaf");
+  ModulePortId leaf_in = module_manager.find_module_port(leaf_module, "in");
+  ModulePortId leaf_out = module_manager.find_module_port(leaf_module, "out");
+
+  size_t num_ops = 0;
+  for (const ModuleId& parent_module : module_manager.modules()) {
+    if (parent_module == leaf_module) {
+      continue;
+    }
+    ModulePortId parent_in =
+      module_manager.find_module_port(parent_module, "in");
+    ModulePortId parent_out =
+      module_manager.find_module_port(parent_module, "out");
+    size_t num_instances =
+      module_manager.num_instance(parent_module, leaf_module);
+    for (size_t inst = 0; inst < num_instances; ++inst) {
+      ModuleNetId in_net = module_manager.create_module_net(parent_module);
+      module_manager.add_module_net_source(parent_module, in_net,
+                                           parent_module, 0, parent_in, inst);
+      module_manager.add_module_net_sink(parent_module, in_net, leaf_module,
+                                         inst, leaf_in, 0);
+      ModuleNetId out_net = module_manager.create_module_net(parent_module);
+      module_manager.add_module_net_source(parent_module, out_net, leaf_module,
+                                           inst, leaf_out, 0);
+      module_manager.add_module_net_sink(parent_module, out_net, parent_module,
+                                         0, parent_out, inst);
+      num_ops += 2;
+    }
+  }
+  return num_ops;
+}
+
+/********************************************************************
+ * Write all the modules of a module manager to a Verilog file, which is
+ * removed afterwards
+ *******************************************************************/
+static size_t write_bench_modules(std::fstream& fp,
+                                  const ModuleManager& module_manager) {
+  FabricVerilogOption verilog_options;
+  size_t num_ops = 0;
+  for (const ModuleId& module : module_manager.modules()) {
+    write_verilog_module_to_file(fp, module_manager, module, verilog_options);
+    num_ops++;
+  }
+  return num_ops;
+}
+
+static size_t bench_verilog_module_writer(const ModuleManager& module_manager,
+                                          const t_bench_options& options) {
+  std::string fname = options.output_dir + "/openfpga_bench_modules.v";
+  std::fstream fp;
+  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  check_file_stream(fname.c_str(), fp);
+  size_t num_ops = write_bench_modules(fp, module_manager);
+  fp.close();
+  std::remove(fname.c_str());
+  return num_ops;
+}
+
+/* Same as above but through the buffered and (optionally) compressed
+ * output stream */
+static size_t bench_verilog_module_output_stream(
+  const ModuleManager& module_manager, const t_bench_options& options,
+  const bool& compress) {
+  std::string fname = options.output_dir + "/openfpga_bench_modules.v";
+  OutputFileStream fp(compress);
+  fp.open(fname);
+  check_file_stream(fname.c_str(), fp);
+  size_t num_ops = write_bench_modules(fp, module_manager);
+  fp.close();
+  std::remove(OutputFileStream::file_name(fname, compress).c_str());
+  return num_ops;
+}
+
+static size_t bench_bitstream_manager_add_bit(const t_bench_options& options) {
+  /* Group bits by blocks, as the configurable memories of a programmable
+   * block */
+  constexpr size_t num_bits_per_block = 64;
+  BitstreamManager bitstream_manager;
+  ConfigBlockId block = ConfigBlockId::INVALID();
+  for (size_t ibit = 0; ibit < options.num_bits; ++ibit) {
+    if (0 == ibit % num_bits_per_block) {
+      block = bitstream_manager.add_block("block_" + std::to_string(ibit));
+    }
+    bitstream_manager.add_bit(block, 0 == ibit % 3);
+  }
+  VTR_ASSERT(options.num_bits == bitstream_manager.num_bits());
+  return options.num_bits;
+}
+
+static size_t bench_fabric_bitstream_add_bit(const t_bench_options& options) {
+  FabricBitstream fabric_bitstream;
+  FabricBitRegionId region = fabric_bitstream.add_region();
+  for (size_t ibit = 0; ibit < options.num_bits; ++ibit) {
+    FabricBitId bit = fabric_bitstream.add_bit(ConfigBitId(ibit));
+    fabric_bitstream.add_bit_to_region(region, bit);
+  }
+  VTR_ASSERT(options.num_bits == fabric_bitstream.num_bits());
+  return options.num_bits;
+}
+
+/********************************************************************
+ * Build a circuit library which contains a transmission gate and the
+ * multiplexers of all the structures using it
+ *******************************************************************/
+static CircuitLibrary build_bench_circuit_library(
+  std::vector<CircuitModelId>& mux_models) {
+  CircuitLibrary circuit_lib;
+  CircuitModelId tgate_model = circuit_lib.add_model(CIRCUIT_MODEL_PASSGATE);
+  circuit_lib.set_model_name(tgate_model, "TGATE");
+  circuit_lib.set_pass_gate_logic_type(tgate_model,
+                                       CIRCUIT_MODEL_PASS_GATE_TRANSMISSION);
+
+  std::vector<std::pair<std::string, e_circuit_model_structure>> structures = {
+    {"mux_tree", CIRCUIT_MODEL_STRUCTURE_TREE},
+    {"mux_onelevel", CIRCUIT_MODEL_STRUCTURE_ONELEVEL},
+    {"mux_multilevel", CIRCUIT_MODEL_STRUCTURE_MULTILEVEL}};
+  for (const auto& structure : structures) {
+    CircuitModelId mux_model = circuit_lib.add_model(CIRCUIT_MODEL_MUX);
+    circuit_lib.set_model_name(mux_model, structure.first);
+    circuit_lib.set_model_design_tech_type(mux_model,
+                                           CIRCUIT_MODEL_DESIGN_CMOS);
+    circuit_lib.set_model_pass_gate_logic(mux_model, "TGATE");
+    circuit_lib.set_mux_structure(mux_model, structure.second);
+    if (CIRCUIT_MODEL_STRUCTURE_MULTILEVEL == structure.second) {
+      circuit_lib.set_mux_num_levels(mux_model, 2);
+    }
+    mux_models.push_back(mux_model);
+  }
+  circuit_lib.build_model_links();
+  return circuit_lib;
+}
+
+static size_t bench_mux_graph_build(const CircuitLibrary& circuit_lib,
+                                    const std::vector<CircuitModelId>& models,
+                                    const t_bench_options& options) {
+  size_t num_ops = 0;
+  size_t num_inputs = 0;
+  for (size_t irepeat = 0; irepeat < options.repeat; ++irepeat) {
+    for (const CircuitModelId& mux_model : models) {
+      for (size_t mux_size = 2; mux_size <= options.mux_size; ++mux_size) {
+        MuxGraph mux_graph(circuit_lib, mux_model, mux_size);
+        num_inputs += mux_graph.num_inputs();
+        num_ops++;
+      }
+    }
+  }
+  VTR_ASSERT(0 < num_inputs || 0 == num_ops);
+  return num_ops;
+}
+
+/********************************************************************
+ * Add decoders in the way the fabric builders do, i.e., find a decoder
+ * before adding it, and then look them up as the netlist writers do
+ *******************************************************************/
+static size_t bench_decoder_library_find(const t_bench_options& options) {
+  DecoderLibrary decoder_lib;
+  size_t num_ops = 0;
+  for (size_t irepeat = 0; irepeat < 1 + options.repeat; ++irepeat) {
+    for (size_t data_size = 2; data_size <= options.num_nets; ++data_size) {
+      size_t addr_size = find_mux_local_decoder_addr_size(data_size);
+      for (size_t flags = 0; flags < 16; ++flags) {
+        DecoderId decoder = decoder_lib.find_decoder(
+          addr_size, data_size, flags & 0x1, flags & 0x2, flags & 0x4,
+          flags & 0x8);
+        if (DecoderId::INVALID() == decoder) {
+          VTR_ASSERT(0 == irepeat);
+          decoder = decoder_lib.add_decoder(addr_size, data_size, flags & 0x1,
+                                            flags & 0x2, flags & 0x4,
+                                            flags & 0x8);
+        }
+        VTR_ASSERT(data_size == decoder_lib.data_size(decoder));
+        num_ops++;
+      }
+    }
+  }
+  return num_ops;
+}
+
+static size_t bench_mux_library_find(const CircuitLibrary& circuit_lib,
+                                     const std::vector<CircuitModelId>& models,
+                                     const t_bench_options& options) {
+  MuxLibrary mux_lib;
+  size_t num_ops = 0;
+  for (const CircuitModelId& mux_model : models) {
+    for (size_t mux_size = 2; mux_size <= options.mux_size; ++mux_size) {
+      mux_lib.add_mux(circuit_lib, mux_model, mux_size);
+      num_ops++;
+    }
+  }
+  for (size_t irepeat = 0; irepeat < options.repeat; ++irepeat) {
+    for (const CircuitModelId& mux_model : models) {
+      for (size_t mux_size = 2; mux_size <= options.mux_size; ++mux_size) {
+        MuxId mux = mux_lib.mux_graph(mux_model, mux_size);
+        VTR_ASSERT(mux_model == mux_lib.mux_circuit_model(mux));
+        num_ops++;
+      }
+    }
+  }
+  return num_ops;
+}
+
+/********************************************************************
+ * Build a tiled fabric where every tile module appears under every row,
+ * as the tiles of a real fabric appear under many parents, and write its
+ * whole hierarchy to a text file, which is removed afterwards
+ *******************************************************************/
+static size_t bench_fabric_hierarchy_writer(const t_bench_options& options) {
+  ModuleManager module_manager;
+  ModuleId lut_module = module_manager.add_module("bench_hie_lut");
+  ModuleId ff_module = module_manager.add_module("bench_hie_ff");
+  ModuleId ble_module = module_manager.add_module("bench_hie_ble");
+  module_manager.add_child_module(ble_module, lut_module, false);
+  module_manager.add_child_module(ble_module, ff_module, false);
+  ModuleId clb_module = module_manager.add_module("bench_hie_clb");
+  module_manager.add_child_module(clb_module, ble_module, false);
+
+  std::vector<ModuleId> tile_modules;
+  for (size_t itile = 0; itile < options.num_modules; ++itile) {
+    ModuleId tile_module =
+      module_manager.add_module("bench_hie_tile_" + std::to_string(itile));
+    module_manager.add_child_module(tile_module, clb_module, false);
+    tile_modules.push_back(tile_module);
+  }
+  ModuleId top_module = module_manager.add_module("bench_hie_top");
+  for (size_t irow = 0; irow < options.num_modules; ++irow) {
+    ModuleId row_module =
+      module_manager.add_module("bench_hie_row_" + std::to_string(irow));
+    for (const ModuleId& tile_module : tile_modules) {
+      module_manager.add_child_module(row_module, tile_module, false);
+    }
+    module_manager.add_child_module(top_module, row_module, false);
+  }
+
+  std::string fname = options.output_dir + "/openfpga_bench_hierarchy.txt";
+  ModuleNameMap module_name_map;
+  int status = write_fabric_hierarchy_to_text_file(
+    module_manager, module_name_map, fname, "bench_hie_top", "*", 10, false,
+    false);
+  VTR_ASSERT(CMD_EXEC_SUCCESS == status);
+  std::remove(fname.c_str());
+  /* Each tile instance is an operation */
+  return options.num_modules * options.num_modules;
+}
+
+/********************************************************************
+ * Print the results in a machine-readable format
+ *******************************************************************/
+static void print_results(const std::vector<t_bench_result>& results,
+                          const t_bench_options& options) {
+  if (options.format == "csv") {
+    printf(
+      "benchmark,num_modules,num_nets,num_bits,mux_size,repeat,num_ops,"
+      "runtime_sec,ops_per_sec,max_rss_mib,delta_max_rss_mib\n");
+    for (const t_bench_result& result : results) {
+      printf("%s,%lu,%lu,%lu,%lu,%lu,%lu,%g,%g,%g,%g\n", result.name.c_str(),
+             options.num_modules, options.num_nets, options.num_bits,
+             options.mux_size, options.repeat, result.num_ops, result.runtime,
+             0. < result.runtime ? result.num_ops / result.runtime : 0.,
+             result.max_rss_mib, result.delta_max_rss_mib);
+    }
+    return;
+  }
+  printf("[\n");
+  for (size_t ires = 0; ires < results.size(); ++ires) {
+    const t_bench_result& result = results[ires];
+    printf(
+      "  {\"benchmark\": \"%s\", \"num_modules\": %lu, \"num_nets\": %lu, "
+      "\"num_bits\": %lu, \"mux_size\": %lu, \"repeat\": %lu, "
+      "\"num_ops\": %lu, \"runtime_sec\": %g, \"ops_per_sec\": %g, "
+      "\"max_rss_mib\": %g, \"delta_max_rss_mib\": %g}%s\n",
+      result.name.c_str(), options.num_modules, options.num_nets,
+      options.num_bits, options.mux_size, options.repeat, result.num_ops,
+      result.runtime,
+      0. < result.runtime ? result.num_ops / result.runtime : 0.,
+      result.max_rss_mib, result.delta_max_rss_mib,
+      ires + 1 < results.size() ? "," : "");
+  }
+  printf("]\n");
+}
+
+/********************************************************************
+ * Parse the command-line options. Return false if any option is invalid
+ *******************************************************************/
+static bool parse_options(int argc, const char** argv,
+                          t_bench_options& options) {
+  for (int iarg = 1; iarg < argc; ++iarg) {
+    std::string arg(argv[iarg]);
+    if (iarg + 1 >= argc) {
+      VTR_LOG_ERROR("Missing value for option '%s'!\n", arg.c_str());
+      return false;
+    }
+    std::string value(argv[++iarg]);
+    if (arg == "--benchmark") {
+      options.benchmark = value;
+    } else if (arg == "--format") {
+      if (value != "json" && value != "csv") {
+        VTR_LOG_ERROR("Invalid format '%s'! Expect [json|csv]\n",
+                      value.c_str());
+        return false;
+      }
+      options.format = value;
+    } else if (arg == "--output_dir") {
+      options.output_dir = value;
+    } else {
+      int int_value = std::atoi(value.c_str());
+      if (0 > int_value) {
+        VTR_LOG_ERROR("Invalid value '%s' for option '%s'! Expect >= 0\n",
+                      value.c_str(), arg.c_str());
+        return false;
+      }
+      if (arg == "--num_modules") {
+        options.num_modules = int_value;
+      } else if (arg == "--num_nets") {
+        options.num_nets = int_value;
+      } else if (arg == "--num_bits") {
+        options.num_bits = int_value;
+      } else if (arg == "--mux_size") {
+        options.mux_size = int_value;
+      } else if (arg == "--repeat") {
+        options.repeat = int_value;
+      } else {
+        VTR_LOG_ERROR("Unknown option '%s'!\n", arg.c_str());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} /* end namespace openfpga */
+
+int main(int argc, const char** argv) {
+  openfpga::t_bench_options options;
+  if (false == openfpga::parse_options(argc, argv, options)) {
+    return 1;
+  }
+
+  std::vector<std::string> names = {"module_manager_add_module_net",
+                                    "verilog_module_writer",
+                                    "verilog_module_writer_buffered",
+                                    "verilog_module_writer_compressed",
+                                    "bitstream_manager_add_bit",
+                                    "fabric_bitstream_add_bit",
+                                    "mux_graph_build",
+                                    "decoder_library_find",
+                                    "mux_library_find",
+                                    "fabric_hierarchy_writer"};
+  if (!options.benchmark.empty() &&
+      names.end() == std::find(names.begin(), names.end(), options.benchmark)) {
+    VTR_LOG_ERROR("Unknown benchmark '%s'!\n", options.benchmark.c_str());
+    return 1;
+  }
+  auto enabled = [&options](const std::string& name) {
+    return options.benchmark.empty() || options.benchmark == name;
+  };
+
+  std::vector<openfpga::t_bench_result> results;
+
+  /* The Verilog writers output the modules built by the first benchmark */
+  openfpga::ModuleManager module_manager;
+  if (enabled(names[0]) || enabled(names[1]) || enabled(names[2]) ||
+      enabled(names[3])) {
+    openfpga::build_bench_modules(module_manager, options);
+    openfpga::t_bench_result result =
+      openfpga::run_benchmark(names[0], [&]() {
+        return openfpga::bench_module_manager_add_module_net(module_manager);
+      });
+    if (enabled(names[0])) {
+      results.push_back(result);
+    }
+  }
+  if (enabled(names[1])) {
+    results.push_back(openfpga::run_benchmark(names[1], [&]() {
+      return openfpga::bench_verilog_module_writer(module_manager, options);
+    }));
+  }
+  if (enabled(names[2])) {
+    results.push_back(openfpga::run_benchmark(names[2], [&]() {
+      return openfpga::bench_verilog_module_output_stream(module_manager,
+                                                          options, false);
+    }));
+  }
+  if (enabled(names[3]) &&
+      openfpga::OutputFileStream::compression_supported()) {
+    results.push_back(openfpga::run_benchmark(names[3], [&]() {
+      return openfpga::bench_verilog_module_output_stream(module_manager,
+                                                          options, true);
+    }));
+  }
+  if (enabled(names[4])) {
+    results.push_back(openfpga::run_benchmark(names[4], [&]() {
+      return openfpga::bench_bitstream_manager_add_bit(options);
+    }));
+  }
+  if (enabled(names[5])) {
+    results.push_back(openfpga::run_benchmark(names[5], [&]() {
+      return openfpga::bench_fabric_bitstream_add_bit(options);
+    }));
+  }
+  std::vector<CircuitModelId> mux_models;
+  CircuitLibrary circuit_lib =
+    openfpga::build_bench_circuit_library(mux_models);
+  if (enabled(names[6])) {
+    results.push_back(openfpga::run_benchmark(names[6], [&]() {
+      return openfpga::bench_mux_graph_build(circuit_lib, mux_models, options);
+    }));
+  }
+  if (enabled(names[7])) {
+    results.push_back(openfpga::run_benchmark(names[7], [&]() {
+      return openfpga::bench_decoder_library_find(options);
+    }));
+  }
+  if (enabled(names[8])) {
+    results.push_back(openfpga::run_benchmark(names[8], [&]() {
+      return openfpga::bench_mux_library_find(circuit_lib, mux_models, options);
+    }));
+  }
+  if (enabled(names[9])) {
+    results.push_back(openfpga::run_benchmark(names[9], [&]() {
+      return openfpga::bench_fabric_hierarchy_writer(options);
+    }));
+  }
+
+  openfpga::print_results(results, options);
+  return 0;
+}
@@ -2,13 +2,19 @@
  * This file includes functions that are used to annotate device-level
  * information, in particular the routing resource graph
  *******************************************************************/
+#include <algorithm>
+#include <functional>
+#include <string>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
 
 /* Headers from openfpgautil library */
+#include "openfpga_progress_reporter.h"
 #include "openfpga_side_manager.h"
+#include "openfpga_thread_pool.h"
 
 /* Headers from vpr library */
 #include "annotate_rr_graph.h"
@@ -400,13 +406,46 @@ static RRGSB build_rr_gsb(const DeviceContext& vpr_device_ctx,
   return rr_gsb;
 }
 
+/********************************************************************
+ * Process each GSB in a range with a given number of threads, where 0
+ * means all the available cores. Each GSB is processed once, and only
+ * by one thread. Therefore, the processing function can modify the GSB
+ * as long as it only reads the shared data, e.g., the routing resource
+ * graph. The results are the same as processing the GSBs one by one
+ *******************************************************************/
+static void process_device_rr_gsb(
+  const vtr::Point<size_t>& gsb_range, const size_t& num_threads,
+  const std::function<void(const vtr::Point<size_t>&)>& process_gsb,
+  const std::string& progress_msg) {
+  size_t num_gsbs = gsb_range.x() * gsb_range.y();
+  size_t num_workers = find_num_workers(num_threads, num_gsbs);
+
+  ProgressReporter progress(progress_msg, num_gsbs);
+
+  if (1 < num_workers) {
+    VTR_LOG("Process %lu GSBs with %lu threads\n", num_gsbs, num_workers);
+  }
+  /* The i-th GSB is the one at [i / range.y()][i % range.y()], which is the
+   * order of a serial loop */
+  run_parallel_jobs(
+    num_gsbs, num_workers, [&](const size_t& igsb, const size_t&) {
+      process_gsb(
+        vtr::Point<size_t>(igsb / gsb_range.y(), igsb % gsb_range.y()));
+      progress.update();
+    });
+}
+
 /********************************************************************
  * Build the annotation for the routing resource graph
  * by collecting the nodes to the General Switch Block context
+ * Each GSB only reads the routing resource graph, so that GSBs can be
+ * built concurrently. The GSB array is allocated before building, and each
+ * GSB is stored in its own slot
  *******************************************************************/
 void annotate_device_rr_gsb(const DeviceContext& vpr_device_ctx,
                             DeviceRRGSB& device_rr_gsb,
                             const bool& include_clock,
+                            const size_t& num_threads,
                             const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer(
     "Build General Switch Block(GSB) annotation on top of routing resource "
@@ -424,29 +463,26 @@ void annotate_device_rr_gsb(const DeviceContext& vpr_device_ctx,
   VTR_LOGV(verbose_output, "Start annotation GSB up to [%lu][%lu]\n",
            gsb_range.x(), gsb_range.y());
 
-  size_t gsb_cnt = 0;
   size_t layer = 0;
-  /* For each switch block, determine the size of array */
-  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
-      /* Here we give the builder the fringe coordinates so that it can handle
-       * the GSBs at the borderside correctly sort drive_rr_nodes should be
-       * called if required by users
-       */
-      vtr::Point<size_t> sub_gsb_range(vpr_device_ctx.grid.width() - 1,
-                                       vpr_device_ctx.grid.height() - 1);
+  /* Here we give the builder the fringe coordinates so that it can handle
+   * the GSBs at the borderside correctly sort drive_rr_nodes should be
+   * called if required by users
+   */
+  vtr::Point<size_t> sub_gsb_range(vpr_device_ctx.grid.width() - 1,
+                                   vpr_device_ctx.grid.height() - 1);
+  process_device_rr_gsb(
+    gsb_range, num_threads,
+    [&](const vtr::Point<size_t>& coordinate) {
       const RRGSB& rr_gsb = build_rr_gsb(
-        vpr_device_ctx, sub_gsb_range, layer, vtr::Point<size_t>(ix, iy),
+        vpr_device_ctx, sub_gsb_range, layer, coordinate,
         vpr_device_ctx.arch->perimeter_cb, include_clock);
-      /* Add to device_rr_gsb */
+      /* Add to device_rr_gsb. The array has been reserved, the GSB is
+       * stored without resizing it */
       vtr::Point<size_t> gsb_coordinate = rr_gsb.get_sb_coordinate();
+      VTR_ASSERT(gsb_coordinate == coordinate);
       device_rr_gsb.add_rr_gsb(gsb_coordinate, rr_gsb);
-      gsb_cnt++; /* Update counter */
-      /* Print info */
-      VTR_LOG("[%lu%] Backannotated GSB[%lu][%lu]\r",
-              100 * gsb_cnt / (gsb_range.x() * gsb_range.y()), ix, iy);
-    }
-  }
+    },
+    "Backannotated General Switch Blocks (GSBs)");
   /* Report number of unique mirrors */
   VTR_LOG("Backannotated %d General Switch Blocks (GSBs).\n",
           gsb_range.x() * gsb_range.y());
@@ -458,6 +494,7 @@ void annotate_device_rr_gsb(const DeviceContext& vpr_device_ctx,
  *******************************************************************/
 void sort_device_rr_gsb_chan_node_in_edges(const RRGraphView& rr_graph,
                                            DeviceRRGSB& device_rr_gsb,
+                                           const size_t& num_threads,
                                            const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer(
     "Sort incoming edges for each routing track output node of General Switch "
@@ -470,24 +507,13 @@ void sort_device_rr_gsb_chan_node_in_edges(const RRGraphView& rr_graph,
   VTR_LOGV(verbose_output, "Start sorting edges for GSBs up to [%lu][%lu]\n",
            gsb_range.x(), gsb_range.y());
 
-  size_t gsb_cnt = 0;
-
-  /* For each switch block, determine the size of array */
-  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
-      vtr::Point<size_t> gsb_coordinate(ix, iy);
+  process_device_rr_gsb(
+    gsb_range, num_threads,
+    [&](const vtr::Point<size_t>& gsb_coordinate) {
       RRGSB& rr_gsb = device_rr_gsb.get_mutable_gsb(gsb_coordinate);
       rr_gsb.sort_chan_node_in_edges(rr_graph);
-
-      gsb_cnt++; /* Update counter */
-
-      /* Print info */
-      VTR_LOG(
-        "[%lu%] Sorted incoming edges for each routing track output node of "
-        "GSB[%lu][%lu]\r",
-        100 * gsb_cnt / (gsb_range.x() * gsb_range.y()), ix, iy);
-    }
-  }
+    },
+    "Sorted incoming edges for each routing track output node of GSBs");
 
   /* Report number of unique mirrors */
   VTR_LOG(
@@ -502,6 +528,7 @@ void sort_device_rr_gsb_chan_node_in_edges(const RRGraphView& rr_graph,
  *******************************************************************/
 void sort_device_rr_gsb_ipin_node_in_edges(const RRGraphView& rr_graph,
                                            DeviceRRGSB& device_rr_gsb,
+                                           const size_t& num_threads,
                                            const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer(
     "Sort incoming edges for each input pin node of General Switch Block(GSB)");
@@ -513,24 +540,13 @@ void sort_device_rr_gsb_ipin_node_in_edges(const RRGraphView& rr_graph,
   VTR_LOGV(verbose_output, "Start sorting edges for GSBs up to [%lu][%lu]\n",
            gsb_range.x(), gsb_range.y());
 
-  size_t gsb_cnt = 0;
-
-  /* For each switch block, determine the size of array */
-  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
-      vtr::Point<size_t> gsb_coordinate(ix, iy);
+  process_device_rr_gsb(
+    gsb_range, num_threads,
+    [&](const vtr::Point<size_t>& gsb_coordinate) {
       RRGSB& rr_gsb = device_rr_gsb.get_mutable_gsb(gsb_coordinate);
       rr_gsb.sort_ipin_node_in_edges(rr_graph);
-
-      gsb_cnt++; /* Update counter */
-
-      /* Print info */
-      VTR_LOG(
-        "[%lu%] Sorted incoming edges for each input pin node of "
-        "GSB[%lu][%lu]\r",
-        100 * gsb_cnt / (gsb_range.x() * gsb_range.y()), ix, iy);
-    }
-  }
+    },
+    "Sorted incoming edges for each input pin node of GSBs");
 
   /* Report number of unique mirrors */
   VTR_LOG(
@@ -3,8 +3,11 @@
  * in the users' BLIF netlist that violates the syntax of OpenFPGA
  * fabric generator, i.e., Verilog generator and SPICE generator
  *******************************************************************/
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <string>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -20,6 +23,7 @@
 /* Headers from openfpgautil library */
 #include "check_netlist_naming_conflict.h"
 #include "openfpga_digest.h"
+#include "openfpga_thread_pool.h"
 
 /* Include global variables of VPR */
 #include "globals.h"
@@ -27,49 +31,216 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/* Maximum number of names in violation to be printed when not verbose */
+constexpr size_t NAMING_CONFLICT_MAX_NUM_EXAMPLES = 10;
+/* Number of names to be checked by a job. Names are short, so the cost of
+ * dispatching a job for each name would be comparable to checking it */
+constexpr size_t NAMING_CONFLICT_JOB_SIZE = 4096;
+
 /********************************************************************
- * This function aims to check if the name contains any of the
- * sensitive characters in the list
- * Return a string of sensitive characters which are contained
- * in the name
+ * A look-up table which classifies any character in a name in constant
+ * time, i.e., if the character is sensitive and which character should
+ * replace it. A name is then checked or fixed in a single scan, whatever
+ * the number of sensitive characters
  *******************************************************************/
-static std::string name_contain_sensitive_chars(
-  const std::string& name, const std::string& sensitive_chars) {
-  std::string violation;
+class NamingCharTable {
+ public: /* Constructors */
+  NamingCharTable(const std::string& sensitive_chars,
+                  const std::string& fix_chars)
+    : sensitive_chars_(sensitive_chars) {
+    VTR_ASSERT(fix_chars.empty() ||
+               (sensitive_chars.length() == fix_chars.length()));
+    sensitive_.fill(false);
+    fix_chars_.fill('\0');
+    for (size_t ichar = 0; ichar < sensitive_chars.length(); ++ichar) {
+      unsigned char sensitive_char = sensitive_chars[ichar];
+      sensitive_[sensitive_char] = true;
+      if (false == fix_chars.empty()) {
+        fix_chars_[sensitive_char] = fix_chars[ichar];
+      }
+    }
+  }
 
-  for (const char& sensitive_char : sensitive_chars) {
-    /* Return true since we find a characters */
-    if (std::string::npos != name.find(sensitive_char)) {
-      violation.push_back(sensitive_char);
+ public: /* Public accessors */
+  bool is_sensitive(const char& c) const {
+    return sensitive_[static_cast<unsigned char>(c)];
+  }
+
+  /* Identify if the name contains any of the sensitive characters */
+  bool contain_sensitive_chars(const std::string& name) const {
+    for (const char& c : name) {
+      if (true == is_sensitive(c)) {
+        return true;
+      }
     }
+    return false;
+  }
+
+  /* Return a string of sensitive characters which are contained in the
+   * name, in the same order as the list of sensitive characters */
+  std::string sensitive_chars(const std::string& name) const {
+    std::array<bool, 256> found;
+    found.fill(false);
+    for (const char& c : name) {
+      found[static_cast<unsigned char>(c)] = true;
+    }
+    std::string violation;
+    for (const char& sensitive_char : sensitive_chars_) {
+      if (true == found[static_cast<unsigned char>(sensitive_char)]) {
+        violation.push_back(sensitive_char);
+      }
+    }
+    return violation;
+  }
+
+  /* Return the name where all the sensitive characters are replaced */
+  std::string fix_name(const std::string& name) const {
+    std::string fixed_name = name;
+    for (char& c : fixed_name) {
+      if (true == is_sensitive(c)) {
+        VTR_ASSERT('\0' != fix_chars_[static_cast<unsigned char>(c)]);
+        c = fix_chars_[static_cast<unsigned char>(c)];
+      }
+    }
+    return fixed_name;
+  }
+
+ private: /* Internal data */
+  std::string sensitive_chars_;
+  std::array<bool, 256> sensitive_;
+  std::array<char, 256> fix_chars_;
+};
+
+/********************************************************************
+ * A job to check a range of names [begin, end) in a list
+ *******************************************************************/
+struct t_naming_conflict_job {
+  size_t begin;
+  size_t end;
+  /* Indices of the names in violation, in ascending order */
+  std::vector<size_t> violations;
+  /* Fixed names of the names in violation, if a fix-up is required */
+  std::vector<std::string> fixed_names;
+};
+
+/********************************************************************
+ * Names in violation found in a list of names, in the order of the list
+ *******************************************************************/
+struct t_naming_conflicts {
+  std::vector<size_t> violations;
+  std::vector<std::string> fixed_names;
+};
+
+/********************************************************************
+ * Check the names of a job. The netlist is only read here, so that jobs
+ * can run concurrently
+ *******************************************************************/
+template <class NameFunc>
+static void check_naming_conflict_job(t_naming_conflict_job& job,
+                                      const NameFunc& name_of,
+                                      const NamingCharTable& char_table,
+                                      const bool& fix) {
+  for (size_t iname = job.begin; iname < job.end; ++iname) {
+    const std::string& name = name_of(iname);
+    if (false == char_table.contain_sensitive_chars(name)) {
+      continue;
+    }
+    job.violations.push_back(iname);
+    if (true == fix) {
+      job.fixed_names.push_back(char_table.fix_name(name));
+    }
+  }
+}
+
+/********************************************************************
+ * Find all the names in violation in a list of names, with a given number
+ * of threads. The list is split into jobs of consecutive names, whose
+ * results are merged in order. As a result, the names in violation are
+ * always in the order of the list, whatever the number of threads
+ *******************************************************************/
+template <class NameFunc>
+static t_naming_conflicts find_naming_conflicts(
+  const size_t& num_names, const NameFunc& name_of,
+  const NamingCharTable& char_table, const bool& fix,
+  const size_t& num_threads) {
+  std::vector<t_naming_conflict_job> jobs;
+  for (size_t begin = 0; begin < num_names;
+       begin += NAMING_CONFLICT_JOB_SIZE) {
+    t_naming_conflict_job job;
+    job.begin = begin;
+    job.end = std::min(num_names, begin + NAMING_CONFLICT_JOB_SIZE);
+    jobs.push_back(job);
   }
 
-  return violation;
+  size_t num_workers = find_num_workers(num_threads, jobs.size());
+  run_parallel_jobs(
+    jobs.size(), num_workers, [&](const size_t& ijob, const size_t&) {
+      check_naming_conflict_job(jobs[ijob], name_of, char_table, fix);
+    });
+
+  t_naming_conflicts conflicts;
+  for (t_naming_conflict_job& job : jobs) {
+    conflicts.violations.insert(conflicts.violations.end(),
+                                job.violations.begin(), job.violations.end());
+    for (std::string& fixed_name : job.fixed_names) {
+      conflicts.fixed_names.push_back(std::move(fixed_name));
+    }
+  }
+  return conflicts;
 }
 
 /********************************************************************
- * This function aims to fix up a name that contains any of the
- * sensitive characters in the list
- * Return a string the fixed name
+ * Print a summary of the names in violation of a kind of netlist
+ * components, e.g., blocks or nets:
+ * - the number of names which contain each sensitive character
+ * - the names in violation and their fix-up if applied. Unless verbose
+ *   output is required, only the first few names are printed
  *******************************************************************/
-static std::string fix_name_contain_sensitive_chars(
-  const std::string& name, const std::string& sensitive_chars,
-  const std::string& fix_chars) {
-  std::string fixed_name = name;
-
-  VTR_ASSERT(sensitive_chars.length() == fix_chars.length());
-
-  for (size_t ichar = 0; ichar < sensitive_chars.length(); ++ichar) {
-    /* Keep fixing the characters until we cannot find anymore */
-    std::string::size_type pos = 0u;
-    while (std::string::npos !=
-           (pos = fixed_name.find(sensitive_chars[ichar], pos))) {
-      fixed_name.replace(pos, 1, std::string(1, fix_chars[ichar]));
-      pos += 1;
+template <class NameFunc>
+static void report_naming_conflicts(const char* kind,
+                                    const t_naming_conflicts& conflicts,
+                                    const NameFunc& name_of,
+                                    const std::string& sensitive_chars,
+                                    const NamingCharTable& char_table,
+                                    const bool& verbose) {
+  if (true == conflicts.violations.empty()) {
+    return;
+  }
+
+  std::array<size_t, 256> char_counts;
+  char_counts.fill(0);
+  for (const size_t& iname : conflicts.violations) {
+    for (const char& c : char_table.sensitive_chars(name_of(iname))) {
+      char_counts[static_cast<unsigned char>(c)]++;
     }
   }
 
-  return fixed_name;
+  VTR_LOG("Found %lu %ss with illegal characters:\n",
+          conflicts.violations.size(), kind);
+  for (const char& sensitive_char : sensitive_chars) {
+    size_t char_count = char_counts[static_cast<unsigned char>(sensitive_char)];
+    if (0 < char_count) {
+      VTR_LOG("\t'%c' in %lu %ss\n", sensitive_char, char_count, kind);
+    }
+  }
+
+  size_t num_examples = conflicts.violations.size();
+  if (false == verbose) {
+    num_examples = std::min(num_examples, NAMING_CONFLICT_MAX_NUM_EXAMPLES);
+  }
+  for (size_t iviolation = 0; iviolation < num_examples; ++iviolation) {
+    const std::string& name = name_of(conflicts.violations[iviolation]);
+    if (true == conflicts.fixed_names.empty()) {
+      VTR_LOG("\t%s '%s' contains illegal characters '%s'\n", kind,
+              name.c_str(), char_table.sensitive_chars(name).c_str());
+    } else {
+      VTR_LOG("\t%s '%s' is renamed to '%s'\n", kind, name.c_str(),
+              conflicts.fixed_names[iviolation].c_str());
+    }
+  }
+  VTR_LOGV(num_examples < conflicts.violations.size(),
+           "\t...and %lu more %ss. Use verbose output to show all of them\n",
+           conflicts.violations.size() - num_examples, kind);
 }
 
 /********************************************************************
@@ -81,34 +252,34 @@ static std::string fix_name_contain_sensitive_chars(
  *   any sensitive character
  *******************************************************************/
 size_t detect_netlist_naming_conflict(const AtomNetlist& atom_netlist,
-                                      const std::string& sensitive_chars) {
-  size_t num_conflicts = 0;
+                                      const std::string& sensitive_chars,
+                                      const size_t& num_threads,
+                                      const bool& verbose) {
+  NamingCharTable char_table(sensitive_chars, std::string());
 
   /* Walk through blocks in the netlist */
-  for (const auto& block : atom_netlist.blocks()) {
-    const std::string& block_name = atom_netlist.block_name(block);
-    const std::string& violation =
-      name_contain_sensitive_chars(block_name, sensitive_chars);
-    if (false == violation.empty()) {
-      VTR_LOG("Block '%s' contains illegal characters '%s'\n",
-              block_name.c_str(), violation.c_str());
-      num_conflicts++;
-    }
-  }
+  std::vector<AtomBlockId> blocks(atom_netlist.blocks().begin(),
+                                  atom_netlist.blocks().end());
+  auto block_name_of = [&](const size_t& iblk) -> const std::string& {
+    return atom_netlist.block_name(blocks[iblk]);
+  };
+  t_naming_conflicts block_conflicts = find_naming_conflicts(
+    blocks.size(), block_name_of, char_table, false, num_threads);
+  report_naming_conflicts("block", block_conflicts, block_name_of,
+                          sensitive_chars, char_table, verbose);
 
   /* Walk through nets in the netlist */
-  for (const auto& net : atom_netlist.nets()) {
-    const std::string& net_name = atom_netlist.net_name(net);
-    const std::string& violation =
-      name_contain_sensitive_chars(net_name, sensitive_chars);
-    if (false == violation.empty()) {
-      VTR_LOG("Net '%s' contains illegal characters '%s'\n", net_name.c_str(),
-              violation.c_str());
-      num_conflicts++;
-    }
-  }
-
-  return num_conflicts;
+  std::vector<AtomNetId> nets(atom_netlist.nets().begin(),
+                              atom_netlist.nets().end());
+  auto net_name_of = [&](const size_t& inet) -> const std::string& {
+    return atom_netlist.net_name(nets[inet]);
+  };
+  t_naming_conflicts net_conflicts = find_naming_conflicts(
+    nets.size(), net_name_of, char_table, false, num_threads);
+  report_naming_conflicts("net", net_conflicts, net_name_of, sensitive_chars,
+                          char_table, verbose);
+
+  return block_conflicts.violations.size() + net_conflicts.violations.size();
 }
 
 /********************************************************************
@@ -118,42 +289,52 @@ size_t detect_netlist_naming_conflict(const AtomNetlist& atom_netlist,
  *   any sensitive character
  * - Iterate over all the nets and correct any net name that contains
  *   any sensitive character
+ * Fixed names are found concurrently, while the annotation is updated
+ * afterwards in the order of blocks and nets
  *******************************************************************/
 void fix_netlist_naming_conflict(const AtomNetlist& atom_netlist,
                                  const std::string& sensitive_chars,
                                  const std::string& fix_chars,
-                                 VprNetlistAnnotation& vpr_netlist_annotation) {
-  size_t num_fixes = 0;
+                                 VprNetlistAnnotation& vpr_netlist_annotation,
+                                 const size_t& num_threads,
+                                 const bool& verbose) {
+  NamingCharTable char_table(sensitive_chars, fix_chars);
 
   /* Walk through blocks in the netlist */
-  for (const auto& block : atom_netlist.blocks()) {
-    const std::string& block_name = atom_netlist.block_name(block);
-    const std::string& violation =
-      name_contain_sensitive_chars(block_name, sensitive_chars);
-
-    if (false == violation.empty()) {
-      /* Apply fix-up here */
-      vpr_netlist_annotation.rename_block(
-        block, fix_name_contain_sensitive_chars(block_name, sensitive_chars,
-                                                fix_chars));
-      num_fixes++;
-    }
+  std::vector<AtomBlockId> blocks(atom_netlist.blocks().begin(),
+                                  atom_netlist.blocks().end());
+  auto block_name_of = [&](const size_t& iblk) -> const std::string& {
+    return atom_netlist.block_name(blocks[iblk]);
+  };
+  t_naming_conflicts block_conflicts = find_naming_conflicts(
+    blocks.size(), block_name_of, char_table, true, num_threads);
+  report_naming_conflicts("block", block_conflicts, block_name_of,
+                          sensitive_chars, char_table, verbose);
+  for (size_t ifix = 0; ifix < block_conflicts.violations.size(); ++ifix) {
+    /* Apply fix-up here */
+    vpr_netlist_annotation.rename_block(
+      blocks[block_conflicts.violations[ifix]],
+      block_conflicts.fixed_names[ifix]);
   }
 
   /* Walk through nets in the netlist */
-  for (const auto& net : atom_netlist.nets()) {
-    const std::string& net_name = atom_netlist.net_name(net);
-    const std::string& violation =
-      name_contain_sensitive_chars(net_name, sensitive_chars);
-    if (false == violation.empty()) {
-      /* Apply fix-up here */
-      vpr_netlist_annotation.rename_net(
-        net,
-        fix_name_contain_sensitive_chars(net_name, sensitive_chars, fix_chars));
-      num_fixes++;
-    }
+  std::vector<AtomNetId> nets(atom_netlist.nets().begin(),
+                              atom_netlist.nets().end());
+  auto net_name_of = [&](const size_t& inet) -> const std::string& {
+    return atom_netlist.net_name(nets[inet]);
+  };
+  t_naming_conflicts net_conflicts = find_naming_conflicts(
+    nets.size(), net_name_of, char_table, true, num_threads);
+  report_naming_conflicts("net", net_conflicts, net_name_of, sensitive_chars,
+                          char_table, verbose);
+  for (size_t ifix = 0; ifix < net_conflicts.violations.size(); ++ifix) {
+    /* Apply fix-up here */
+    vpr_netlist_annotation.rename_net(nets[net_conflicts.violations[ifix]],
+                                      net_conflicts.fixed_names[ifix]);
   }
 
+  size_t num_fixes =
+    block_conflicts.violations.size() + net_conflicts.violations.size();
   if (0 < num_fixes) {
     VTR_LOG("Fixed %ld naming conflicts in the netlist.\n", num_fixes);
   }
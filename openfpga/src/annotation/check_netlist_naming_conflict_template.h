@@ -8,6 +8,8 @@
 #include "command.h"
 #include "command_context.h"
 #include "command_exit_codes.h"
+#include "openfpga_thread_pool.h"
+#include "vtr_log.h"
 #include "vtr_time.h"
 
 /********************************************************************
@@ -34,12 +36,23 @@ int check_netlist_naming_conflict_template(T& openfpga_context,
   std::string fix_chars("____________________________");
 
   CommandOptionId opt_fix = cmd.option("fix");
+  CommandOptionId opt_num_threads = cmd.option("num_threads");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  /* By default, check the names in a single thread */
+  size_t num_threads = 1;
+  if (true == cmd_context.option_enable(cmd, opt_num_threads) &&
+      false == read_num_threads(cmd_context.option_value(cmd, opt_num_threads),
+                                num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
 
   /* Do the main job first: detect any naming in the BLIF netlist that violates
    * the syntax */
   if (false == cmd_context.option_enable(cmd, opt_fix)) {
-    size_t num_conflicts =
-      detect_netlist_naming_conflict(g_vpr_ctx.atom().nlist, sensitive_chars);
+    size_t num_conflicts = detect_netlist_naming_conflict(
+      g_vpr_ctx.atom().nlist, sensitive_chars, num_threads,
+      cmd_context.option_enable(cmd, opt_verbose));
     VTR_LOGV_ERROR(
       (0 < num_conflicts && (false == cmd_context.option_enable(cmd, opt_fix))),
       "Found %ld naming conflicts in the netlist. Please correct so as to use "
@@ -62,7 +75,8 @@ int check_netlist_naming_conflict_template(T& openfpga_context,
   if (true == cmd_context.option_enable(cmd, opt_fix)) {
     fix_netlist_naming_conflict(
       g_vpr_ctx.atom().nlist, sensitive_chars, fix_chars,
-      openfpga_context.mutable_vpr_netlist_annotation());
+      openfpga_context.mutable_vpr_netlist_annotation(), num_threads,
+      cmd_context.option_enable(cmd, opt_verbose));
 
     CommandOptionId opt_report = cmd.option("report");
     if (true == cmd_context.option_enable(cmd, opt_report)) {
@@ -1,8 +1,12 @@
 #include "route_clock_rr_graph.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "command_exit_codes.h"
 #include "openfpga_annotate_routing.h"
 #include "openfpga_clustered_netlist_utils.h"
+#include "openfpga_thread_pool.h"
 #include "vtr_assert.h"
 #include "vtr_geometry.h"
 #include "vtr_log.h"
@@ -11,6 +15,64 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * The routing results of a pin of a clock tree. Routing results are
+ * recorded here rather than in the routing annotation, so that the pins
+ * can be routed concurrently. The records are committed to the routing
+ * annotation in the order of trees and pins, which is the same as routing
+ * them one by one
+ *******************************************************************/
+class ClockRoutingRecord {
+ public: /* Public mutators, same as those of VprRoutingAnnotation */
+  void set_rr_node_net(const RRNodeId& rr_node, const ClusterNetId& net_id) {
+    records_.push_back({false, rr_node, RRNodeId::INVALID(), net_id});
+  }
+  void set_rr_node_prev_node(const RRGraphView& rr_graph,
+                             const RRNodeId& rr_node,
+                             const RRNodeId& prev_node) {
+    VTR_ASSERT(rr_graph.valid_node(rr_node));
+    records_.push_back({true, rr_node, prev_node, ClusterNetId::INVALID()});
+  }
+
+ public: /* Public accessors */
+  /* Apply the routing results to the routing annotation. The records are
+   * applied in the order they are created, so that the warnings of the
+   * routing annotation are the same as routing the pins one by one */
+  void commit(VprRoutingAnnotation& vpr_routing_annotation,
+              const RRGraphView& rr_graph) const {
+    for (const t_record& record : records_) {
+      if (record.is_prev_node) {
+        vpr_routing_annotation.set_rr_node_prev_node(rr_graph, record.node,
+                                                     record.prev_node);
+      } else {
+        vpr_routing_annotation.set_rr_node_net(record.node, record.net);
+      }
+    }
+  }
+
+ private: /* Internal data */
+  /* Either a previous node or a net of a routing resource node */
+  struct t_record {
+    bool is_prev_node;
+    RRNodeId node;
+    RRNodeId prev_node;
+    ClusterNetId net;
+  };
+  std::vector<t_record> records_;
+};
+
+/* A pin of a clock tree to be routed, which is the unit of work when routing
+ * clock trees concurrently. The start and finish time are used to report the
+ * wall time of each clock tree */
+struct t_clock_tree_pin_job {
+  ClockTreeId tree;
+  ClockTreePinId pin;
+  ClockRoutingRecord routing_record;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point finish;
+  int status = CMD_EXEC_SUCCESS;
+};
+
 /********************************************************************
  * Build the lookup between clock name and pins and clock tree pins
  * This is required for routing clock nets in each clock tree
@@ -90,7 +152,7 @@ static int build_clock_tree_net_map(
  * - connect internal driver to routing track
  *******************************************************************/
 static int route_clock_spine_switch_point(
-  VprRoutingAnnotation& vpr_routing_annotation, const RRGraphView& rr_graph,
+  ClockRoutingRecord& routing_record, const RRGraphView& rr_graph,
   const RRClockSpatialLookup& clk_rr_lookup,
   const vtr::vector<RRNodeId, ClusterNetId>& rr_node_gnets,
   const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map,
@@ -170,12 +232,9 @@ static int route_clock_spine_switch_point(
         continue;
       }
       /* This is the opin node we need, use it as the internal driver */
-      vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
-                                                   opin_node);
-      vpr_routing_annotation.set_rr_node_net(opin_node,
-                                             tree2clk_pin_map.at(ipin));
-      vpr_routing_annotation.set_rr_node_net(des_node,
-                                             tree2clk_pin_map.at(ipin));
+      routing_record.set_rr_node_prev_node(rr_graph, des_node, opin_node);
+      routing_record.set_rr_node_net(opin_node, tree2clk_pin_map.at(ipin));
+      routing_record.set_rr_node_net(des_node, tree2clk_pin_map.at(ipin));
       use_int_driver++;
       VTR_LOGV(verbose,
                "Routed switch points of spine '%s' at the switching point "
@@ -202,12 +261,12 @@ static int route_clock_spine_switch_point(
            clk_ntwk.spine_name(ispine).c_str(), size_t(src_node), src_coord.x(),
            src_coord.y(), clk_ntwk.spine_name(des_spine).c_str(),
            size_t(des_node), des_coord.x(), des_coord.y());
-  vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node, src_node);
+  routing_record.set_rr_node_prev_node(rr_graph, des_node, src_node);
   /* It could happen that there is no net mapped some clock pin, skip the
    * net mapping */
   if (tree2clk_pin_map.find(ipin) != tree2clk_pin_map.end()) {
-    vpr_routing_annotation.set_rr_node_net(src_node, tree2clk_pin_map.at(ipin));
-    vpr_routing_annotation.set_rr_node_net(des_node, tree2clk_pin_map.at(ipin));
+    routing_record.set_rr_node_net(src_node, tree2clk_pin_map.at(ipin));
+    routing_record.set_rr_node_net(des_node, tree2clk_pin_map.at(ipin));
   }
 
   return CMD_EXEC_SUCCESS;
@@ -218,7 +277,7 @@ static int route_clock_spine_switch_point(
  * - Only connect to tap points which are mapped by a global net
  *******************************************************************/
 static int route_spine_taps(
-  VprRoutingAnnotation& vpr_routing_annotation, bool& spine_usage,
+  ClockRoutingRecord& routing_record, bool& spine_usage,
   const RRGraphView& rr_graph, const RRClockSpatialLookup& clk_rr_lookup,
   const vtr::vector<RRNodeId, ClusterNetId>& rr_node_gnets,
   const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map,
@@ -274,12 +333,9 @@ static int route_spine_taps(
           VTR_ASSERT(rr_graph.valid_node(des_node));
           VTR_LOGV(verbose, "Routed clock tap of spine '%s'\n",
                    clk_ntwk.spine_name(ispine).c_str());
-          vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
-                                                       src_node);
-          vpr_routing_annotation.set_rr_node_net(src_node,
-                                                 tree2clk_pin_map.at(ipin));
-          vpr_routing_annotation.set_rr_node_net(des_node,
-                                                 tree2clk_pin_map.at(ipin));
+          routing_record.set_rr_node_prev_node(rr_graph, des_node, src_node);
+          routing_record.set_rr_node_net(src_node, tree2clk_pin_map.at(ipin));
+          routing_record.set_rr_node_net(des_node, tree2clk_pin_map.at(ipin));
           /* Increment upon any required tap */
           spine_tap_cnt++;
         }
@@ -297,7 +353,7 @@ static int route_spine_taps(
  * Recursively route a clock spine on an existing routing resource graph
  *******************************************************************/
 static int route_spine_intermediate_drivers(
-  VprRoutingAnnotation& vpr_routing_annotation, const RRGraphView& rr_graph,
+  ClockRoutingRecord& routing_record, const RRGraphView& rr_graph,
   const RRClockSpatialLookup& clk_rr_lookup,
   const vtr::vector<RRNodeId, ClusterNetId>& rr_node_gnets,
   const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map,
@@ -332,12 +388,9 @@ static int route_spine_intermediate_drivers(
         continue;
       }
       /* This is the opin node we need, use it as the internal driver */
-      vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
-                                                   opin_node);
-      vpr_routing_annotation.set_rr_node_net(opin_node,
-                                             tree2clk_pin_map.at(curr_pin));
-      vpr_routing_annotation.set_rr_node_net(des_node,
-                                             tree2clk_pin_map.at(curr_pin));
+      routing_record.set_rr_node_prev_node(rr_graph, des_node, opin_node);
+      routing_record.set_rr_node_net(opin_node, tree2clk_pin_map.at(curr_pin));
+      routing_record.set_rr_node_net(des_node, tree2clk_pin_map.at(curr_pin));
       use_int_driver++;
       VTR_LOGV(verbose,
                "Routed intermediate point of spine '%s' at "
@@ -398,7 +451,7 @@ static int route_spine_intermediate_drivers(
  *
  *******************************************************************/
 static int rec_expand_and_route_clock_spine(
-  VprRoutingAnnotation& vpr_routing_annotation, bool& spine_usage,
+  ClockRoutingRecord& routing_record, bool& spine_usage,
   const RRGraphView& rr_graph, const RRClockSpatialLookup& clk_rr_lookup,
   const vtr::vector<RRNodeId, ClusterNetId>& rr_node_gnets,
   const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map,
@@ -409,7 +462,7 @@ static int rec_expand_and_route_clock_spine(
   bool curr_spine_usage = false;
   bool curr_tap_usage = false;
   /* For last level, we just connect tap points */
-  status = route_spine_taps(vpr_routing_annotation, curr_tap_usage, rr_graph,
+  status = route_spine_taps(routing_record, curr_tap_usage, rr_graph,
                             clk_rr_lookup, rr_node_gnets, tree2clk_pin_map,
                             clk_ntwk, clk_tree, curr_spine, curr_pin, verbose);
   if (CMD_EXEC_SUCCESS != status) {
@@ -450,7 +503,7 @@ static int rec_expand_and_route_clock_spine(
       /* Go recursively for the destination spine */
       bool curr_branch_usage = false;
       status = rec_expand_and_route_clock_spine(
-        vpr_routing_annotation, curr_branch_usage, rr_graph, clk_rr_lookup,
+        routing_record, curr_branch_usage, rr_graph, clk_rr_lookup,
         rr_node_gnets, tree2clk_pin_map, clk_ntwk, clk_tree, des_spine,
         curr_pin, disable_unused_spines, verbose);
       if (CMD_EXEC_SUCCESS != status) {
@@ -468,7 +521,7 @@ static int rec_expand_and_route_clock_spine(
       curr_stop_usage = true;
       /* Now connect to next spine, internal drivers may join */
       status = route_clock_spine_switch_point(
-        vpr_routing_annotation, rr_graph, clk_rr_lookup, rr_node_gnets,
+        routing_record, rr_graph, clk_rr_lookup, rr_node_gnets,
         tree2clk_pin_map, clk_ntwk, clk_tree, curr_spine, curr_pin,
         switch_point_id, verbose);
       if (CMD_EXEC_SUCCESS != status) {
@@ -494,7 +547,7 @@ static int rec_expand_and_route_clock_spine(
       vtr::Point<int> des_coord = spine_coords[icoord];
 
       int use_int_driver = route_spine_intermediate_drivers(
-        vpr_routing_annotation, rr_graph, clk_rr_lookup, rr_node_gnets,
+        routing_record, rr_graph, clk_rr_lookup, rr_node_gnets,
         tree2clk_pin_map, clk_ntwk, clk_tree, curr_spine, curr_pin, des_coord,
         verbose);
       if (use_int_driver > 1) {
@@ -528,9 +581,8 @@ static int rec_expand_and_route_clock_spine(
      * global net is mapped to the internal driver, use it as the previous
      * node  */
     int use_int_driver = route_spine_intermediate_drivers(
-      vpr_routing_annotation, rr_graph, clk_rr_lookup, rr_node_gnets,
-      tree2clk_pin_map, clk_ntwk, clk_tree, curr_spine, curr_pin, des_coord,
-      verbose);
+      routing_record, rr_graph, clk_rr_lookup, rr_node_gnets, tree2clk_pin_map,
+      clk_ntwk, clk_tree, curr_spine, curr_pin, des_coord, verbose);
     if (use_int_driver > 1) {
       return CMD_EXEC_FATAL_ERROR;
     }
@@ -543,14 +595,12 @@ static int rec_expand_and_route_clock_spine(
              "y=%lu)...\n",
              clk_ntwk.spine_name(curr_spine).c_str(), src_coord.x(),
              src_coord.y(), des_coord.x(), des_coord.y());
-    vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node, src_node);
+    routing_record.set_rr_node_prev_node(rr_graph, des_node, src_node);
     /* It could happen that there is no net mapped some clock pin, skip the
      * net mapping */
     if (tree2clk_pin_map.find(curr_pin) != tree2clk_pin_map.end()) {
-      vpr_routing_annotation.set_rr_node_net(src_node,
-                                             tree2clk_pin_map.at(curr_pin));
-      vpr_routing_annotation.set_rr_node_net(des_node,
-                                             tree2clk_pin_map.at(curr_pin));
+      routing_record.set_rr_node_net(src_node, tree2clk_pin_map.at(curr_pin));
+      routing_record.set_rr_node_net(des_node, tree2clk_pin_map.at(curr_pin));
     }
 
     prev_stop_usage = true;
@@ -563,45 +613,39 @@ static int rec_expand_and_route_clock_spine(
 }
 
 /********************************************************************
- * Route a clock tree on an existing routing resource graph
+ * Route a pin of a clock tree on an existing routing resource graph
  * The strategy is to route spine one by one
  * - route the spine from the starting point to the ending point
  * - route the spine-to-spine switching points
  * - route the spine-to-IPIN connections (only for the last level)
+ * Note that different pins of a clock tree, as well as different clock
+ * trees, use disjoint routing resources. Therefore, they can be routed
+ * independently
  *******************************************************************/
-static int route_clock_tree_rr_graph(
-  VprRoutingAnnotation& vpr_routing_annotation, const RRGraphView& rr_graph,
+static int route_clock_tree_pin_rr_graph(
+  ClockRoutingRecord& routing_record, const RRGraphView& rr_graph,
   const RRClockSpatialLookup& clk_rr_lookup,
   const vtr::vector<RRNodeId, ClusterNetId>& rr_node_gnets,
   const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map,
   const ClockNetwork& clk_ntwk, const ClockTreeId& clk_tree,
-  const bool& disable_unused_trees, const bool& disable_unused_spines,
+  const ClockTreePinId& ipin, const bool& disable_unused_spines,
   const bool& verbose) {
-  for (auto ipin : clk_ntwk.pins(clk_tree)) {
-    /* Do not route unused clock spines */
-    if (disable_unused_trees &&
-        tree2clk_pin_map.find(ipin) == tree2clk_pin_map.end()) {
-      VTR_LOGV(verbose, "Skip routing unused tree '%s' pin '%lu'...\n",
-               clk_ntwk.tree_name(clk_tree).c_str(), size_t(ipin));
-      continue;
-    }
-    /* Start with the top-level spines. Recursively walk through coordinates and
-     * expand on switch points */
-    bool tree_usage = false;
-    for (auto top_spine : clk_ntwk.tree_top_spines(clk_tree)) {
-      int status = rec_expand_and_route_clock_spine(
-        vpr_routing_annotation, tree_usage, rr_graph, clk_rr_lookup,
-        rr_node_gnets, tree2clk_pin_map, clk_ntwk, clk_tree, top_spine, ipin,
-        disable_unused_spines, verbose);
-      if (CMD_EXEC_SUCCESS != status) {
-        return CMD_EXEC_FATAL_ERROR;
-      }
-    }
-    if (!tree_usage) {
-      VTR_LOGV(verbose, "Detect unused tree '%s' pin '%lu'...\n",
-               clk_ntwk.tree_name(clk_tree).c_str(), size_t(ipin));
+  /* Start with the top-level spines. Recursively walk through coordinates and
+   * expand on switch points */
+  bool tree_usage = false;
+  for (auto top_spine : clk_ntwk.tree_top_spines(clk_tree)) {
+    int status = rec_expand_and_route_clock_spine(
+      routing_record, tree_usage, rr_graph, clk_rr_lookup, rr_node_gnets,
+      tree2clk_pin_map, clk_ntwk, clk_tree, top_spine, ipin,
+      disable_unused_spines, verbose);
+    if (CMD_EXEC_SUCCESS != status) {
+      return CMD_EXEC_FATAL_ERROR;
     }
   }
+  if (!tree_usage) {
+    VTR_LOGV(verbose, "Detect unused tree '%s' pin '%lu'...\n",
+             clk_ntwk.tree_name(clk_tree).c_str(), size_t(ipin));
+  }
   return CMD_EXEC_SUCCESS;
 }
 
@@ -610,6 +654,10 @@ static int route_clock_tree_rr_graph(
  * This function will do the following jobs:
  * - configure the routing annotation w.r.t. the clock node connections
  * - quick check to ensure routing is valid
+ * When more than one thread is requested, the pins of all the clock trees
+ * are routed concurrently, and the routing results are committed to the
+ * routing annotation in the order of trees and pins. The routing annotation
+ * is the same as routing the pins one by one
  *******************************************************************/
 int route_clock_rr_graph(
   VprRoutingAnnotation& vpr_routing_annotation,
@@ -618,7 +666,8 @@ int route_clock_rr_graph(
   const PlacementContext& vpr_place_ctx,
   const RRClockSpatialLookup& clk_rr_lookup, const ClockNetwork& clk_ntwk,
   const PinConstraints& pin_constraints, const bool& disable_unused_trees,
-  const bool& disable_unused_spines, const bool& verbose) {
+  const bool& disable_unused_spines, const size_t& num_threads,
+  const bool& verbose) {
   vtr::ScopedStartFinishTimer timer(
     "Route programmable clock network based on routing resource graph");
 
@@ -654,30 +703,81 @@ int route_clock_rr_graph(
     annotate_rr_node_global_net(vpr_device_ctx, cluster_nlist, vpr_place_ctx,
                                 vpr_clustering_annotation, verbose);
 
-  /* Route spines one by one */
+  /* Build the pin mapping of each tree, and collect the pins to be routed */
+  vtr::vector<ClockTreeId, std::map<ClockTreePinId, ClusterNetId>>
+    tree2clk_pin_maps(clk_ntwk.num_trees());
+  std::vector<t_clock_tree_pin_job> jobs;
   for (auto itree : clk_ntwk.trees()) {
     VTR_LOGV(verbose,
              "Build global net name to clock tree '%s' pin mapping...\n",
              clk_ntwk.tree_name(itree).c_str());
-    std::map<ClockTreePinId, ClusterNetId> tree2clk_pin_map;
-    int status = CMD_EXEC_SUCCESS;
-    status =
+    std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map =
+      tree2clk_pin_maps[itree];
+    int status =
       build_clock_tree_net_map(tree2clk_pin_map, cluster_nlist, pin_constraints,
                                gnets, clk_ntwk, itree, verbose);
     if (status == CMD_EXEC_FATAL_ERROR) {
       return status;
     }
 
-    VTR_LOGV(verbose, "Routing clock tree '%s'...\n",
-             clk_ntwk.tree_name(itree).c_str());
-    status = route_clock_tree_rr_graph(
-      vpr_routing_annotation, vpr_device_ctx.rr_graph, clk_rr_lookup,
-      rr_node_gnets, tree2clk_pin_map, clk_ntwk, itree, disable_unused_trees,
-      disable_unused_spines, verbose);
-    if (status == CMD_EXEC_FATAL_ERROR) {
-      return status;
+    for (auto ipin : clk_ntwk.pins(itree)) {
+      /* Do not route unused clock spines */
+      if (disable_unused_trees &&
+          tree2clk_pin_map.find(ipin) == tree2clk_pin_map.end()) {
+        VTR_LOGV(verbose, "Skip routing unused tree '%s' pin '%lu'...\n",
+                 clk_ntwk.tree_name(itree).c_str(), size_t(ipin));
+        continue;
+      }
+      t_clock_tree_pin_job job;
+      job.tree = itree;
+      job.pin = ipin;
+      jobs.push_back(job);
     }
-    VTR_LOGV(verbose, "Done\n");
+  }
+
+  size_t num_workers = find_num_workers(num_threads, jobs.size());
+  VTR_LOG("Route %lu pins of %lu clock trees with %lu threads\n", jobs.size(),
+          clk_ntwk.num_trees(), num_workers);
+
+  /* Route the pins. Each pin records its start and finish time */
+  run_parallel_jobs(
+    jobs.size(), num_workers, [&](const size_t& ijob, const size_t&) {
+      t_clock_tree_pin_job& job = jobs[ijob];
+      job.start = std::chrono::steady_clock::now();
+      job.status = route_clock_tree_pin_rr_graph(
+        job.routing_record, vpr_device_ctx.rr_graph, clk_rr_lookup,
+        rr_node_gnets, tree2clk_pin_maps[job.tree], clk_ntwk, job.tree,
+        job.pin, disable_unused_spines, verbose);
+      job.finish = std::chrono::steady_clock::now();
+    });
+
+  /* Commit the routing results in the order of trees and pins, and report
+   * the wall time of each tree, i.e., from the start of its first pin to the
+   * finish of its last pin */
+  vtr::vector<ClockTreeId, size_t> tree_num_pins(clk_ntwk.num_trees(), 0);
+  vtr::vector<ClockTreeId, std::chrono::steady_clock::time_point> tree_starts(
+    clk_ntwk.num_trees());
+  vtr::vector<ClockTreeId, std::chrono::steady_clock::time_point>
+    tree_finishes(clk_ntwk.num_trees());
+  for (const t_clock_tree_pin_job& job : jobs) {
+    if (CMD_EXEC_SUCCESS != job.status) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    job.routing_record.commit(vpr_routing_annotation, vpr_device_ctx.rr_graph);
+    if (0 == tree_num_pins[job.tree]) {
+      tree_starts[job.tree] = job.start;
+      tree_finishes[job.tree] = job.finish;
+    }
+    tree_starts[job.tree] = std::min(tree_starts[job.tree], job.start);
+    tree_finishes[job.tree] = std::max(tree_finishes[job.tree], job.finish);
+    tree_num_pins[job.tree]++;
+  }
+  for (auto itree : clk_ntwk.trees()) {
+    std::chrono::duration<float> runtime =
+      tree_finishes[itree] - tree_starts[itree];
+    VTR_LOG("Routed %lu pins of clock tree '%s' took %g seconds\n",
+            tree_num_pins[itree], clk_ntwk.tree_name(itree).c_str(),
+            runtime.count());
   }
 
   /* TODO: Sanity checks */
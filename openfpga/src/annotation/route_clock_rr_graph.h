@@ -25,7 +25,8 @@ int route_clock_rr_graph(
   const PlacementContext& vpr_place_ctx,
   const RRClockSpatialLookup& clk_rr_lookup, const ClockNetwork& clk_ntwk,
   const PinConstraints& pin_constraints, const bool& disable_unused_trees,
-  const bool& disable_unused_spines, const bool& verbose);
+  const bool& disable_unused_spines, const size_t& num_threads,
+  const bool& verbose);
 
 } /* end namespace openfpga */
 
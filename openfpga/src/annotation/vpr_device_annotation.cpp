@@ -4,6 +4,7 @@
 #include "vpr_device_annotation.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -11,6 +12,23 @@
 /* namespace openfpga begins */
 namespace openfpga {
 
+/* Dense index of an object which is not annotated */
+constexpr size_t INVALID_ANNOTATION_INDEX = std::numeric_limits<size_t>::max();
+
+/************************************************************************
+ * Find the dense index of an object in a look-up.
+ * Return an invalid index if the object is not annotated
+ ***********************************************************************/
+template <class T>
+static size_t find_annotation_index(
+  const std::unordered_map<T, size_t>& indices, const T& object) {
+  auto result = indices.find(object);
+  if (result == indices.end()) {
+    return INVALID_ANNOTATION_INDEX;
+  }
+  return result->second;
+}
+
 /************************************************************************
  * Constructors
  ***********************************************************************/
@@ -21,156 +39,124 @@ VprDeviceAnnotation::VprDeviceAnnotation() { return; }
  ***********************************************************************/
 bool VprDeviceAnnotation::is_physical_pb_type(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(pb_type);
-  if (it == physical_pb_types_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     return false;
   }
   /* A physical pb_type should be mapped to itself! Otherwise, it is an
    * operating pb_type */
-  return pb_type == physical_pb_types_.at(pb_type);
+  return pb_type == physical_pb_types_[index];
 }
 
 t_mode* VprDeviceAnnotation::physical_mode(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_mode*>::const_iterator it =
-    physical_pb_modes_.find(pb_type);
-  if (it == physical_pb_modes_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     return nullptr;
   }
-  return physical_pb_modes_.at(pb_type);
+  return physical_pb_modes_[index];
 }
 
 t_pb_type* VprDeviceAnnotation::physical_pb_type(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(pb_type);
-  if (it == physical_pb_types_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     return nullptr;
   }
-  return physical_pb_types_.at(pb_type);
+  return physical_pb_types_[index];
 }
 
 std::vector<t_port*> VprDeviceAnnotation::physical_pb_port(
   t_port* pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::vector<t_port*>>::const_iterator it =
-    physical_pb_ports_.find(pb_port);
-  if (it == physical_pb_ports_.end()) {
+  /* Ensure that the pb_port is in the list */
+  size_t index = find_annotation_index(pb_port_indices_, pb_port);
+  if (INVALID_ANNOTATION_INDEX == index) {
     return std::vector<t_port*>();
   }
-  return physical_pb_ports_.at(pb_port);
+  return physical_pb_ports_[index];
 }
 
 BasicPort VprDeviceAnnotation::physical_pb_port_range(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, BasicPort>>::const_iterator it =
-    physical_pb_port_ranges_.find(operating_pb_port);
-  if (it == physical_pb_port_ranges_.end()) {
+  const t_physical_pb_port_annotation* port_annotation =
+    find_physical_pb_port_annotation(operating_pb_port, physical_pb_port);
+  if (nullptr == port_annotation) {
     /* Return an invalid port. As such the port width will be 0, which is an
      * invalid value */
     return BasicPort();
   }
-  if (0 ==
-      physical_pb_port_ranges_.at(operating_pb_port).count(physical_pb_port)) {
-    /* Return an invalid port. As such the port width will be 0, which is an
-     * invalid value */
-    return BasicPort();
-  }
-  return physical_pb_port_ranges_.at(operating_pb_port).at(physical_pb_port);
+  return port_annotation->port_range;
 }
 
 CircuitModelId VprDeviceAnnotation::pb_type_circuit_model(
   t_pb_type* physical_pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, CircuitModelId>::const_iterator it =
-    pb_type_circuit_models_.find(physical_pb_type);
-  if (it == pb_type_circuit_models_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, physical_pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Return an invalid circuit model id */
     return CircuitModelId::INVALID();
   }
-  return pb_type_circuit_models_.at(physical_pb_type);
+  return pb_type_circuit_models_[index];
 }
 
 CircuitModelId VprDeviceAnnotation::interconnect_circuit_model(
   t_interconnect* pb_interconnect) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_interconnect*, CircuitModelId>::const_iterator it =
-    interconnect_circuit_models_.find(pb_interconnect);
-  if (it == interconnect_circuit_models_.end()) {
+  /* Ensure that the interconnect is in the list */
+  size_t index = find_annotation_index(interconnect_indices_, pb_interconnect);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Return an invalid circuit model id */
     return CircuitModelId::INVALID();
   }
-  return interconnect_circuit_models_.at(pb_interconnect);
+  return interconnect_circuit_models_[index];
 }
 
 e_interconnect VprDeviceAnnotation::interconnect_physical_type(
   t_interconnect* pb_interconnect) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_interconnect*, e_interconnect>::const_iterator it =
-    interconnect_physical_types_.find(pb_interconnect);
-  if (it == interconnect_physical_types_.end()) {
+  /* Ensure that the interconnect is in the list */
+  size_t index = find_annotation_index(interconnect_indices_, pb_interconnect);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Return an invalid interconnect type */
     return NUM_INTERC_TYPES;
   }
-  return interconnect_physical_types_.at(pb_interconnect);
+  return interconnect_physical_types_[index];
 }
 
 CircuitPortId VprDeviceAnnotation::pb_circuit_port(t_port* pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, CircuitPortId>::const_iterator it =
-    pb_circuit_ports_.find(pb_port);
-  if (it == pb_circuit_ports_.end()) {
+  /* Ensure that the pb_port is in the list */
+  size_t index = find_annotation_index(pb_port_indices_, pb_port);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Return an invalid circuit port id */
     return CircuitPortId::INVALID();
   }
-  return pb_circuit_ports_.at(pb_port);
+  return pb_circuit_ports_[index];
 }
 
 std::vector<size_t> VprDeviceAnnotation::pb_type_mode_bits(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<size_t>>::const_iterator it =
-    pb_type_mode_bits_.find(pb_type);
-  if (it == pb_type_mode_bits_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Return an empty vector */
     return std::vector<size_t>();
   }
-  return pb_type_mode_bits_.at(pb_type);
+  return pb_type_mode_bits_[index];
 }
 
 PbGraphNodeId VprDeviceAnnotation::pb_graph_node_unique_index(
   t_pb_graph_node* pb_graph_node) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>::const_iterator it =
-    pb_graph_node_unique_index_.find(pb_graph_node->pb_type);
-  if (it == pb_graph_node_unique_index_.end()) {
-    /* Invalid pb_type, return a null pointer */
-    return PbGraphNodeId::INVALID();
-  }
-
-  /* Try to find the pb_graph_node in the vector */
-  std::vector<t_pb_graph_node*>::const_iterator it_node =
-    std::find(pb_graph_node_unique_index_.at(pb_graph_node->pb_type).begin(),
-              pb_graph_node_unique_index_.at(pb_graph_node->pb_type).end(),
-              pb_graph_node);
-  /* If it exists, return the index
-   * Otherwise, return an invalid id
-   */
-  if (it_node == pb_graph_node_unique_index_.at(pb_graph_node->pb_type).end()) {
+  /* Ensure that the pb_graph_node is in the list */
+  size_t index = find_annotation_index(pb_graph_node_indices_, pb_graph_node);
+  if (INVALID_ANNOTATION_INDEX == index) {
     return PbGraphNodeId::INVALID();
   }
-  return PbGraphNodeId(
-    it_node - pb_graph_node_unique_index_.at(pb_graph_node->pb_type).begin());
+  return pb_graph_node_unique_indices_[index];
 }
 
 t_pb_graph_node* VprDeviceAnnotation::pb_graph_node(
   t_pb_type* pb_type, const PbGraphNodeId& unique_index) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>::const_iterator it =
-    pb_graph_node_unique_index_.find(pb_type);
-  if (it == pb_graph_node_unique_index_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Invalid pb_type, return a null pointer */
     return nullptr;
   }
@@ -178,272 +164,196 @@ t_pb_graph_node* VprDeviceAnnotation::pb_graph_node(
    *  - Out of range: return a null pointer
    *  - In range: return the pointer
    */
-  if ((size_t)unique_index >
-      pb_graph_node_unique_index_.at(pb_type).size() - 1) {
+  if (size_t(unique_index) >= pb_graph_node_unique_index_[index].size()) {
     return nullptr;
   }
 
-  return pb_graph_node_unique_index_.at(pb_type)[size_t(unique_index)];
+  return pb_graph_node_unique_index_[index][size_t(unique_index)];
 }
 
 t_pb_graph_node* VprDeviceAnnotation::physical_pb_graph_node(
   t_pb_graph_node* pb_graph_node) const {
   /* Ensure that the pb_graph_node is in the list */
-  std::map<t_pb_graph_node*, t_pb_graph_node*>::const_iterator it =
-    physical_pb_graph_nodes_.find(pb_graph_node);
-  if (it == physical_pb_graph_nodes_.end()) {
+  size_t index = find_annotation_index(pb_graph_node_indices_, pb_graph_node);
+  if (INVALID_ANNOTATION_INDEX == index) {
     return nullptr;
   }
-  return physical_pb_graph_nodes_.at(pb_graph_node);
+  return physical_pb_graph_nodes_[index];
 }
 
 float VprDeviceAnnotation::physical_pb_type_index_factor(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, float>::const_iterator it =
-    physical_pb_type_index_factors_.find(pb_type);
-  if (it == physical_pb_type_index_factors_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Default value is 1 */
     return 1.;
   }
-  return physical_pb_type_index_factors_.at(pb_type);
+  return physical_pb_type_index_factors_[index];
 }
 
 int VprDeviceAnnotation::physical_pb_type_index_offset(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, int>::const_iterator it =
-    physical_pb_type_index_offsets_.find(pb_type);
-  if (it == physical_pb_type_index_offsets_.end()) {
+  size_t index = find_annotation_index(pb_type_indices_, pb_type);
+  if (INVALID_ANNOTATION_INDEX == index) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_type_index_offsets_.at(pb_type);
+  return physical_pb_type_index_offsets_[index];
 }
 
 int VprDeviceAnnotation::physical_pb_pin_initial_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_initial_offsets_.find(operating_pb_port);
-  if (it == physical_pb_pin_initial_offsets_.end()) {
-    /* Default value is 0 */
-    return 0;
-  }
-  if (0 == physical_pb_pin_initial_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
+  const t_physical_pb_port_annotation* port_annotation =
+    find_physical_pb_port_annotation(operating_pb_port, physical_pb_port);
+  if (nullptr == port_annotation) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_pin_initial_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return port_annotation->pin_initial_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_pin_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_rotate_offsets_.find(operating_pb_port);
-  if (it == physical_pb_pin_rotate_offsets_.end()) {
+  const t_physical_pb_port_annotation* port_annotation =
+    find_physical_pb_port_annotation(operating_pb_port, physical_pb_port);
+  if (nullptr == port_annotation) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 == physical_pb_pin_rotate_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
-    /* Default value is 0 */
-    return 0;
-  }
-  return physical_pb_pin_rotate_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return port_annotation->pin_rotate_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_rotate_offsets_.find(operating_pb_port);
-  if (it == physical_pb_port_rotate_offsets_.end()) {
-    /* Default value is 0 */
-    return 0;
-  }
-  if (0 == physical_pb_port_rotate_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
+  const t_physical_pb_port_annotation* port_annotation =
+    find_physical_pb_port_annotation(operating_pb_port, physical_pb_port);
+  if (nullptr == port_annotation) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_port_rotate_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return port_annotation->port_rotate_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_pin_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_offsets_.find(operating_pb_port);
-  if (it == physical_pb_pin_offsets_.end()) {
-    /* Default value is 0 */
-    return 0;
-  }
-  if (0 ==
-      physical_pb_pin_offsets_.at(operating_pb_port).count(physical_pb_port)) {
+  const t_physical_pb_port_annotation* port_annotation =
+    find_physical_pb_port_annotation(operating_pb_port, physical_pb_port);
+  if (nullptr == port_annotation) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_pin_offsets_.at(operating_pb_port).at(physical_pb_port);
+  return port_annotation->pin_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_port_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_offsets_.find(operating_pb_port);
-  if (it == physical_pb_port_offsets_.end()) {
-    /* Default value is 0 */
-    return 0;
-  }
-  if (0 ==
-      physical_pb_port_offsets_.at(operating_pb_port).count(physical_pb_port)) {
+  const t_physical_pb_port_annotation* port_annotation =
+    find_physical_pb_port_annotation(operating_pb_port, physical_pb_port);
+  if (nullptr == port_annotation) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_port_offsets_.at(operating_pb_port).at(physical_pb_port);
+  return port_annotation->port_offset;
 }
 
 t_pb_graph_pin* VprDeviceAnnotation::physical_pb_graph_pin(
   const t_pb_graph_pin* pb_graph_pin) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*>::const_iterator it =
-    physical_pb_graph_pins_.find(pb_graph_pin);
-  if (it == physical_pb_graph_pins_.end()) {
+  /* Ensure that the pb_graph_pin is in the list */
+  size_t index = find_annotation_index(pb_graph_pin_indices_, pb_graph_pin);
+  if (INVALID_ANNOTATION_INDEX == index) {
     return nullptr;
   }
-  return physical_pb_graph_pins_.at(pb_graph_pin);
+  return physical_pb_graph_pins_[index];
 }
 
 CircuitModelId VprDeviceAnnotation::rr_switch_circuit_model(
   const RRSwitchId& rr_switch) const {
   /* Ensure that the rr_switch is in the list */
-  std::map<RRSwitchId, CircuitModelId>::const_iterator it =
-    rr_switch_circuit_models_.find(rr_switch);
-  if (it == rr_switch_circuit_models_.end()) {
+  if (size_t(rr_switch) >= rr_switch_circuit_models_.size()) {
     return CircuitModelId::INVALID();
   }
-  return rr_switch_circuit_models_.at(rr_switch);
+  return rr_switch_circuit_models_[rr_switch];
 }
 
 CircuitModelId VprDeviceAnnotation::rr_segment_circuit_model(
   const RRSegmentId& rr_segment) const {
-  /* Ensure that the rr_switch is in the list */
-  std::map<RRSegmentId, CircuitModelId>::const_iterator it =
-    rr_segment_circuit_models_.find(rr_segment);
-  if (it == rr_segment_circuit_models_.end()) {
+  /* Ensure that the rr_segment is in the list */
+  if (size_t(rr_segment) >= rr_segment_circuit_models_.size()) {
     return CircuitModelId::INVALID();
   }
-  return rr_segment_circuit_models_.at(rr_segment);
+  return rr_segment_circuit_models_[rr_segment];
 }
 
 ArchDirectId VprDeviceAnnotation::direct_annotation(
   const size_t& direct) const {
-  /* Ensure that the rr_switch is in the list */
-  if (0 == direct_annotations_.count(direct)) {
+  /* Ensure that the direct is in the list */
+  if (direct >= direct_annotations_.size()) {
     return ArchDirectId::INVALID();
   }
-  return direct_annotations_.at(direct);
+  return direct_annotations_[direct];
 }
 
-LbRRGraph VprDeviceAnnotation::physical_lb_rr_graph(
+const LbRRGraph& VprDeviceAnnotation::physical_lb_rr_graph(
   t_pb_graph_node* pb_graph_head) const {
-  /* Ensure that the rr_switch is in the list */
-  if (0 == physical_lb_rr_graphs_.count(pb_graph_head)) {
-    return LbRRGraph();
+  /* An empty graph is returned when not found */
+  static const LbRRGraph empty_lb_rr_graph;
+  auto result = physical_lb_rr_graphs_.find(pb_graph_head);
+  if (result == physical_lb_rr_graphs_.end()) {
+    return empty_lb_rr_graph;
   }
-  return physical_lb_rr_graphs_.at(pb_graph_head);
+  return result->second;
 }
 
 BasicPort VprDeviceAnnotation::physical_tile_pin_port_info(
   t_physical_tile_type_ptr physical_tile, const int& pin_index) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_pin2port_info_map_.find(physical_tile);
-  if (physical_tile_search_result == physical_tile_pin2port_info_map_.end()) {
+  size_t index = find_annotation_index(physical_tile_indices_, physical_tile);
+  if ((INVALID_ANNOTATION_INDEX == index) || (0 > pin_index) ||
+      (size_t(pin_index) >= physical_tile_pin2port_info_map_[index].size())) {
     /* Not found. Return an invalid port */
     return BasicPort();
   }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(pin_index);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
-    /* Not found. Return an invalid port */
-    return BasicPort();
-  }
-
-  /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_pin2port_info_map_[index][pin_index];
 }
 
 int VprDeviceAnnotation::physical_tile_pin_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& pin_index) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_pin_subtile_indices_.find(physical_tile);
-  if (physical_tile_search_result == physical_tile_pin_subtile_indices_.end()) {
+  size_t index = find_annotation_index(physical_tile_indices_, physical_tile);
+  if ((INVALID_ANNOTATION_INDEX == index) || (0 > pin_index) ||
+      (size_t(pin_index) >= physical_tile_pin_subtile_indices_[index].size())) {
     /* Not found. Return an invalid index */
     return -1;
   }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(pin_index);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
-    /* Not found. Return an invalid index */
-    return -1;
-  }
-
-  /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_pin_subtile_indices_[index][pin_index];
 }
 
 int VprDeviceAnnotation::physical_tile_z_to_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& sub_tile_z) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_z_to_subtile_indices_.find(physical_tile);
-  if (physical_tile_search_result ==
-      physical_tile_z_to_subtile_indices_.end()) {
-    /* Not found. Return an invalid index */
-    return -1;
-  }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(sub_tile_z);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
+  size_t index = find_annotation_index(physical_tile_indices_, physical_tile);
+  if ((INVALID_ANNOTATION_INDEX == index) || (0 > sub_tile_z) ||
+      (size_t(sub_tile_z) >=
+       physical_tile_z_to_subtile_indices_[index].size())) {
     /* Not found. Return an invalid index */
     return -1;
   }
-
-  /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_z_to_subtile_indices_[index][sub_tile_z];
 }
 
 int VprDeviceAnnotation::physical_tile_z_to_start_pin_index(
   t_physical_tile_type_ptr physical_tile, const int& sub_tile_z) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_z_to_start_pin_indices_.find(physical_tile);
-  if (physical_tile_search_result ==
-      physical_tile_z_to_start_pin_indices_.end()) {
-    /* Not found. Return an invalid index */
-    return -1;
-  }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(sub_tile_z);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
+  size_t index = find_annotation_index(physical_tile_indices_, physical_tile);
+  if ((INVALID_ANNOTATION_INDEX == index) || (0 > sub_tile_z) ||
+      (size_t(sub_tile_z) >=
+       physical_tile_z_to_start_pin_indices_[index].size())) {
     /* Not found. Return an invalid index */
     return -1;
   }
-
-  /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_z_to_start_pin_indices_[index][sub_tile_z];
 }
 
 /************************************************************************
@@ -451,37 +361,36 @@ int VprDeviceAnnotation::physical_tile_z_to_start_pin_index(
  ***********************************************************************/
 void VprDeviceAnnotation::add_pb_type_physical_mode(t_pb_type* pb_type,
                                                     t_mode* physical_mode) {
+  size_t index = find_or_add_pb_type_index(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, t_mode*>::const_iterator it =
-    physical_pb_modes_.find(pb_type);
-  if (it != physical_pb_modes_.end()) {
+  if (nullptr != physical_pb_modes_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between pb_type '%s' and it physical mode "
       "'%s'!\n",
       pb_type->name, physical_mode->name);
   }
 
-  physical_pb_modes_[pb_type] = physical_mode;
+  physical_pb_modes_[index] = physical_mode;
 }
 
 void VprDeviceAnnotation::add_physical_pb_type(t_pb_type* operating_pb_type,
                                                t_pb_type* physical_pb_type) {
+  size_t index = find_or_add_pb_type_index(operating_pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(operating_pb_type);
-  if (it != physical_pb_types_.end()) {
+  if (nullptr != physical_pb_types_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
       "pb_type '%s'!\n",
       operating_pb_type->name, physical_pb_type->name);
   }
 
-  physical_pb_types_[operating_pb_type] = physical_pb_type;
+  physical_pb_types_[index] = physical_pb_type;
 }
 
 void VprDeviceAnnotation::add_physical_pb_port(t_port* operating_pb_port,
                                                t_port* physical_pb_port) {
-  physical_pb_ports_[operating_pb_port].push_back(physical_pb_port);
+  size_t index = find_or_add_pb_port_index(operating_pb_port);
+  physical_pb_ports_[index].push_back(physical_pb_port);
 }
 
 void VprDeviceAnnotation::add_physical_pb_port_range(
@@ -490,12 +399,11 @@ void VprDeviceAnnotation::add_physical_pb_port_range(
   /* The port range must satify the port width*/
   VTR_ASSERT((size_t)operating_pb_port->num_pins >= port_range.get_width());
 
+  t_physical_pb_port_annotation& port_annotation =
+    find_or_add_physical_pb_port_annotation(operating_pb_port,
+                                            physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, BasicPort>>::const_iterator it =
-    physical_pb_port_ranges_.find(operating_pb_port);
-  if ((it != physical_pb_port_ranges_.end()) &&
-      (0 <
-       physical_pb_port_ranges_[operating_pb_port].count(physical_pb_port))) {
+  if (0 < port_annotation.port_range.get_width()) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
       "pb_port range '%s[%ld:%ld]'!\n",
@@ -503,86 +411,88 @@ void VprDeviceAnnotation::add_physical_pb_port_range(
       port_range.get_msb());
   }
 
-  physical_pb_port_ranges_[operating_pb_port][physical_pb_port] = port_range;
+  port_annotation.port_range = port_range;
 }
 
 void VprDeviceAnnotation::add_pb_type_circuit_model(
   t_pb_type* physical_pb_type, const CircuitModelId& circuit_model) {
+  size_t index = find_or_add_pb_type_index(physical_pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, CircuitModelId>::const_iterator it =
-    pb_type_circuit_models_.find(physical_pb_type);
-  if (it != pb_type_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != pb_type_circuit_models_[index]) {
     VTR_LOG_WARN("Override the circuit model for physical pb_type '%s'!\n",
                  physical_pb_type->name);
   }
 
-  pb_type_circuit_models_[physical_pb_type] = circuit_model;
+  pb_type_circuit_models_[index] = circuit_model;
 }
 
 void VprDeviceAnnotation::add_interconnect_circuit_model(
   t_interconnect* pb_interconnect, const CircuitModelId& circuit_model) {
+  size_t index = find_or_add_interconnect_index(pb_interconnect);
   /* Warn any override attempt */
-  std::map<t_interconnect*, CircuitModelId>::const_iterator it =
-    interconnect_circuit_models_.find(pb_interconnect);
-  if (it != interconnect_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != interconnect_circuit_models_[index]) {
     VTR_LOG_WARN("Override the circuit model for interconnect '%s'!\n",
                  pb_interconnect->name);
   }
 
-  interconnect_circuit_models_[pb_interconnect] = circuit_model;
+  interconnect_circuit_models_[index] = circuit_model;
 }
 
 void VprDeviceAnnotation::add_interconnect_physical_type(
   t_interconnect* pb_interconnect, const e_interconnect& physical_type) {
+  size_t index = find_or_add_interconnect_index(pb_interconnect);
   /* Warn any override attempt */
-  std::map<t_interconnect*, e_interconnect>::const_iterator it =
-    interconnect_physical_types_.find(pb_interconnect);
-  if (it != interconnect_physical_types_.end()) {
+  if (NUM_INTERC_TYPES != interconnect_physical_types_[index]) {
     VTR_LOG_WARN("Override the physical interconnect for interconnect '%s'!\n",
                  pb_interconnect->name);
   }
 
-  interconnect_physical_types_[pb_interconnect] = physical_type;
+  interconnect_physical_types_[index] = physical_type;
 }
 
 void VprDeviceAnnotation::add_pb_circuit_port(
   t_port* pb_port, const CircuitPortId& circuit_port) {
+  size_t index = find_or_add_pb_port_index(pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, CircuitPortId>::const_iterator it =
-    pb_circuit_ports_.find(pb_port);
-  if (it != pb_circuit_ports_.end()) {
+  if (CircuitPortId::INVALID() != pb_circuit_ports_[index]) {
     VTR_LOG_WARN("Override the circuit port mapping for pb_type port '%s'!\n",
                  pb_port->name);
   }
 
-  pb_circuit_ports_[pb_port] = circuit_port;
+  pb_circuit_ports_[index] = circuit_port;
 }
 
 void VprDeviceAnnotation::add_pb_type_mode_bits(
   t_pb_type* pb_type, const std::vector<size_t>& mode_bits) {
+  size_t index = find_or_add_pb_type_index(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, std::vector<size_t>>::const_iterator it =
-    pb_type_mode_bits_.find(pb_type);
-  if (it != pb_type_mode_bits_.end()) {
+  if (false == pb_type_mode_bits_[index].empty()) {
     VTR_LOG_WARN("Override the mode bits mapping for pb_type '%s'!\n",
                  pb_type->name);
   }
 
-  pb_type_mode_bits_[pb_type] = mode_bits;
+  pb_type_mode_bits_[index] = mode_bits;
 }
 
 void VprDeviceAnnotation::add_pb_graph_node_unique_index(
   t_pb_graph_node* pb_graph_node) {
-  pb_graph_node_unique_index_[pb_graph_node->pb_type].push_back(pb_graph_node);
+  size_t pb_type_index = find_or_add_pb_type_index(pb_graph_node->pb_type);
+  size_t index = find_or_add_pb_graph_node_index(pb_graph_node);
+  /* The unique index is the position in the array of its pb_type. A node
+   * added more than once keeps its first index */
+  if (PbGraphNodeId::INVALID() == pb_graph_node_unique_indices_[index]) {
+    pb_graph_node_unique_indices_[index] =
+      PbGraphNodeId(pb_graph_node_unique_index_[pb_type_index].size());
+  }
+  pb_graph_node_unique_index_[pb_type_index].push_back(pb_graph_node);
 }
 
 void VprDeviceAnnotation::add_physical_pb_graph_node(
   t_pb_graph_node* operating_pb_graph_node,
   t_pb_graph_node* physical_pb_graph_node) {
+  size_t index = find_or_add_pb_graph_node_index(operating_pb_graph_node);
   /* Warn any override attempt */
-  std::map<t_pb_graph_node*, t_pb_graph_node*>::const_iterator it =
-    physical_pb_graph_nodes_.find(operating_pb_graph_node);
-  if (it != physical_pb_graph_nodes_.end()) {
+  if (nullptr != physical_pb_graph_nodes_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_graph_node '%s[%d]' and it "
       "physical pb_graph_node '%s[%d]'!\n",
@@ -592,116 +502,110 @@ void VprDeviceAnnotation::add_physical_pb_graph_node(
       physical_pb_graph_node->placement_index);
   }
 
-  physical_pb_graph_nodes_[operating_pb_graph_node] = physical_pb_graph_node;
+  physical_pb_graph_nodes_[index] = physical_pb_graph_node;
 }
 
 void VprDeviceAnnotation::add_physical_pb_type_index_factor(
   t_pb_type* pb_type, const float& factor) {
+  size_t index = find_or_add_pb_type_index(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, float>::const_iterator it =
-    physical_pb_type_index_factors_.find(pb_type);
-  if (it != physical_pb_type_index_factors_.end()) {
+  if (1. != physical_pb_type_index_factors_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
       "pb_type index factor '%f'!\n",
       pb_type->name, factor);
   }
 
-  physical_pb_type_index_factors_[pb_type] = factor;
+  physical_pb_type_index_factors_[index] = factor;
 }
 
 void VprDeviceAnnotation::add_physical_pb_type_index_offset(t_pb_type* pb_type,
                                                             const int& offset) {
+  size_t index = find_or_add_pb_type_index(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, int>::const_iterator it =
-    physical_pb_type_index_offsets_.find(pb_type);
-  if (it != physical_pb_type_index_offsets_.end()) {
+  if (0 != physical_pb_type_index_offsets_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
       "pb_type index offset '%d'!\n",
       pb_type->name, offset);
   }
 
-  physical_pb_type_index_offsets_[pb_type] = offset;
+  physical_pb_type_index_offsets_[index] = offset;
 }
 
 void VprDeviceAnnotation::add_physical_pb_pin_initial_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
+  t_physical_pb_port_annotation& port_annotation =
+    find_or_add_physical_pb_port_annotation(operating_pb_port,
+                                            physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_initial_offsets_.find(operating_pb_port);
-  if ((it != physical_pb_pin_initial_offsets_.end()) &&
-      (0 < physical_pb_pin_initial_offsets_[operating_pb_port].count(
-             physical_pb_port))) {
+  if (0 != port_annotation.pin_initial_offset) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
-      "pb_port '%s' pin rotate offset '%d'!\n",
-      operating_pb_port->name, offset);
+      "pb_port '%s' pin initial offset '%d'!\n",
+      operating_pb_port->name, physical_pb_port->name, offset);
   }
 
-  physical_pb_pin_initial_offsets_[operating_pb_port][physical_pb_port] =
-    offset;
+  port_annotation.pin_initial_offset = offset;
 }
 
 void VprDeviceAnnotation::add_physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
+  t_physical_pb_port_annotation& port_annotation =
+    find_or_add_physical_pb_port_annotation(operating_pb_port,
+                                            physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_rotate_offsets_.find(operating_pb_port);
-  if ((it != physical_pb_port_rotate_offsets_.end()) &&
-      (0 < physical_pb_port_rotate_offsets_[operating_pb_port].count(
-             physical_pb_port))) {
+  if (0 != port_annotation.port_rotate_offset) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
       "pb_port '%s' port rotate offset '%d'!\n",
-      operating_pb_port->name, offset);
+      operating_pb_port->name, physical_pb_port->name, offset);
   }
 
-  physical_pb_port_rotate_offsets_[operating_pb_port][physical_pb_port] =
-    offset;
+  port_annotation.port_rotate_offset = offset;
   /* We initialize the accumulated offset to 0 */
-  physical_pb_port_offsets_[operating_pb_port][physical_pb_port] = 0;
+  port_annotation.port_offset = 0;
 }
 
 void VprDeviceAnnotation::accumulate_physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) {
-  physical_pb_port_offsets_[operating_pb_port][physical_pb_port] +=
-    physical_pb_port_rotate_offsets_[operating_pb_port][physical_pb_port];
+  t_physical_pb_port_annotation& port_annotation =
+    find_or_add_physical_pb_port_annotation(operating_pb_port,
+                                            physical_pb_port);
+  port_annotation.port_offset += port_annotation.port_rotate_offset;
 }
 
 void VprDeviceAnnotation::add_physical_pb_pin_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
+  t_physical_pb_port_annotation& port_annotation =
+    find_or_add_physical_pb_port_annotation(operating_pb_port,
+                                            physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_rotate_offsets_.find(operating_pb_port);
-  if ((it != physical_pb_pin_rotate_offsets_.end()) &&
-      (0 < physical_pb_pin_rotate_offsets_[operating_pb_port].count(
-             physical_pb_port))) {
+  if (0 != port_annotation.pin_rotate_offset) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
       "pb_port '%s' pin rotate offset '%d'!\n",
-      operating_pb_port->name, offset);
+      operating_pb_port->name, physical_pb_port->name, offset);
   }
 
-  physical_pb_pin_rotate_offsets_[operating_pb_port][physical_pb_port] = offset;
+  port_annotation.pin_rotate_offset = offset;
   /* We initialize the accumulated offset to 0 */
-  physical_pb_pin_offsets_[operating_pb_port][physical_pb_port] = 0;
+  port_annotation.pin_offset = 0;
 }
 
 void VprDeviceAnnotation::add_physical_pb_graph_pin(
   const t_pb_graph_pin* operating_pb_graph_pin,
   t_pb_graph_pin* physical_pb_graph_pin) {
+  size_t index = find_or_add_pb_graph_pin_index(operating_pb_graph_pin);
   /* Warn any override attempt */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*>::const_iterator it =
-    physical_pb_graph_pins_.find(operating_pb_graph_pin);
-  if (it != physical_pb_graph_pins_.end()) {
+  if (nullptr != physical_pb_graph_pins_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_graph_pin '%s' and it "
       "physical pb_graph_pin '%s'!\n",
       operating_pb_graph_pin->port->name, physical_pb_graph_pin->port->name);
   }
 
-  physical_pb_graph_pins_[operating_pb_graph_pin] = physical_pb_graph_pin;
+  physical_pb_graph_pins_[index] = physical_pb_graph_pin;
 
   /* Update the accumulated offsets for the operating port
    * Each time we pair two pins, we update the offset by the pin rotate offset
@@ -718,29 +622,27 @@ void VprDeviceAnnotation::add_physical_pb_graph_pin(
     return;
   }
 
-  physical_pb_pin_offsets_[operating_pb_graph_pin->port]
-                          [physical_pb_graph_pin->port] +=
-    physical_pb_pin_rotate_offset(operating_pb_graph_pin->port,
-                                  physical_pb_graph_pin->port);
+  t_physical_pb_port_annotation& port_annotation =
+    find_or_add_physical_pb_port_annotation(operating_pb_graph_pin->port,
+                                            physical_pb_graph_pin->port);
+  port_annotation.pin_offset += port_annotation.pin_rotate_offset;
 
   if ((size_t)physical_pb_graph_pin->port->num_pins - 1 <
       operating_pb_graph_pin->pin_number +
-        physical_pb_port_range(operating_pb_graph_pin->port,
-                               physical_pb_graph_pin->port)
-          .get_lsb() +
-        physical_pb_pin_offsets_[operating_pb_graph_pin->port]
-                                [physical_pb_graph_pin->port]) {
-    physical_pb_pin_offsets_[operating_pb_graph_pin->port]
-                            [physical_pb_graph_pin->port] = 0;
+        port_annotation.port_range.get_lsb() + port_annotation.pin_offset) {
+    port_annotation.pin_offset = 0;
   }
 }
 
 void VprDeviceAnnotation::add_rr_switch_circuit_model(
   const RRSwitchId& rr_switch, const CircuitModelId& circuit_model) {
+  VTR_ASSERT(true == rr_switch.is_valid());
+  if (size_t(rr_switch) >= rr_switch_circuit_models_.size()) {
+    rr_switch_circuit_models_.resize(size_t(rr_switch) + 1,
+                                     CircuitModelId::INVALID());
+  }
   /* Warn any override attempt */
-  std::map<RRSwitchId, CircuitModelId>::const_iterator it =
-    rr_switch_circuit_models_.find(rr_switch);
-  if (it != rr_switch_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != rr_switch_circuit_models_[rr_switch]) {
     VTR_LOG_WARN(
       "Override the annotation between rr_switch '%ld' and its circuit_model "
       "'%ld'!\n",
@@ -752,10 +654,13 @@ void VprDeviceAnnotation::add_rr_switch_circuit_model(
 
 void VprDeviceAnnotation::add_rr_segment_circuit_model(
   const RRSegmentId& rr_segment, const CircuitModelId& circuit_model) {
+  VTR_ASSERT(true == rr_segment.is_valid());
+  if (size_t(rr_segment) >= rr_segment_circuit_models_.size()) {
+    rr_segment_circuit_models_.resize(size_t(rr_segment) + 1,
+                                      CircuitModelId::INVALID());
+  }
   /* Warn any override attempt */
-  std::map<RRSegmentId, CircuitModelId>::const_iterator it =
-    rr_segment_circuit_models_.find(rr_segment);
-  if (it != rr_segment_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != rr_segment_circuit_models_[rr_segment]) {
     VTR_LOG_WARN(
       "Override the annotation between rr_segment '%ld' and its circuit_model "
       "'%ld'!\n",
@@ -767,8 +672,11 @@ void VprDeviceAnnotation::add_rr_segment_circuit_model(
 
 void VprDeviceAnnotation::add_direct_annotation(
   const size_t& direct, const ArchDirectId& arch_direct_id) {
+  if (direct >= direct_annotations_.size()) {
+    direct_annotations_.resize(direct + 1, ArchDirectId::INVALID());
+  }
   /* Warn any override attempt */
-  if (0 < direct_annotations_.count(direct)) {
+  if (ArchDirectId::INVALID() != direct_annotations_[direct]) {
     VTR_LOG_WARN(
       "Override the annotation between direct '%ld' and its annotation "
       "'%ld'!\n",
@@ -792,26 +700,155 @@ void VprDeviceAnnotation::add_physical_lb_rr_graph(
 void VprDeviceAnnotation::add_physical_tile_pin2port_info_pair(
   t_physical_tile_type_ptr physical_tile, const int& pin_index,
   const BasicPort& port) {
-  physical_tile_pin2port_info_map_[physical_tile][pin_index] = port;
+  VTR_ASSERT(0 <= pin_index);
+  size_t index = find_or_add_physical_tile_index(physical_tile);
+  if (size_t(pin_index) >= physical_tile_pin2port_info_map_[index].size()) {
+    physical_tile_pin2port_info_map_[index].resize(pin_index + 1);
+  }
+  physical_tile_pin2port_info_map_[index][pin_index] = port;
 }
 
 void VprDeviceAnnotation::add_physical_tile_pin_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& pin_index,
   const int& subtile_index) {
-  physical_tile_pin_subtile_indices_[physical_tile][pin_index] = subtile_index;
+  VTR_ASSERT(0 <= pin_index);
+  size_t index = find_or_add_physical_tile_index(physical_tile);
+  if (size_t(pin_index) >= physical_tile_pin_subtile_indices_[index].size()) {
+    physical_tile_pin_subtile_indices_[index].resize(pin_index + 1, -1);
+  }
+  physical_tile_pin_subtile_indices_[index][pin_index] = subtile_index;
 }
 
 void VprDeviceAnnotation::add_physical_tile_z_to_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& subtile_z,
   const int& subtile_index) {
-  physical_tile_z_to_subtile_indices_[physical_tile][subtile_z] = subtile_index;
+  VTR_ASSERT(0 <= subtile_z);
+  size_t index = find_or_add_physical_tile_index(physical_tile);
+  if (size_t(subtile_z) >= physical_tile_z_to_subtile_indices_[index].size()) {
+    physical_tile_z_to_subtile_indices_[index].resize(subtile_z + 1, -1);
+  }
+  physical_tile_z_to_subtile_indices_[index][subtile_z] = subtile_index;
 }
 
 void VprDeviceAnnotation::add_physical_tile_z_to_start_pin_index(
   t_physical_tile_type_ptr physical_tile, const int& subtile_z,
   const int& start_pin_index) {
-  physical_tile_z_to_start_pin_indices_[physical_tile][subtile_z] =
-    start_pin_index;
+  VTR_ASSERT(0 <= subtile_z);
+  size_t index = find_or_add_physical_tile_index(physical_tile);
+  if (size_t(subtile_z) >=
+      physical_tile_z_to_start_pin_indices_[index].size()) {
+    physical_tile_z_to_start_pin_indices_[index].resize(subtile_z + 1, -1);
+  }
+  physical_tile_z_to_start_pin_indices_[index][subtile_z] = start_pin_index;
+}
+
+/************************************************************************
+ * Private mutators
+ ***********************************************************************/
+size_t VprDeviceAnnotation::find_or_add_pb_type_index(t_pb_type* pb_type) {
+  auto result = pb_type_indices_.emplace(pb_type, pb_type_indices_.size());
+  if (true == result.second) {
+    physical_pb_types_.push_back(nullptr);
+    physical_pb_type_index_factors_.push_back(1.);
+    physical_pb_type_index_offsets_.push_back(0);
+    physical_pb_modes_.push_back(nullptr);
+    pb_type_circuit_models_.push_back(CircuitModelId::INVALID());
+    pb_type_mode_bits_.emplace_back();
+    pb_graph_node_unique_index_.emplace_back();
+  }
+  return result.first->second;
+}
+
+size_t VprDeviceAnnotation::find_or_add_pb_port_index(t_port* pb_port) {
+  auto result = pb_port_indices_.emplace(pb_port, pb_port_indices_.size());
+  if (true == result.second) {
+    physical_pb_ports_.emplace_back();
+    physical_pb_port_annotations_.emplace_back();
+    pb_circuit_ports_.push_back(CircuitPortId::INVALID());
+  }
+  return result.first->second;
+}
+
+size_t VprDeviceAnnotation::find_or_add_interconnect_index(
+  t_interconnect* pb_interconnect) {
+  auto result = interconnect_indices_.emplace(pb_interconnect,
+                                              interconnect_indices_.size());
+  if (true == result.second) {
+    interconnect_circuit_models_.push_back(CircuitModelId::INVALID());
+    interconnect_physical_types_.push_back(NUM_INTERC_TYPES);
+  }
+  return result.first->second;
+}
+
+size_t VprDeviceAnnotation::find_or_add_pb_graph_node_index(
+  t_pb_graph_node* pb_graph_node) {
+  auto result = pb_graph_node_indices_.emplace(pb_graph_node,
+                                               pb_graph_node_indices_.size());
+  if (true == result.second) {
+    pb_graph_node_unique_indices_.push_back(PbGraphNodeId::INVALID());
+    physical_pb_graph_nodes_.push_back(nullptr);
+  }
+  return result.first->second;
+}
+
+size_t VprDeviceAnnotation::find_or_add_pb_graph_pin_index(
+  const t_pb_graph_pin* pb_graph_pin) {
+  auto result =
+    pb_graph_pin_indices_.emplace(pb_graph_pin, pb_graph_pin_indices_.size());
+  if (true == result.second) {
+    physical_pb_graph_pins_.push_back(nullptr);
+  }
+  return result.first->second;
+}
+
+size_t VprDeviceAnnotation::find_or_add_physical_tile_index(
+  t_physical_tile_type_ptr physical_tile) {
+  auto result = physical_tile_indices_.emplace(physical_tile,
+                                               physical_tile_indices_.size());
+  if (true == result.second) {
+    physical_tile_pin2port_info_map_.emplace_back();
+    physical_tile_pin_subtile_indices_.emplace_back();
+    physical_tile_z_to_subtile_indices_.emplace_back();
+    physical_tile_z_to_start_pin_indices_.emplace_back();
+  }
+  return result.first->second;
+}
+
+const VprDeviceAnnotation::t_physical_pb_port_annotation*
+VprDeviceAnnotation::find_physical_pb_port_annotation(
+  t_port* operating_pb_port, t_port* physical_pb_port) const {
+  size_t index = find_annotation_index(pb_port_indices_, operating_pb_port);
+  if (INVALID_ANNOTATION_INDEX == index) {
+    return nullptr;
+  }
+  for (const t_physical_pb_port_annotation& port_annotation :
+       physical_pb_port_annotations_[index]) {
+    if (physical_pb_port == port_annotation.physical_pb_port) {
+      return &port_annotation;
+    }
+  }
+  return nullptr;
+}
+
+VprDeviceAnnotation::t_physical_pb_port_annotation&
+VprDeviceAnnotation::find_or_add_physical_pb_port_annotation(
+  t_port* operating_pb_port, t_port* physical_pb_port) {
+  size_t index = find_or_add_pb_port_index(operating_pb_port);
+  for (t_physical_pb_port_annotation& port_annotation :
+       physical_pb_port_annotations_[index]) {
+    if (physical_pb_port == port_annotation.physical_pb_port) {
+      return port_annotation;
+    }
+  }
+  t_physical_pb_port_annotation port_annotation;
+  port_annotation.physical_pb_port = physical_pb_port;
+  port_annotation.pin_initial_offset = 0;
+  port_annotation.pin_rotate_offset = 0;
+  port_annotation.port_rotate_offset = 0;
+  port_annotation.pin_offset = 0;
+  port_annotation.port_offset = 0;
+  physical_pb_port_annotations_[index].push_back(port_annotation);
+  return physical_pb_port_annotations_[index].back();
 }
 
 } /* End namespace openfpga*/
@@ -5,9 +5,12 @@
  * Include header files required by the data structure definition
  *******************************************************************/
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 /* Header from vtrutil library */
 #include "vtr_strong_id.h"
+#include "vtr_vector.h"
 
 /* Header from archfpga library */
 #include "physical_types.h"
@@ -88,7 +91,7 @@ class VprDeviceAnnotation {
   CircuitModelId rr_switch_circuit_model(const RRSwitchId& rr_switch) const;
   CircuitModelId rr_segment_circuit_model(const RRSegmentId& rr_segment) const;
   ArchDirectId direct_annotation(const size_t& direct) const;
-  LbRRGraph physical_lb_rr_graph(t_pb_graph_node* pb_graph_head) const;
+  const LbRRGraph& physical_lb_rr_graph(t_pb_graph_node* pb_graph_head) const;
   BasicPort physical_tile_pin_port_info(t_physical_tile_type_ptr physical_tile,
                                         const int& pin_index) const;
   int physical_tile_pin_subtile_index(t_physical_tile_type_ptr physical_tile,
@@ -156,36 +159,83 @@ class VprDeviceAnnotation {
     t_physical_tile_type_ptr physical_tile, const int& subtile_z,
     const int& start_pin_index);
 
+ private: /* Internal types */
+  /* Annotation between an operating pb_port and one of its physical pb_ports
+   * Note:
+   * - the LSB and MSB of the port range MUST be in range of the physical
+   *   pb_port
+   * - the accumulated offsets are just for internal usage
+   */
+  struct t_physical_pb_port_annotation {
+    t_port* physical_pb_port;
+    BasicPort port_range;
+    int pin_initial_offset;
+    int pin_rotate_offset;
+    int port_rotate_offset;
+    int pin_offset;
+    int port_offset;
+  };
+
+ private: /* Internal functions */
+  /* Find the dense index of an object, allocate one if it is not annotated
+   * yet. All the annotation vectors of the object are sized accordingly */
+  size_t find_or_add_pb_type_index(t_pb_type* pb_type);
+  size_t find_or_add_pb_port_index(t_port* pb_port);
+  size_t find_or_add_interconnect_index(t_interconnect* pb_interconnect);
+  size_t find_or_add_pb_graph_node_index(t_pb_graph_node* pb_graph_node);
+  size_t find_or_add_pb_graph_pin_index(const t_pb_graph_pin* pb_graph_pin);
+  size_t find_or_add_physical_tile_index(
+    t_physical_tile_type_ptr physical_tile);
+  /* Find the annotation between an operating pb_port and a physical pb_port.
+   * Return nullptr if not found */
+  const t_physical_pb_port_annotation* find_physical_pb_port_annotation(
+    t_port* operating_pb_port, t_port* physical_pb_port) const;
+  t_physical_pb_port_annotation& find_or_add_physical_pb_port_annotation(
+    t_port* operating_pb_port, t_port* physical_pb_port);
+
  private: /* Internal data */
+  /* Each annotated object is assigned a dense index when it is annotated for
+   * the first time. The annotations are stored in vectors addressed by the
+   * dense indices, so that a query costs only one hash look-up, whatever the
+   * number of annotations an object has. This matters as the annotations are
+   * queried in the innermost loops of repack, bitstream generation, etc.
+   */
+  std::unordered_map<t_pb_type*, size_t> pb_type_indices_;
+  std::unordered_map<t_port*, size_t> pb_port_indices_;
+  std::unordered_map<t_interconnect*, size_t> interconnect_indices_;
+  std::unordered_map<t_pb_graph_node*, size_t> pb_graph_node_indices_;
+  std::unordered_map<const t_pb_graph_pin*, size_t> pb_graph_pin_indices_;
+  std::unordered_map<t_physical_tile_type_ptr, size_t> physical_tile_indices_;
+
   /* Pair a regular pb_type to its physical pb_type */
-  std::map<t_pb_type*, t_pb_type*> physical_pb_types_;
-  std::map<t_pb_type*, float> physical_pb_type_index_factors_;
-  std::map<t_pb_type*, int> physical_pb_type_index_offsets_;
+  std::vector<t_pb_type*> physical_pb_types_;
+  std::vector<float> physical_pb_type_index_factors_;
+  std::vector<int> physical_pb_type_index_offsets_;
 
   /* Pair a physical mode for a pb_type
    * Note:
    * - the physical mode MUST be a child mode of the pb_type
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_pb_type*, t_mode*> physical_pb_modes_;
+  std::vector<t_mode*> physical_pb_modes_;
 
   /* Pair a physical pb_type to its circuit model
    * Note:
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_pb_type*, CircuitModelId> pb_type_circuit_models_;
+  std::vector<CircuitModelId> pb_type_circuit_models_;
 
   /* Pair a interconnect of a physical pb_type to its circuit model
    * Note:
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_interconnect*, CircuitModelId> interconnect_circuit_models_;
+  std::vector<CircuitModelId> interconnect_circuit_models_;
 
   /* Physical type of interconnect
    * Note:
    * - only applicable to an interconnect belongs to physical mode
    */
-  std::map<t_interconnect*, e_interconnect> interconnect_physical_types_;
+  std::vector<e_interconnect> interconnect_physical_types_;
 
   /* Pair a pb_type to its mode selection bits
    * - if the pb_type is a physical pb_type, the mode bits are the default mode
@@ -193,81 +243,69 @@ class VprDeviceAnnotation {
    * - if the pb_type is an operating pb_type, the mode bits will be applied
    *   when the operating pb_type is used by packer
    */
-  std::map<t_pb_type*, std::vector<size_t>> pb_type_mode_bits_;
+  std::vector<std::vector<size_t>> pb_type_mode_bits_;
 
   /* Pair a pb_port to its physical pb_port
    * Note:
    * - the parent of physical pb_port MUST be a physical pb_type
    */
-  std::map<t_port*, std::vector<t_port*>> physical_pb_ports_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_initial_offsets_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_rotate_offsets_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_port_rotate_offsets_;
-
-  /* Accumulated offsets for a physical pb port, just for internal usage */
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_port_offsets_;
-  /* Accumulated offsets for a physical pb_graph_pin, just for internal usage */
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_offsets_;
+  std::vector<std::vector<t_port*>> physical_pb_ports_;
 
-  /* Pair a pb_port to its LSB and MSB of a physical pb_port
-   * Note:
-   * - the LSB and MSB MUST be in range of the physical pb_port
-   */
-  std::map<t_port*, std::map<t_port*, BasicPort>> physical_pb_port_ranges_;
+  /* Port ranges and offsets between a pb_port and its physical pb_ports.
+   * An operating pb_port has only a few physical pb_ports, which are
+   * searched linearly */
+  std::vector<std::vector<t_physical_pb_port_annotation>>
+    physical_pb_port_annotations_;
 
   /* Pair a pb_port to a circuit port in circuit model
    * Note:
    * - the parent of physical pb_port MUST be a physical pb_type
    */
-  std::map<t_port*, CircuitPortId> pb_circuit_ports_;
+  std::vector<CircuitPortId> pb_circuit_ports_;
 
   /* Pair each pb_graph_node to an unique index in the graph
    * The unique index if the index in the array of t_pb_graph_node*
    */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>
-    pb_graph_node_unique_index_;
+  std::vector<std::vector<t_pb_graph_node*>> pb_graph_node_unique_index_;
+  std::vector<PbGraphNodeId> pb_graph_node_unique_indices_;
 
   /* Pair a pb_graph_node to a physical pb_graph_node
    * Note:
    * - the pb_type of physical pb_graph_node must be a physical pb_type
    */
-  std::map<t_pb_graph_node*, t_pb_graph_node*> physical_pb_graph_nodes_;
+  std::vector<t_pb_graph_node*> physical_pb_graph_nodes_;
 
   /* Pair a pb_graph_pin to a physical pb_graph_pin */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*> physical_pb_graph_pins_;
+  std::vector<t_pb_graph_pin*> physical_pb_graph_pins_;
 
   /* Pair a Routing Resource Switch (rr_switch) to a circuit model */
-  std::map<RRSwitchId, CircuitModelId> rr_switch_circuit_models_;
+  vtr::vector<RRSwitchId, CircuitModelId> rr_switch_circuit_models_;
 
   /* Pair a Routing Segment (rr_segment) to a circuit model */
-  std::map<RRSegmentId, CircuitModelId> rr_segment_circuit_models_;
+  vtr::vector<RRSegmentId, CircuitModelId> rr_segment_circuit_models_;
 
   /* Pair a direct connection (direct) to a annotation which contains circuit
    * model id */
-  std::map<size_t, ArchDirectId> direct_annotations_;
+  std::vector<ArchDirectId> direct_annotations_;
 
   /* Logical type routing resource graphs built from physical modes */
   std::map<t_pb_graph_node*, LbRRGraph> physical_lb_rr_graphs_;
 
   /* A fast look-up from pin index in physical tile to physical tile port */
-  std::map<t_physical_tile_type_ptr, std::map<int, BasicPort>>
-    physical_tile_pin2port_info_map_;
+  std::vector<std::vector<BasicPort>> physical_tile_pin2port_info_map_;
   /* A fast look-up from pin index in physical tile to sub tile index */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
-    physical_tile_pin_subtile_indices_;
+  std::vector<std::vector<int>> physical_tile_pin_subtile_indices_;
   /* A fast look-up from z (a valid instance index considering all the sub tiles
    * in a given physical tile) to the index in sub tile array The instance index
    * starts from 0 to the sum of the capacity of each sub tile
    */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
-    physical_tile_z_to_subtile_indices_;
+  std::vector<std::vector<int>> physical_tile_z_to_subtile_indices_;
   /* A fast look-up from z (a valid instance index considering all the sub tiles
    * in a given physical tile) to the index of the first pin in a given physcial
    * tile The instance index starts from 0 to the sum of the capacity of each
    * sub tile
    */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
-    physical_tile_z_to_start_pin_indices_;
+  std::vector<std::vector<int>> physical_tile_z_to_start_pin_indices_;
 };
 
 } /* End namespace openfpga*/
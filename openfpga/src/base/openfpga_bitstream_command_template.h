@@ -5,6 +5,8 @@
  * in purpose of generate Verilog netlists modeling the full FPGA fabric
  * This is one of the core engine of openfpga, including:
  * - repack : create physical pbs and redo packing
+ * - read_lb_rr_graph/write_lb_rr_graph : cache the routing resource graphs
+ *   of logical tiles which are used by repack
  *******************************************************************/
 #include "openfpga_bitstream_template.h"
 #include "openfpga_repack_template.h"
@@ -38,6 +40,11 @@ ShellCommandId add_repack_command_template(
   shell_cmd.set_option_require_value(opt_ignore_global_nets,
                                      openfpga::OPT_STRING);
 
+  /* Add an option '--astar' */
+  shell_cmd.add_option("astar", false,
+                       "Use A* search guided by the lower bound of the cost "
+                       "to sinks when routing programmable blocks");
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
@@ -53,6 +60,76 @@ ShellCommandId add_repack_command_template(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: read_lb_rr_graph
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_read_lb_rr_graph_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("read_lb_rr_graph");
+
+  /* Add an option '--file' */
+  CommandOptionId opt_file = shell_cmd.add_option(
+    "file", true,
+    "file path to the routing resource graphs of logical tiles");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false, "Enable verbose output");
+
+  /* Add command 'read_lb_rr_graph' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Load the routing resource graphs of logical tiles from a binary file",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_execute_function(shell_cmd_id,
+                                     read_lb_rr_graph_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
+/********************************************************************
+ * - Add a command to Shell environment: write_lb_rr_graph
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_write_lb_rr_graph_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("write_lb_rr_graph");
+
+  /* Add an option '--file' */
+  CommandOptionId opt_file = shell_cmd.add_option(
+    "file", true,
+    "file path to output the routing resource graphs of logical tiles");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false, "Enable verbose output");
+
+  /* Add command 'write_lb_rr_graph' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Write the routing resource graphs of logical tiles to a binary file",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_execute_function(shell_cmd_id,
+                                     write_lb_rr_graph_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
 /********************************************************************
  * - Add a command to Shell environment: build_architecture_bitstream
  * - Add associated options
@@ -116,6 +193,12 @@ ShellCommandId add_report_bitstream_distribution_command_template(
     "Specify the max. depth of blocks which will appear in report");
   shell_cmd.set_option_require_value(opt_depth, openfpga::OPT_STRING);
 
+  /* Add an option '--format' */
+  CommandOptionId opt_file_format = shell_cmd.add_option(
+    "format", false,
+    "file format of bitstream distribution [xml|csv|json]. Default: xml");
+  shell_cmd.set_option_require_value(opt_file_format, openfpga::OPT_STRING);
+
   /* Add an option '--no_time_stamp' */
   shell_cmd.add_option("no_time_stamp", false,
                        "Do not print time stamp in output files");
@@ -307,6 +390,28 @@ void add_bitstream_command_templates(openfpga::Shell<T>& shell,
   ShellCommandId shell_cmd_repack_id = add_repack_command_template(
     shell, openfpga_bitstream_cmd_class, cmd_dependency_repack, hidden);
 
+  /********************************
+   * Command 'read_lb_rr_graph'
+   */
+  /* The 'read_lb_rr_graph' command should NOT be executed before
+   * 'link_openfpga_arch', which annotates the physical modes */
+  std::vector<ShellCommandId> cmd_dependency_read_lb_rr_graph;
+  cmd_dependency_read_lb_rr_graph.push_back(
+    shell.command(std::string("link_openfpga_arch")));
+  add_read_lb_rr_graph_command_template(shell, openfpga_bitstream_cmd_class,
+                                        cmd_dependency_read_lb_rr_graph,
+                                        hidden);
+
+  /********************************
+   * Command 'write_lb_rr_graph'
+   */
+  /* The 'write_lb_rr_graph' command should NOT be executed before 'repack' */
+  std::vector<ShellCommandId> cmd_dependency_write_lb_rr_graph;
+  cmd_dependency_write_lb_rr_graph.push_back(shell_cmd_repack_id);
+  add_write_lb_rr_graph_command_template(shell, openfpga_bitstream_cmd_class,
+                                         cmd_dependency_write_lb_rr_graph,
+                                         hidden);
+
   /********************************
    * Command 'build_architecture_bitstream'
    */
@@ -256,10 +256,17 @@ int report_bitstream_distribution_template(const T& openfpga_ctx,
     }
   }
 
+  /* Check file format requirements */
+  std::string file_format("xml");
+  CommandOptionId opt_file_format = cmd.option("format");
+  if (true == cmd_context.option_enable(cmd, opt_file_format)) {
+    file_format = cmd_context.option_value(cmd, opt_file_format);
+  }
+
   status = report_bitstream_distribution(
     cmd_context.option_value(cmd, opt_file), openfpga_ctx.bitstream_manager(),
     openfpga_ctx.fabric_bitstream(),
-    !cmd_context.option_enable(cmd, opt_no_time_stamp), depth);
+    !cmd_context.option_enable(cmd, opt_no_time_stamp), depth, file_format);
 
   return status;
 }
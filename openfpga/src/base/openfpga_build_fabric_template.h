@@ -16,6 +16,7 @@
 #include "fabric_key_writer.h"
 #include "globals.h"
 #include "openfpga_naming.h"
+#include "openfpga_thread_pool.h"
 #include "read_unique_blocks_bin.h"
 #include "read_unique_blocks_xml.h"
 #include "read_xml_fabric_key.h"
@@ -23,6 +24,7 @@
 #include "read_xml_module_name_map.h"
 #include "read_xml_tile_config.h"
 #include "rename_modules.h"
+#include "report_fabric_statistics.h"
 #include "report_reference.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
@@ -114,6 +116,8 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_group_config_block = cmd.option("group_config_block");
   CommandOptionId opt_name_module_using_index =
     cmd.option("name_module_using_index");
+  CommandOptionId opt_num_threads = cmd.option("num_threads");
+  CommandOptionId opt_incremental = cmd.option("incremental");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
   /* Report conflicts with options:
@@ -195,10 +199,32 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     }
   }
 
+  /* By default, build modules in a single thread */
+  size_t num_threads = 1;
+  if (true == cmd_context.option_enable(cmd, opt_num_threads) &&
+      false == read_num_threads(cmd_context.option_value(cmd, opt_num_threads),
+                                num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Incremental build: the fabric of the previous build is dropped, while
+   * the snapshot of its modules is kept to be reused */
+  openfpga_ctx.mutable_fabric_build_snapshot().set_enabled(
+    cmd_context.option_enable(cmd, opt_incremental));
+  if (true == cmd_context.option_enable(cmd, opt_incremental)) {
+    openfpga_ctx.mutable_module_graph() = ModuleManager();
+    openfpga_ctx.mutable_decoder_lib() = DecoderLibrary();
+    openfpga_ctx.mutable_blwl_shift_register_banks() =
+      MemoryBankShiftRegisterBanks();
+    openfpga_ctx.mutable_fabric_tile() = FabricTile();
+    openfpga_ctx.mutable_module_name_map() = ModuleNameMap();
+  }
+
   curr_status = build_device_module_graph(
     openfpga_ctx.mutable_module_graph(), openfpga_ctx.mutable_decoder_lib(),
     openfpga_ctx.mutable_blwl_shift_register_banks(),
     openfpga_ctx.mutable_fabric_tile(), openfpga_ctx.mutable_module_name_map(),
+    openfpga_ctx.mutable_fabric_build_snapshot(),
     const_cast<const T&>(openfpga_ctx), g_vpr_ctx.device(),
     cmd_context.option_enable(cmd, opt_frame_view),
     openfpga_ctx.device_rr_gsb().is_compressed(),
@@ -207,7 +233,7 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     cmd_context.option_enable(cmd, opt_group_config_block),
     cmd_context.option_enable(cmd, opt_name_module_using_index),
     cmd_context.option_enable(cmd, opt_gen_random_fabric_key),
-    cmd_context.option_enable(cmd, opt_verbose));
+    num_threads, cmd_context.option_enable(cmd, opt_verbose));
 
   /* If there is any error, final status cannot be overwritten by a success flag
    */
@@ -571,6 +597,34 @@ int report_reference_template(const T& openfpga_ctx, const Command& cmd,
                           cmd_context.option_enable(cmd, opt_verbose));
 }
 
+/********************************************************************
+ * Report the statistics of module graph under a given module
+ *******************************************************************/
+template <class T>
+int report_fabric_statistics_template(const T& openfpga_ctx, const Command& cmd,
+                                      const CommandContext& cmd_context) {
+  CommandOptionId opt_verbose = cmd.option("verbose");
+  CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
+
+  std::string file_name;
+  CommandOptionId opt_file = cmd.option("file");
+  if (true == cmd_context.option_enable(cmd, opt_file)) {
+    file_name = cmd_context.option_value(cmd, opt_file);
+  }
+
+  CommandOptionId opt_module = cmd.option("module");
+  std::string module_name =
+    openfpga_ctx.module_name_map().name(generate_fpga_top_module_name());
+  if (true == cmd_context.option_enable(cmd, opt_module)) {
+    module_name = cmd_context.option_value(cmd, opt_module);
+  }
+
+  return report_fabric_statistics(
+    file_name, module_name, openfpga_ctx.module_graph(),
+    !cmd_context.option_enable(cmd, opt_no_time_stamp),
+    cmd_context.option_enable(cmd, opt_verbose));
+}
+
 } /* end namespace openfpga */
 
 #endif
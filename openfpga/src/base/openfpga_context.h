@@ -9,6 +9,7 @@
 #include "decoder_library.h"
 #include "device_rr_gsb.h"
 #include "fabric_bitstream.h"
+#include "fabric_build_snapshot.h"
 #include "fabric_global_port_info.h"
 #include "fabric_tile.h"
 #include "io_location_map.h"
@@ -112,6 +113,9 @@ class OpenfpgaContext : public Context {
     return module_name_map_;
   }
   const openfpga::FabricTile& fabric_tile() const { return fabric_tile_; }
+  const openfpga::FabricBuildSnapshot& fabric_build_snapshot() const {
+    return fabric_build_snapshot_;
+  }
   const openfpga::FabricGlobalPortInfo& fabric_global_port_info() const {
     return fabric_global_port_info_;
   }
@@ -175,6 +179,9 @@ class OpenfpgaContext : public Context {
     return module_name_map_;
   }
   openfpga::FabricTile& mutable_fabric_tile() { return fabric_tile_; }
+  openfpga::FabricBuildSnapshot& mutable_fabric_build_snapshot() {
+    return fabric_build_snapshot_;
+  }
   openfpga::FabricGlobalPortInfo& mutable_fabric_global_port_info() {
     return fabric_global_port_info_;
   }
@@ -233,6 +240,8 @@ class OpenfpgaContext : public Context {
   openfpga::ModuleNameMap module_name_map_;
   openfpga::FabricTile fabric_tile_;
   openfpga::FabricGlobalPortInfo fabric_global_port_info_;
+  /* Modules of the previous build, used by incremental builds */
+  openfpga::FabricBuildSnapshot fabric_build_snapshot_;
 
   /* Bitstream database */
   openfpga::BitstreamManager bitstream_manager_;
@@ -21,6 +21,7 @@
 #include "mux_library_builder.h"
 #include "openfpga_annotate_routing.h"
 #include "openfpga_rr_graph_support.h"
+#include "openfpga_thread_pool.h"
 #include "pb_type_utils.h"
 #include "read_activity.h"
 #include "read_xml_pin_constraints.h"
@@ -49,8 +50,17 @@ int link_arch_template(T& openfpga_ctx, const Command& cmd,
 
   CommandOptionId opt_activity_file = cmd.option("activity_file");
   CommandOptionId opt_sort_edge = cmd.option("sort_gsb_chan_node_in_edges");
+  CommandOptionId opt_num_threads = cmd.option("num_threads");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  /* By default, build General Switch Blocks in a single thread */
+  size_t num_threads = 1;
+  if (true == cmd_context.option_enable(cmd, opt_num_threads) &&
+      false == read_num_threads(cmd_context.option_value(cmd, opt_num_threads),
+                                num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   /* Build fast look-up between physical tile pin index and port information */
   build_physical_tile_pin2port_info(
     g_vpr_ctx.device(), openfpga_ctx.mutable_vpr_device_annotation());
@@ -114,15 +124,15 @@ int link_arch_template(T& openfpga_ctx, const Command& cmd,
   annotate_device_rr_gsb(
     g_vpr_ctx.device(), openfpga_ctx.mutable_device_rr_gsb(),
     !openfpga_ctx.clock_arch().empty(), /* FIXME: consider to be more robust! */
-    cmd_context.option_enable(cmd, opt_verbose));
+    num_threads, cmd_context.option_enable(cmd, opt_verbose));
 
   if (true == cmd_context.option_enable(cmd, opt_sort_edge)) {
     sort_device_rr_gsb_chan_node_in_edges(
       g_vpr_ctx.device().rr_graph, openfpga_ctx.mutable_device_rr_gsb(),
-      cmd_context.option_enable(cmd, opt_verbose));
+      num_threads, cmd_context.option_enable(cmd, opt_verbose));
     sort_device_rr_gsb_ipin_node_in_edges(
       g_vpr_ctx.device().rr_graph, openfpga_ctx.mutable_device_rr_gsb(),
-      cmd_context.option_enable(cmd, opt_verbose));
+      num_threads, cmd_context.option_enable(cmd, opt_verbose));
   }
 
   /* Build multiplexer library */
@@ -222,6 +232,7 @@ int route_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_disable_unused_trees = cmd.option("disable_unused_trees");
   CommandOptionId opt_disable_unused_spines =
     cmd.option("disable_unused_spines");
+  CommandOptionId opt_num_threads = cmd.option("num_threads");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
   /* If pin constraints are enabled by command options, read the file */
@@ -231,6 +242,14 @@ int route_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
       read_xml_pin_constraints(cmd_context.option_value(cmd, opt_pcf).c_str());
   }
 
+  /* By default, route clock trees in a single thread */
+  size_t num_threads = 1;
+  if (true == cmd_context.option_enable(cmd, opt_num_threads) &&
+      false == read_num_threads(cmd_context.option_value(cmd, opt_num_threads),
+                                num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   return route_clock_rr_graph(
     openfpga_ctx.mutable_vpr_routing_annotation(),
     openfpga_ctx.vpr_clustering_annotation(), g_vpr_ctx.device(),
@@ -238,7 +257,7 @@ int route_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
     openfpga_ctx.clock_rr_lookup(), openfpga_ctx.clock_arch(), pin_constraints,
     cmd_context.option_enable(cmd, opt_disable_unused_trees),
     cmd_context.option_enable(cmd, opt_disable_unused_spines),
-    cmd_context.option_enable(cmd, opt_verbose));
+    num_threads, cmd_context.option_enable(cmd, opt_verbose));
 }
 
 } /* end namespace openfpga */
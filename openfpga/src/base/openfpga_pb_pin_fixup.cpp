@@ -18,11 +18,76 @@
 #include "openfpga_pb_pin_fixup.h"
 #include "openfpga_physical_tile_utils.h"
 #include "openfpga_side_manager.h"
+#include "openfpga_thread_pool.h"
 #include "pb_type_utils.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * The pin remapping of a clustered block. Remapping results are recorded
+ * here rather than in the clustering annotation, so that the blocks can be
+ * fixed up concurrently. The records are committed to the clustering
+ * annotation in the order of blocks, which is the same as fixing up them
+ * one by one.
+ * Note that the fix-up of a block only queries the remapping of the block
+ * itself, and the clustering annotation is cleared before any fix-up
+ *******************************************************************/
+class PbPinFixupRecord {
+ public: /* Public accessors, same as those of VprClusteringAnnotation */
+  bool is_net_renamed(const ClusterBlockId& block_id,
+                      const int& pin_index) const {
+    VTR_ASSERT(block_id == block_id_);
+    return net_names_.end() != net_names_.find(pin_index);
+  }
+  ClusterNetId net(const ClusterBlockId& block_id,
+                   const int& pin_index) const {
+    VTR_ASSERT(true == is_net_renamed(block_id, pin_index));
+    return net_names_.at(pin_index);
+  }
+
+ public: /* Public mutators, same as those of VprClusteringAnnotation */
+  void set_block(const ClusterBlockId& block_id) { block_id_ = block_id; }
+  void rename_net(const ClusterBlockId& block_id, const int& pin_index,
+                  const ClusterNetId& net_id) {
+    VTR_ASSERT(block_id == block_id_);
+    net_names_[pin_index] = net_id;
+    renamed_nets_.emplace_back(pin_index, net_id);
+  }
+
+ public: /* Public accessors */
+  /* Apply the remapping to the clustering annotation */
+  void commit(VprClusteringAnnotation& vpr_clustering_annotation) const {
+    for (const auto& renamed_net : renamed_nets_) {
+      vpr_clustering_annotation.rename_net(block_id_, renamed_net.first,
+                                           renamed_net.second);
+    }
+  }
+
+ private: /* Internal data */
+  ClusterBlockId block_id_;
+  std::map<int, ClusterNetId> net_names_;
+  std::vector<std::pair<int, ClusterNetId>> renamed_nets_;
+};
+
+/* A grid where a clustered block is placed. The border side is
+ * NUM_2D_SIDES for the grids in the core of the fabric */
+struct t_pb_pin_fixup_location {
+  vtr::Point<size_t> coord;
+  e_side border_side;
+};
+
+/* A clustered block to be fixed up, which is the unit of work when fixing
+ * up blocks concurrently. A block occupying several grids is fixed up at
+ * each of them in the order the grids are visited */
+struct t_pb_pin_fixup_job {
+  ClusterBlockId blk_id;
+  std::vector<t_pb_pin_fixup_location> locations;
+  PbPinFixupRecord fixup_record;
+  size_t num_fixup = 0;
+  int status = CMD_EXEC_SUCCESS;
+};
+
 /********************************************************************
  * For global net which was remapped during routing, no tracking can be found.
  *Packer only keeps an out-of-date record on its pin mapping. Router does not
@@ -31,7 +96,7 @@ namespace openfpga {
  *******************************************************************/
 static int update_cluster_pin_global_net_with_post_routing_results(
   const ClusteringContext& clustering_ctx,
-  VprClusteringAnnotation& clustering_annotation, const ClusterBlockId& blk_id,
+  PbPinFixupRecord& clustering_annotation, const ClusterBlockId& blk_id,
   t_logical_block_type_ptr logical_block, const bool& map_gnet2msb,
   size_t& num_fixup, const bool& verbose) {
   /* Reassign global nets to unused pins in the same port where they were mapped
@@ -139,7 +204,7 @@ static int update_cluster_pin_global_net_with_post_routing_results(
 static int update_cluster_pin_with_post_routing_results(
   const DeviceContext& device_ctx, const ClusteringContext& clustering_ctx,
   const VprRoutingAnnotation& vpr_routing_annotation,
-  VprClusteringAnnotation& vpr_clustering_annotation, const size_t& layer,
+  PbPinFixupRecord& vpr_clustering_annotation, const size_t& layer,
   const vtr::Point<size_t>& grid_coord, const ClusterBlockId& blk_id,
   const e_side& border_side, const size_t& z, const bool& perimeter_cb,
   const bool& map_gnet2msb, size_t& num_fixup, const bool& verbose) {
@@ -345,18 +410,63 @@ static int update_cluster_pin_with_post_routing_results(
   return status;
 }
 
+/********************************************************************
+ * Add a grid where a clustered block is placed to the job of the block.
+ * Jobs are created in the order blocks are first visited
+ *******************************************************************/
+static void add_pb_pin_fixup_job_location(
+  std::vector<t_pb_pin_fixup_job>& jobs,
+  vtr::vector<ClusterBlockId, size_t>& blk_job_indices,
+  const ClusterBlockId& blk_id, const vtr::Point<size_t>& coord,
+  const e_side& border_side) {
+  if (size_t(-1) == blk_job_indices[blk_id]) {
+    blk_job_indices[blk_id] = jobs.size();
+    jobs.emplace_back();
+    jobs.back().blk_id = blk_id;
+    jobs.back().fixup_record.set_block(blk_id);
+  }
+  t_pb_pin_fixup_location location;
+  location.coord = coord;
+  location.border_side = border_side;
+  jobs[blk_job_indices[blk_id]].locations.push_back(location);
+}
+
+/********************************************************************
+ * Fix up a clustered block at all its locations. Only the record of the
+ * job is modified, so that blocks can be fixed up concurrently
+ *******************************************************************/
+static void update_pb_pin_fixup_job(
+  t_pb_pin_fixup_job& job, const DeviceContext& device_ctx,
+  const ClusteringContext& clustering_ctx,
+  const PlacementContext& placement_ctx,
+  const VprRoutingAnnotation& vpr_routing_annotation, const size_t& layer,
+  const bool& perimeter_cb, const bool& map_gnet2msb, const bool& verbose) {
+  for (const t_pb_pin_fixup_location& location : job.locations) {
+    job.status = update_cluster_pin_with_post_routing_results(
+      device_ctx, clustering_ctx, vpr_routing_annotation, job.fixup_record,
+      layer, location.coord, job.blk_id, location.border_side,
+      placement_ctx.block_locs()[job.blk_id].loc.sub_tile, perimeter_cb,
+      map_gnet2msb, job.num_fixup, verbose);
+    if (CMD_EXEC_SUCCESS != job.status) {
+      break;
+    }
+  }
+}
+
 /********************************************************************
  * Main function to fix up the pb pin mapping results
- * This function will walk through each grid
+ * This function will walk through each grid and collect the clustered
+ * blocks to fix up. When more than one thread is requested, the blocks are
+ * fixed up concurrently, and the results are committed to the clustering
+ * annotation in the order of blocks. The clustering annotation is the same
+ * as fixing up the blocks one by one
  *******************************************************************/
 int update_pb_pin_with_post_routing_results(
   const DeviceContext& device_ctx, const ClusteringContext& clustering_ctx,
   const PlacementContext& placement_ctx,
   const VprRoutingAnnotation& vpr_routing_annotation,
   VprClusteringAnnotation& vpr_clustering_annotation, const bool& perimeter_cb,
-  const bool& map_gnet2msb, const bool& verbose) {
-  int status = CMD_EXEC_SUCCESS;
-  size_t num_fixup = 0;
+  const bool& map_gnet2msb, const size_t& num_threads, const bool& verbose) {
   /* Confirm options */
   VTR_LOGV(verbose && map_gnet2msb,
            "User choose to map global net to the best fit MSB of input port\n");
@@ -364,8 +474,13 @@ int update_pb_pin_with_post_routing_results(
    * post-routing clustering result sync-up */
   vpr_clustering_annotation.clear_net_remapping();
 
+  vtr::Timer collect_timer;
   size_t layer = 0;
-  /* Update the core logic (center blocks of the FPGA) */
+  std::vector<t_pb_pin_fixup_job> jobs;
+  vtr::vector<ClusterBlockId, size_t> blk_job_indices(
+    clustering_ctx.clb_nlist.blocks().size(), size_t(-1));
+
+  /* Collect the core logic (center blocks of the FPGA) */
   for (size_t x = 1; x < device_ctx.grid.width() - 1; ++x) {
     for (size_t y = 1; y < device_ctx.grid.height() - 1; ++y) {
       t_physical_tile_type_ptr phy_tile =
@@ -383,17 +498,8 @@ int update_pb_pin_with_post_routing_results(
         if (ClusterBlockId::INVALID() == cluster_blk_id) {
           continue;
         }
-        /* We know the entrance to grid info and mapping results, do the fix-up
-         * for this block */
-        vtr::Point<size_t> grid_coord(x, y);
-        status = update_cluster_pin_with_post_routing_results(
-          device_ctx, clustering_ctx, vpr_routing_annotation,
-          vpr_clustering_annotation, layer, grid_coord, cluster_blk_id,
-          NUM_2D_SIDES, placement_ctx.block_locs()[cluster_blk_id].loc.sub_tile,
-          perimeter_cb, map_gnet2msb, num_fixup, verbose);
-        if (status != CMD_EXEC_SUCCESS) {
-          return CMD_EXEC_FATAL_ERROR;
-        }
+        add_pb_pin_fixup_job_location(jobs, blk_job_indices, cluster_blk_id,
+                                      vtr::Point<size_t>(x, y), NUM_2D_SIDES);
       }
     }
   }
@@ -420,20 +526,42 @@ int update_pb_pin_with_post_routing_results(
         if (ClusterBlockId::INVALID() == cluster_blk_id) {
           continue;
         }
-        /* Update on I/O grid */
-        status = update_cluster_pin_with_post_routing_results(
-          device_ctx, clustering_ctx, vpr_routing_annotation,
-          vpr_clustering_annotation, layer, io_coord, cluster_blk_id, io_side,
-          placement_ctx.block_locs()[cluster_blk_id].loc.sub_tile, perimeter_cb,
-          map_gnet2msb, num_fixup, verbose);
-        if (status != CMD_EXEC_SUCCESS) {
-          return CMD_EXEC_FATAL_ERROR;
-        }
+        add_pb_pin_fixup_job_location(jobs, blk_job_indices, cluster_blk_id,
+                                      io_coord, io_side);
       }
     }
   }
+  VTR_LOG("Collected %lu clustered blocks took %g seconds\n", jobs.size(),
+          collect_timer.elapsed_sec());
+
+  size_t num_workers = find_num_workers(num_threads, jobs.size());
+
+  /* Fix up the blocks */
+  vtr::Timer fixup_timer;
+  run_parallel_jobs(
+    jobs.size(), num_workers, [&](const size_t& ijob, const size_t&) {
+      update_pb_pin_fixup_job(jobs[ijob], device_ctx, clustering_ctx,
+                              placement_ctx, vpr_routing_annotation, layer,
+                              perimeter_cb, map_gnet2msb, verbose);
+    });
+  VTR_LOG("Fixed up %lu clustered blocks with %lu threads took %g seconds\n",
+          jobs.size(), num_workers, fixup_timer.elapsed_sec());
+
+  /* Commit the fix-up results in the order of blocks */
+  vtr::Timer commit_timer;
+  size_t num_fixup = 0;
+  for (const t_pb_pin_fixup_job& job : jobs) {
+    if (CMD_EXEC_SUCCESS != job.status) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    job.fixup_record.commit(vpr_clustering_annotation);
+    num_fixup += job.num_fixup;
+  }
+  VTR_LOG("Committed the fix-up results took %g seconds\n",
+          commit_timer.elapsed_sec());
+
   VTR_LOG("In total %lu fixup have been applied\n", num_fixup);
-  return status;
+  return CMD_EXEC_SUCCESS;
 }
 
 } /* end namespace openfpga */
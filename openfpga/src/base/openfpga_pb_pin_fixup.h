@@ -19,7 +19,7 @@ int update_pb_pin_with_post_routing_results(
   const PlacementContext& placement_ctx,
   const VprRoutingAnnotation& vpr_routing_annotation,
   VprClusteringAnnotation& vpr_clustering_annotation, const bool& perimeter_cb,
-  const bool& map_gnet2msb, const bool& verbose);
+  const bool& map_gnet2msb, const size_t& num_threads, const bool& verbose);
 
 } /* end namespace openfpga */
 
@@ -9,11 +9,13 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "read_lb_rr_graph_bin.h"
 #include "read_xml_repack_design_constraints.h"
 #include "repack.h"
 #include "repack_design_constraints.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "write_lb_rr_graph_bin.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -27,6 +29,7 @@ int repack_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_design_constraints = cmd.option("design_constraints");
   CommandOptionId opt_ignore_global_nets =
     cmd.option("ignore_global_nets_on_pins");
+  CommandOptionId opt_astar = cmd.option("astar");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
   /* Load design constraints from file */
@@ -44,6 +47,7 @@ int repack_template(T& openfpga_ctx, const Command& cmd,
   options.set_design_constraints(repack_design_constraints);
   options.set_ignore_global_nets_on_pins(
     cmd_context.option_value(cmd, opt_ignore_global_nets));
+  options.set_astar(cmd_context.option_enable(cmd, opt_astar));
   options.set_verbose_output(cmd_context.option_enable(cmd, opt_verbose));
 
   if (!options.valid()) {
@@ -67,6 +71,52 @@ int repack_template(T& openfpga_ctx, const Command& cmd,
   return CMD_EXEC_SUCCESS;
 }
 
+/********************************************************************
+ * A wrapper function to load the routing resource graphs of logical tiles
+ * from a binary file, which are then used by the repacker
+ *******************************************************************/
+template <class T>
+int read_lb_rr_graph_template(T& openfpga_ctx, const Command& cmd,
+                              const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  /* Check the option '--file' is enabled or not
+   * Actually, it must be enabled as the shell interface will check
+   * before reaching this fuction
+   */
+  VTR_ASSERT(true == cmd_context.option_enable(cmd, opt_file));
+  VTR_ASSERT(false == cmd_context.option_value(cmd, opt_file).empty());
+
+  std::string file_name = cmd_context.option_value(cmd, opt_file);
+  return read_bin_lb_rr_graphs(file_name.c_str(), g_vpr_ctx.device(),
+                               openfpga_ctx.mutable_vpr_device_annotation(),
+                               cmd_context.option_enable(cmd, opt_verbose));
+}
+
+/********************************************************************
+ * A wrapper function to write the routing resource graphs of logical tiles
+ * built by the repacker to a binary file
+ *******************************************************************/
+template <class T>
+int write_lb_rr_graph_template(const T& openfpga_ctx, const Command& cmd,
+                               const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  /* Check the option '--file' is enabled or not
+   * Actually, it must be enabled as the shell interface will check
+   * before reaching this fuction
+   */
+  VTR_ASSERT(true == cmd_context.option_enable(cmd, opt_file));
+  VTR_ASSERT(false == cmd_context.option_value(cmd, opt_file).empty());
+
+  std::string file_name = cmd_context.option_value(cmd, opt_file);
+  return write_bin_lb_rr_graphs(file_name.c_str(), g_vpr_ctx.device(),
+                                openfpga_ctx.vpr_device_annotation(),
+                                cmd_context.option_enable(cmd, opt_verbose));
+}
+
 } /* end namespace openfpga */
 
 #endif
@@ -207,6 +207,14 @@ ShellCommandId add_link_arch_command_template(
                        "Sort all the incoming edges for each routing track "
                        "output node in General Switch Blocks (GSBs)");
 
+  /* Add an option '--num_threads' */
+  CommandOptionId opt_num_threads = shell_cmd.add_option(
+    "num_threads", false,
+    "Build and sort General Switch Blocks (GSBs) with the given number of "
+    "threads. Use 0 to take all the available cores. By default, 1 thread is "
+    "used");
+  shell_cmd.set_option_require_value(opt_num_threads, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -297,6 +305,18 @@ ShellCommandId add_check_netlist_naming_conflict_command_template(
     "report", false, "Output a report file about what any correction applied");
   shell_cmd.set_option_require_value(opt_rpt, openfpga::OPT_STRING);
 
+  /* Add an option '--num_threads' */
+  CommandOptionId opt_num_threads = shell_cmd.add_option(
+    "num_threads", false,
+    "Check the names with the given number of threads. Use 0 to take all the "
+    "available cores. By default, 1 thread is used");
+  shell_cmd.set_option_require_value(opt_num_threads, openfpga::OPT_INT);
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false,
+                       "Show all the names in violation rather than the "
+                       "first few ones");
+
   /* Add command 'check_netlist_naming_conflict' to the Shell */
   ShellCommandId shell_cmd_id =
     shell.add_command(shell_cmd,
@@ -331,6 +351,12 @@ ShellCommandId add_pb_pin_fixup_command_template(
     "to a best-fit Most Significant Bit (MSB) of input ports of programmable "
     "blocks. If not specified, a best-fit Least Significant Bit (LSB) will be "
     "the default choice");
+  /* Add an option '--num_threads' */
+  CommandOptionId opt_num_threads = shell_cmd.add_option(
+    "num_threads", false,
+    "Fix up the clustered blocks with the given number of threads. Use 0 to "
+    "take all the available cores. By default, 1 thread is used");
+  shell_cmd.set_option_require_value(opt_num_threads, openfpga::OPT_INT);
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -436,6 +462,22 @@ ShellCommandId add_build_fabric_command_template(
                        "Create a random fabric key which will shuffle the "
                        "memory address for encryption purpose");
 
+  /* Add an option '--num_threads' */
+  CommandOptionId opt_num_threads = shell_cmd.add_option(
+    "num_threads", false,
+    "Build the unique grid, routing and tile modules with the given number of "
+    "threads. Each thread holds a copy of the module graph, so the peak "
+    "memory grows with the number of threads. Use 0 to take all the available "
+    "cores. By default, 1 thread is used");
+  shell_cmd.set_option_require_value(opt_num_threads, openfpga::OPT_INT);
+
+  /* Add an option '--incremental' */
+  shell_cmd.add_option(
+    "incremental", false,
+    "Reuse the unique grid, routing and tile modules from the previous "
+    "build_fabric (which is also run with this option) whose inputs are not "
+    "changed. Useful when only a few circuit models are modified");
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -723,6 +765,12 @@ ShellCommandId add_route_clock_rr_graph_command_template(
   shell_cmd.add_option("disable_unused_spines", false,
                        "Disable part of the clock tree which are used by clock "
                        "nets. Useful to reduce clock power");
+  /* Add an option '--num_threads' */
+  CommandOptionId opt_num_threads = shell_cmd.add_option(
+    "num_threads", false,
+    "Route the pins of clock trees with the given number of threads. Use 0 to "
+    "take all the available cores. By default, 1 thread is used");
+  shell_cmd.set_option_require_value(opt_num_threads, openfpga::OPT_INT);
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -1059,6 +1107,50 @@ ShellCommandId add_report_reference_command_template(
   return shell_cmd_id;
 }
 
+/******************************************************************
+ * - Add a command to Shell environment: report_fabric_statistics
+ * - Add associated options
+ * - Add command dependency
+ ******************************************************************/
+template <class T>
+ShellCommandId add_report_fabric_statistics_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("report_fabric_statistics");
+  /* Add an option '--file' in short '-f'*/
+  CommandOptionId opt_file = shell_cmd.add_option(
+    "file", false, "specify the file to output the statistics of each module");
+  shell_cmd.set_option_short_name(opt_file, "f");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  /* Add an option '--module'*/
+  CommandOptionId opt_module = shell_cmd.add_option(
+    "module", false,
+    "specify the root module under which the statistics will be reported");
+  shell_cmd.set_option_require_value(opt_module, openfpga::OPT_STRING);
+
+  /* Add an option '--no_time_stamp' */
+  shell_cmd.add_option("no_time_stamp", false,
+                       "do not print time stamp in output files");
+
+  shell_cmd.add_option("verbose", false,
+                       "Show the statistics of each unique module");
+
+  /* Add command to the Shell */
+  ShellCommandId shell_cmd_id =
+    shell.add_command(shell_cmd,
+                      "report the number of instances, configuration bits, "
+                      "nets and depth of hierarchy under a given module",
+                      hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_const_execute_function(
+    shell_cmd_id, report_fabric_statistics_template<T>);
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
 template <class T>
 void add_setup_command_templates(openfpga::Shell<T>& shell,
                                  const bool& hidden = false) {
@@ -1320,6 +1412,16 @@ void add_setup_command_templates(openfpga::Shell<T>& shell,
   add_report_reference_command_template<T>(
     shell, openfpga_setup_cmd_class, cmd_dependency_report_reference, hidden);
 
+  /********************************
+   * Command 'report_fabric_statistics'
+   */
+  /* The command should NOT be executed before 'build_fabric' */
+  std::vector<ShellCommandId> cmd_dependency_report_fabric_statistics;
+  cmd_dependency_report_fabric_statistics.push_back(build_fabric_cmd_id);
+  add_report_fabric_statistics_command_template<T>(
+    shell, openfpga_setup_cmd_class, cmd_dependency_report_fabric_statistics,
+    hidden);
+
   /********************************
    * Command 'read_unique_blocks'
    */
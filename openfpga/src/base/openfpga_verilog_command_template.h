@@ -68,6 +68,11 @@ ShellCommandId add_write_fabric_verilog_command_template(
     "use_relative_path", false,
     "Force to use relative path in netlists when including other netlists");
 
+  /* Add an option '--compress' */
+  shell_cmd.add_option(
+    "compress", false,
+    "Compress the netlists of fabric modules in gzip format");
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
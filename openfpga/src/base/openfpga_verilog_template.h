@@ -8,6 +8,7 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_scale.h"
 #include "read_xml_bus_group.h"
 #include "read_xml_pin_constraints.h"
@@ -36,8 +37,17 @@ int write_fabric_verilog_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_default_net_type = cmd.option("default_net_type");
   CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
   CommandOptionId opt_use_relative_path = cmd.option("use_relative_path");
+  CommandOptionId opt_compress = cmd.option("compress");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  if (true == cmd_context.option_enable(cmd, opt_compress) &&
+      false == OutputFileStream::compression_supported()) {
+    VTR_LOG_ERROR(
+      "Option '--compress' is not supported as OpenFPGA is built without "
+      "zlib!\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-Verilog Keep it independent from any other outside data structures
    */
@@ -56,6 +66,7 @@ int write_fabric_verilog_template(T& openfpga_ctx, const Command& cmd,
     options.set_default_net_type(
       cmd_context.option_value(cmd, opt_default_net_type));
   }
+  options.set_compress_netlist(cmd_context.option_enable(cmd, opt_compress));
   options.set_verbose_output(cmd_context.option_enable(cmd, opt_verbose));
   options.set_compress_routing(openfpga_ctx.flow_manager().compress_routing());
   /* For perimeter cb, enable the constant-zero undriven inputs, unless it is
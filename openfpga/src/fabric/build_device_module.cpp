@@ -22,6 +22,7 @@
 #include "build_top_module.h"
 #include "build_wire_modules.h"
 #include "command_exit_codes.h"
+#include "fabric_build_fingerprint.h"
 #include "openfpga_naming.h"
 #include "rename_modules.h"
 
@@ -35,12 +36,13 @@ namespace openfpga {
 int build_device_module_graph(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
   MemoryBankShiftRegisterBanks& blwl_sr_banks, FabricTile& fabric_tile,
-  ModuleNameMap& module_name_map, const OpenfpgaContext& openfpga_ctx,
-  const DeviceContext& vpr_device_ctx, const bool& frame_view,
-  const bool& compress_routing, const bool& duplicate_grid_pin,
-  const FabricKey& fabric_key, const TileConfig& tile_config,
-  const bool& group_config_block, const bool& name_module_using_index,
-  const bool& generate_random_fabric_key, const bool& verbose) {
+  ModuleNameMap& module_name_map, FabricBuildSnapshot& snapshot,
+  const OpenfpgaContext& openfpga_ctx, const DeviceContext& vpr_device_ctx,
+  const bool& frame_view, const bool& compress_routing,
+  const bool& duplicate_grid_pin, const FabricKey& fabric_key,
+  const TileConfig& tile_config, const bool& group_config_block,
+  const bool& name_module_using_index, const bool& generate_random_fabric_key,
+  const size_t& num_threads, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build fabric module graph");
 
   int status = CMD_EXEC_SUCCESS;
@@ -50,6 +52,23 @@ int build_device_module_graph(
   VTR_ASSERT(true ==
              openfpga_ctx.arch().circuit_lib.valid_model_id(sram_model));
 
+  /* Modules of the previous build can be reused only when the configuration
+   * protocol and the options of the builds are the same */
+  if (true == snapshot.is_enabled()) {
+    size_t build_fingerprint =
+      config_protocol_fingerprint(openfpga_ctx.arch().config_protocol);
+    fingerprint_combine(build_fingerprint, frame_view);
+    fingerprint_combine(build_fingerprint, compress_routing);
+    fingerprint_combine(build_fingerprint, duplicate_grid_pin);
+    fingerprint_combine(build_fingerprint, group_config_block);
+    fingerprint_combine(build_fingerprint, name_module_using_index);
+    fingerprint_combine(build_fingerprint, vpr_device_ctx.arch->perimeter_cb);
+    snapshot.start_build(build_fingerprint);
+    VTR_LOGV(verbose,
+             "Incremental build with %lu tasks from the previous build\n",
+             snapshot.num_previous_tasks());
+  }
+
   /* Add constant generator modules: VDD and GND */
   build_constant_generator_modules(module_manager);
 
@@ -85,31 +104,34 @@ int build_device_module_graph(
 
   /* Build grid and programmable block modules */
   status = build_grid_modules(
-    module_manager, decoder_lib, vpr_device_ctx,
+    module_manager, decoder_lib, snapshot, vpr_device_ctx,
     openfpga_ctx.vpr_device_annotation(), openfpga_ctx.arch().circuit_lib,
     openfpga_ctx.mux_lib(), openfpga_ctx.arch().tile_annotations,
     openfpga_ctx.arch().config_protocol.type(), sram_model,
     openfpga_ctx.arch().config_protocol.ql_memory_bank_config_setting(),
-    duplicate_grid_pin, group_config_block, verbose);
+    duplicate_grid_pin, group_config_block, num_threads, verbose);
   if (CMD_EXEC_FATAL_ERROR == status) {
     return status;
   }
 
   if (true == compress_routing) {
-    build_unique_routing_modules(module_manager, decoder_lib, vpr_device_ctx,
-                                 openfpga_ctx.vpr_device_annotation(),
-                                 openfpga_ctx.device_rr_gsb(),
-                                 openfpga_ctx.arch().circuit_lib,
-                                 openfpga_ctx.arch().config_protocol.type(),
-                                 sram_model, group_config_block, verbose);
+    status = build_unique_routing_modules(
+      module_manager, decoder_lib, snapshot, vpr_device_ctx,
+      openfpga_ctx.vpr_device_annotation(), openfpga_ctx.device_rr_gsb(),
+      openfpga_ctx.arch().circuit_lib,
+      openfpga_ctx.arch().config_protocol.type(), sram_model,
+      group_config_block, num_threads, verbose);
   } else {
     VTR_ASSERT_SAFE(false == compress_routing);
-    build_flatten_routing_modules(module_manager, decoder_lib, vpr_device_ctx,
-                                  openfpga_ctx.vpr_device_annotation(),
-                                  openfpga_ctx.device_rr_gsb(),
-                                  openfpga_ctx.arch().circuit_lib,
-                                  openfpga_ctx.arch().config_protocol.type(),
-                                  sram_model, group_config_block, verbose);
+    status = build_flatten_routing_modules(
+      module_manager, decoder_lib, snapshot, vpr_device_ctx,
+      openfpga_ctx.vpr_device_annotation(), openfpga_ctx.device_rr_gsb(),
+      openfpga_ctx.arch().circuit_lib,
+      openfpga_ctx.arch().config_protocol.type(), sram_model,
+      group_config_block, num_threads, verbose);
+  }
+  if (CMD_EXEC_FATAL_ERROR == status) {
+    return status;
   }
 
   /* Build tile modules if defined */
@@ -122,14 +144,23 @@ int build_device_module_graph(
       return status;
     }
     /* Build the modules */
-    build_tile_modules(
-      module_manager, decoder_lib, openfpga_ctx.fabric_tile(),
+    status = build_tile_modules(
+      module_manager, decoder_lib, snapshot, openfpga_ctx.fabric_tile(),
       vpr_device_ctx.grid, openfpga_ctx.vpr_device_annotation(),
       openfpga_ctx.device_rr_gsb(), vpr_device_ctx.rr_graph,
       openfpga_ctx.arch().tile_annotations, openfpga_ctx.arch().circuit_lib,
       sram_model, openfpga_ctx.arch().config_protocol.type(),
       name_module_using_index, vpr_device_ctx.arch->perimeter_cb, frame_view,
-      verbose);
+      num_threads, verbose);
+    if (CMD_EXEC_FATAL_ERROR == status) {
+      return status;
+    }
+  }
+
+  /* Modules under the top-level module are all built, which are the
+   * reference of next incremental build */
+  if (true == snapshot.is_enabled()) {
+    snapshot.finish_build();
   }
 
   /* Build FPGA fabric top-level module */
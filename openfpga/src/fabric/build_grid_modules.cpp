@@ -3,6 +3,7 @@
  * (CLBs, I/Os, heterogeneous blocks etc.)
  *******************************************************************/
 #include <ctime>
+#include <set>
 #include <vector>
 
 /* Headers from vtrutil library */
@@ -16,8 +17,10 @@
 #include "build_grid_module_duplicated_pins.h"
 #include "build_grid_module_utils.h"
 #include "build_grid_modules.h"
+#include "build_module_stages.h"
 #include "build_memory_modules.h"
 #include "circuit_library_utils.h"
+#include "fabric_build_fingerprint.h"
 #include "module_manager_utils.h"
 #include "openfpga_interconnect_types.h"
 #include "openfpga_naming.h"
@@ -1376,14 +1379,15 @@ static int build_physical_tile_module(
  ****************************************************************************/
 int build_grid_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  FabricBuildSnapshot& snapshot, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation,
   const CircuitLibrary& circuit_lib, const MuxLibrary& mux_lib,
   const TileAnnotation& tile_annotation,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model,
   const QLMemoryBankConfigSetting* ql_memory_bank_config_setting,
   const bool& duplicate_grid_pin, const bool& group_config_block,
-  const bool& verbose) {
+  const size_t& num_threads, const bool& verbose) {
   /* Start time count */
   vtr::ScopedStartFinishTimer timer("Build grid modules");
 
@@ -1397,65 +1401,100 @@ int build_grid_modules(
    * to its parent in module manager
    */
   /* Build modules starting from the top-level pb_type/pb_graph_node, and
-   * traverse the graph in a recursive way */
+   * traverse the graph in a recursive way.
+   * Logical tiles do not depend on each other, so each of them is a task
+   * which can be built by a dedicated thread */
   VTR_LOG("Building logical tiles...");
   VTR_LOGV(verbose, "\n");
+  std::vector<t_module_build_task> logical_tile_tasks;
   for (const t_logical_block_type& logical_tile :
        device_ctx.logical_block_types) {
     /* Bypass empty pb_graph */
     if (nullptr == logical_tile.pb_graph_head) {
       continue;
     }
-    rec_build_logical_tile_modules(
-      module_manager, decoder_lib, device_annotation, circuit_lib, mux_lib,
-      sram_orgz_type, sram_model, logical_tile.pb_graph_head,
-      group_config_block, verbose);
+    t_module_build_task task;
+    task.key =
+      generate_physical_block_module_name(logical_tile.pb_graph_head->pb_type);
+    task.fingerprint = [&]() {
+      return pb_type_fingerprint(device_annotation, circuit_lib,
+                                 logical_tile.pb_graph_head->pb_type);
+    };
+    task.build = [&](ModuleManager& curr_module_manager,
+                     DecoderLibrary& curr_decoder_lib) {
+      rec_build_logical_tile_modules(
+        curr_module_manager, curr_decoder_lib, device_annotation, circuit_lib,
+        mux_lib, sram_orgz_type, sram_model, logical_tile.pb_graph_head,
+        group_config_block, verbose);
+      return CMD_EXEC_SUCCESS;
+    };
+    logical_tile_tasks.push_back(task);
+  }
+  status = build_modules_in_stage(module_manager, decoder_lib, snapshot,
+                                  logical_tile_tasks,
+                                  std::string("logical tile modules"),
+                                  num_threads, verbose);
+  if (status != CMD_EXEC_SUCCESS) {
+    return CMD_EXEC_FATAL_ERROR;
   }
   VTR_LOG("Done\n");
 
   /* Enumerate the types of physical tiles
    * Use the logical tile module to build the physical tiles
+   * Physical tiles only depend on the logical tiles, which are built already.
+   * Each of them is a task which can be built by a dedicated thread
    */
   VTR_LOG("Building physical tiles...");
   VTR_LOGV(verbose, "\n");
+  std::vector<t_module_build_task> physical_tile_tasks;
   for (const t_physical_tile_type& physical_tile :
        device_ctx.physical_tile_types) {
     /* Bypass empty type or nullptr */
     if (true == is_empty_type(&physical_tile)) {
       continue;
-    } else if (true == is_io_type(&physical_tile)) {
-      /* Special for I/O block:
-       * We will search the grids and see where the I/O blocks are located:
-       * - If a I/O block locates on border sides of FPGA fabric:
-       *   i.e., one or more from {TOP, RIGHT, BOTTOM, LEFT},
-       *   we will generate one module for each border side
-       * - If a I/O block locates in the center of FPGA fabric:
-       *   we will generate one module with NUM_2D_SIDES (same treatment as
-       * regular grids)
-       */
-      std::set<e_side> io_type_sides =
+    }
+    /* Special for I/O block:
+     * We will search the grids and see where the I/O blocks are located:
+     * - If a I/O block locates on border sides of FPGA fabric:
+     *   i.e., one or more from {TOP, RIGHT, BOTTOM, LEFT},
+     *   we will generate one module for each border side
+     * - If a I/O block locates in the center of FPGA fabric:
+     *   we will generate one module with NUM_2D_SIDES (same treatment as
+     * regular grids)
+     * For CLB and heterogenenous blocks, a module is built with NUM_2D_SIDES
+     */
+    std::set<e_side> tile_sides = {NUM_2D_SIDES};
+    if (true == is_io_type(&physical_tile)) {
+      tile_sides =
         find_physical_io_tile_located_sides(device_ctx.grid, &physical_tile);
-      for (const e_side& io_type_side : io_type_sides) {
-        status = build_physical_tile_module(
-          module_manager, decoder_lib, device_annotation, circuit_lib,
-          sram_orgz_type, sram_model, &physical_tile, tile_annotation,
-          io_type_side, ql_memory_bank_config_setting, duplicate_grid_pin,
-          group_config_block, device_ctx.arch->perimeter_cb, verbose);
-        if (status != CMD_EXEC_SUCCESS) {
-          return CMD_EXEC_FATAL_ERROR;
-        }
-      }
-    } else {
-      /* For CLB and heterogenenous blocks */
-      status = build_physical_tile_module(
-        module_manager, decoder_lib, device_annotation, circuit_lib,
-        sram_orgz_type, sram_model, &physical_tile, tile_annotation,
-        NUM_2D_SIDES, ql_memory_bank_config_setting, duplicate_grid_pin,
-        group_config_block, device_ctx.arch->perimeter_cb, verbose);
-      if (status != CMD_EXEC_SUCCESS) {
-        return CMD_EXEC_FATAL_ERROR;
-      }
     }
+    for (const e_side& tile_side : tile_sides) {
+      t_module_build_task task;
+      task.key = generate_grid_block_module_name(
+        std::string(GRID_MODULE_NAME_PREFIX), std::string(physical_tile.name),
+        is_io_type(&physical_tile), tile_side);
+      task.fingerprint = [&, tile_side]() {
+        return physical_tile_fingerprint(tile_annotation, &physical_tile,
+                                         tile_side);
+      };
+      task.build = [&, tile_side](ModuleManager& curr_module_manager,
+                                  DecoderLibrary& curr_decoder_lib) {
+        return build_physical_tile_module(
+          curr_module_manager, curr_decoder_lib, device_annotation,
+          circuit_lib, sram_orgz_type, sram_model, &physical_tile,
+          tile_annotation, tile_side, ql_memory_bank_config_setting,
+          duplicate_grid_pin, group_config_block,
+          device_ctx.arch->perimeter_cb, verbose);
+      };
+      physical_tile_tasks.push_back(task);
+    }
+  }
+  status = build_modules_in_stage(module_manager, decoder_lib, snapshot,
+                                  physical_tile_tasks,
+                                  std::string("physical tile modules"),
+                                  num_threads, verbose);
+  if (status != CMD_EXEC_SUCCESS) {
+    return CMD_EXEC_FATAL_ERROR;
   }
   VTR_LOG("Done\n");
 
@@ -5,6 +5,7 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include "decoder_library.h"
+#include "fabric_build_snapshot.h"
 #include "module_manager.h"
 #include "mux_library.h"
 #include "ql_memory_bank_config_setting.h"
@@ -21,14 +22,15 @@ namespace openfpga {
 
 int build_grid_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  FabricBuildSnapshot& snapshot, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation,
   const CircuitLibrary& circuit_lib, const MuxLibrary& mux_lib,
   const TileAnnotation& tile_annotation,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model,
   const QLMemoryBankConfigSetting* ql_memory_bank_config_setting,
   const bool& duplicate_grid_pin, const bool& group_config_block,
-  const bool& verbose);
+  const size_t& num_threads, const bool& verbose);
 
 } /* end namespace openfpga */
 
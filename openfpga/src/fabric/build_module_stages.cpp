@@ -0,0 +1,305 @@
+/********************************************************************
+ * This file includes functions to build a group of independent modules
+ * (e.g., unique switch blocks, connection blocks, grids and tiles) in a
+ * staged way:
+ * - Stage 1: each module is built into a private module fragment, which is
+ *   a copy of the module manager at the beginning of the stage. Fragments
+ *   are built in parallel by worker threads
+ * - Stage 2: the modules of each fragment are committed to the module
+ *   manager in the order of tasks. Modules which are created by several
+ *   tasks (e.g., shared decoders) are deduplicated by their names
+ * The result is identical to building the modules one after another
+ * In addition, tasks can be reused from a previous build, see
+ * FabricBuildSnapshot for details
+ *******************************************************************/
+#include <algorithm>
+#include <string>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_thread_pool.h"
+
+/* Headers from openfpgashell library */
+#include "build_module_stages.h"
+#include "command_exit_codes.h"
+#include "fabric_build_fingerprint.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Bookkeeping of a task which is executed by a worker */
+struct t_module_build_task_record {
+  size_t worker = 0;
+  size_t module_begin = 0;
+  size_t module_end = 0;
+  size_t decoder_begin = 0;
+  size_t decoder_end = 0;
+  int status = CMD_EXEC_SUCCESS;
+};
+
+/********************************************************************
+ * Execute a task in the private module fragment of a worker. Each worker
+ * fetches task ids in an increasing order, so that a module/decoder is
+ * always created by the first task (in the order of tasks) requiring it
+ * among all the tasks of the worker. This is the key to reproduce the
+ * serial build when committing
+ *******************************************************************/
+static void run_module_build_task(
+  ModuleManager& fragment, DecoderLibrary& fragment_decoder_lib,
+  const t_module_build_task& task, const size_t& worker_id,
+  t_module_build_task_record& record) {
+  record.worker = worker_id;
+  record.module_begin = fragment.num_modules();
+  record.decoder_begin = fragment_decoder_lib.decoders().size();
+  record.status = task.build(fragment, fragment_decoder_lib);
+  record.module_end = fragment.num_modules();
+  record.decoder_end = fragment_decoder_lib.decoders().size();
+}
+
+/********************************************************************
+ * Summarize the interface and the contents of a module, i.e., its name,
+ * usage, ports, child instances and the number of nets. This is cheap
+ * enough to be computed for every base module of every worker
+ *******************************************************************/
+static size_t base_module_signature(const ModuleManager& module_manager,
+                                    const ModuleId& module) {
+  size_t signature = 0;
+  fingerprint_combine(signature, module_manager.module_name(module));
+  fingerprint_combine(signature, size_t(module_manager.module_usage(module)));
+  for (const ModulePortId& port : module_manager.module_ports(module)) {
+    const BasicPort& port_info = module_manager.module_port(module, port);
+    fingerprint_combine(signature, port_info.get_name());
+    fingerprint_combine(signature, port_info.get_width());
+    fingerprint_combine(signature,
+                        size_t(module_manager.port_type(module, port)));
+  }
+  for (const ModuleId& child : module_manager.child_modules(module)) {
+    fingerprint_combine(signature, size_t(child));
+    fingerprint_combine(signature, module_manager.num_instance(module, child));
+  }
+  fingerprint_combine(signature, module_manager.num_nets(module));
+  return signature;
+}
+
+/********************************************************************
+ * Check that no task has modified the modules which exist before the stage
+ * starts. The commit only imports the modules created by tasks, so any
+ * change on a base module in a fragment would be silently dropped and the
+ * result would differ from a serial build
+ *******************************************************************/
+static int check_base_modules(const ModuleManager& module_manager,
+                              const std::vector<ModuleManager>& fragments,
+                              const size_t& num_base_modules,
+                              const std::string& stage_name) {
+  std::vector<size_t> base_signatures(num_base_modules);
+  for (size_t imodule = 0; imodule < num_base_modules; ++imodule) {
+    base_signatures[imodule] =
+      base_module_signature(module_manager, ModuleId(imodule));
+  }
+
+  int status = CMD_EXEC_SUCCESS;
+  for (size_t iworker = 0; iworker < fragments.size(); ++iworker) {
+    for (size_t imodule = 0; imodule < num_base_modules; ++imodule) {
+      if (base_signatures[imodule] !=
+          base_module_signature(fragments[iworker], ModuleId(imodule))) {
+        VTR_LOG_ERROR(
+          "Module '%s' which exists before building %s is modified by a task "
+          "of thread %lu!\n",
+          module_manager.module_name(ModuleId(imodule)).c_str(),
+          stage_name.c_str(), iworker);
+        status = CMD_EXEC_FATAL_ERROR;
+      }
+    }
+  }
+  return status;
+}
+
+/********************************************************************
+ * Execute a subset of tasks. When more than one thread is requested,
+ * tasks are executed concurrently in private module fragments and then
+ * committed in a deterministic order. Otherwise, tasks are executed one by
+ * one on the module manager directly.
+ * The modules and decoders created by each task are stored in the given
+ * lists, which are indexed by task ids
+ *******************************************************************/
+static int execute_module_build_tasks(
+  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
+  const std::vector<t_module_build_task>& tasks,
+  const std::vector<size_t>& task_ids,
+  std::vector<std::vector<ModuleId>>& task_modules,
+  std::vector<std::vector<DecoderId>>& task_decoders,
+  const std::string& stage_name, const size_t& num_threads,
+  const bool& verbose) {
+  size_t num_workers = find_num_workers(num_threads, task_ids.size());
+
+  /* Serial build: nothing to stage */
+  if (1 == num_workers) {
+    for (const size_t& itask : task_ids) {
+      size_t module_begin = module_manager.num_modules();
+      size_t decoder_begin = decoder_lib.decoders().size();
+      if (CMD_EXEC_SUCCESS != tasks[itask].build(module_manager, decoder_lib)) {
+        return CMD_EXEC_FATAL_ERROR;
+      }
+      for (size_t imodule = module_begin;
+           imodule < module_manager.num_modules(); ++imodule) {
+        task_modules[itask].push_back(ModuleId(imodule));
+      }
+      for (size_t idecoder = decoder_begin;
+           idecoder < decoder_lib.decoders().size(); ++idecoder) {
+        task_decoders[itask].push_back(DecoderId(idecoder));
+      }
+    }
+    return CMD_EXEC_SUCCESS;
+  }
+
+  vtr::ScopedStartFinishTimer timer("Build " + stage_name + " with " +
+                                    std::to_string(num_workers) + " threads");
+
+  /* Stage 1: build modules in private fragments. Each worker copies the
+   * whole module manager and decoder library */
+  size_t num_base_modules = module_manager.num_modules();
+  VTR_LOGV(verbose, "Each of %lu threads copies %lu modules and %lu decoders\n",
+           num_workers, num_base_modules, decoder_lib.decoders().size());
+  std::vector<ModuleManager> fragments(num_workers, module_manager);
+  std::vector<DecoderLibrary> fragment_decoder_libs(num_workers, decoder_lib);
+  std::vector<t_module_build_task_record> records(task_ids.size());
+  run_parallel_jobs(
+    task_ids.size(), num_workers,
+    [&](const size_t& itask, const size_t& iworker) {
+      run_module_build_task(fragments[iworker], fragment_decoder_libs[iworker],
+                            tasks[task_ids[itask]], iworker, records[itask]);
+    });
+
+  for (const t_module_build_task_record& record : records) {
+    if (CMD_EXEC_SUCCESS != record.status) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+  }
+
+  if (CMD_EXEC_SUCCESS != check_base_modules(module_manager, fragments,
+                                             num_base_modules, stage_name)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Stage 2: commit the fragments in the order of tasks. The modules which
+   * exist before the stage keep their ids in every fragment */
+  std::vector<vtr::vector<ModuleId, ModuleId>> module_maps(num_workers);
+  for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+    module_maps[iworker].resize(fragments[iworker].num_modules(),
+                                ModuleId::INVALID());
+    for (size_t imodule = 0; imodule < num_base_modules; ++imodule) {
+      module_maps[iworker][ModuleId(imodule)] = ModuleId(imodule);
+    }
+  }
+
+  size_t num_committed_modules = 0;
+  for (size_t irecord = 0; irecord < records.size(); ++irecord) {
+    const t_module_build_task_record& record = records[irecord];
+    size_t itask = task_ids[irecord];
+    const ModuleManager& fragment = fragments[record.worker];
+    vtr::vector<ModuleId, ModuleId>& module_map = module_maps[record.worker];
+    for (size_t imodule = record.module_begin; imodule < record.module_end;
+         ++imodule) {
+      ModuleId src_module = ModuleId(imodule);
+      ModuleId curr_module =
+        module_manager.find_module(fragment.module_name(src_module));
+      if (!curr_module) {
+        curr_module =
+          module_manager.import_module(fragment, src_module, module_map);
+        task_modules[itask].push_back(curr_module);
+        num_committed_modules++;
+      }
+      VTR_ASSERT(module_manager.valid_module_id(curr_module));
+      module_map[src_module] = curr_module;
+    }
+
+    const DecoderLibrary& fragment_decoder_lib =
+      fragment_decoder_libs[record.worker];
+    for (size_t idecoder = record.decoder_begin;
+         idecoder < record.decoder_end; ++idecoder) {
+      DecoderId src_decoder = DecoderId(idecoder);
+      size_t addr_size = fragment_decoder_lib.addr_size(src_decoder);
+      size_t data_size = fragment_decoder_lib.data_size(src_decoder);
+      bool use_enable = fragment_decoder_lib.use_enable(src_decoder);
+      bool use_data_in = fragment_decoder_lib.use_data_in(src_decoder);
+      bool use_data_inv_port =
+        fragment_decoder_lib.use_data_inv_port(src_decoder);
+      bool use_readback = fragment_decoder_lib.use_readback(src_decoder);
+      if (!decoder_lib.find_decoder(addr_size, data_size, use_enable,
+                                    use_data_in, use_data_inv_port,
+                                    use_readback)) {
+        task_decoders[itask].push_back(decoder_lib.add_decoder(
+          addr_size, data_size, use_enable, use_data_in, use_data_inv_port,
+          use_readback));
+      }
+    }
+  }
+
+  VTR_LOGV(verbose, "Committed %lu modules from %lu tasks of %s\n",
+           num_committed_modules, task_ids.size(), stage_name.c_str());
+
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Build a group of independent modules.
+ * When incremental build is enabled, tasks whose inputs are not changed
+ * since the previous build are reused from the snapshot, and the other tasks
+ * are executed. Then, all the tasks are recorded for the next build.
+ * Note that each worker owns a full copy of the module manager, which is
+ * the price to pay for lock-free module construction
+ *******************************************************************/
+int build_modules_in_stage(ModuleManager& module_manager,
+                           DecoderLibrary& decoder_lib,
+                           FabricBuildSnapshot& snapshot,
+                           const std::vector<t_module_build_task>& tasks,
+                           const std::string& stage_name,
+                           const size_t& num_threads, const bool& verbose) {
+  std::vector<size_t> fingerprints(tasks.size(), 0);
+  std::vector<std::vector<ModuleId>> task_modules(tasks.size());
+  std::vector<std::vector<DecoderId>> task_decoders(tasks.size());
+
+  /* Reuse the tasks from the previous build when possible */
+  std::vector<size_t> task_ids;
+  task_ids.reserve(tasks.size());
+  for (size_t itask = 0; itask < tasks.size(); ++itask) {
+    if (true == snapshot.is_enabled()) {
+      fingerprints[itask] = tasks[itask].fingerprint();
+      if (true == snapshot.reuse_task(
+                    tasks[itask].key, fingerprints[itask], module_manager,
+                    decoder_lib, task_modules[itask], task_decoders[itask])) {
+        continue;
+      }
+    }
+    task_ids.push_back(itask);
+  }
+  if (true == snapshot.is_enabled()) {
+    VTR_LOGV(verbose, "Reused %lu out of %lu tasks of %s\n",
+             tasks.size() - task_ids.size(), tasks.size(),
+             stage_name.c_str());
+  }
+
+  int status = execute_module_build_tasks(
+    module_manager, decoder_lib, tasks, task_ids, task_modules, task_decoders,
+    stage_name, num_threads, verbose);
+  if (CMD_EXEC_SUCCESS != status) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Record all the tasks for the next build */
+  if (true == snapshot.is_enabled()) {
+    for (size_t itask = 0; itask < tasks.size(); ++itask) {
+      snapshot.record_task(tasks[itask].key, fingerprints[itask],
+                           module_manager, task_modules[itask], decoder_lib,
+                           task_decoders[itask]);
+    }
+  }
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,52 @@
+#ifndef BUILD_MODULE_STAGES_H
+#define BUILD_MODULE_STAGES_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "decoder_library.h"
+#include "fabric_build_snapshot.h"
+#include "module_manager.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* A task builds one (or a few) unique modules, e.g., a switch block, into
+ * the given module manager and decoder library. A task may only read the
+ * modules which exist before the stage starts and the modules it creates
+ * itself. It must never modify the modules which exist before the stage
+ * starts (no new ports, children, nets or usage), since only the modules
+ * created by tasks are committed when several threads are used. Such
+ * modifications are detected and reported as errors.
+ * Return CMD_EXEC_SUCCESS or CMD_EXEC_FATAL_ERROR */
+typedef std::function<int(ModuleManager&, DecoderLibrary&)> ModuleBuildTask;
+
+/* A task along with the information required by incremental builds:
+ * - key: a name which identifies the task across builds
+ * - fingerprint: computes the fingerprint of the task inputs, except the
+ *   modules it depends on, which are checked by FabricBuildSnapshot.
+ *   Only called when incremental build is enabled */
+struct t_module_build_task {
+  std::string key;
+  std::function<size_t()> fingerprint;
+  ModuleBuildTask build;
+};
+
+int build_modules_in_stage(ModuleManager& module_manager,
+                           DecoderLibrary& decoder_lib,
+                           FabricBuildSnapshot& snapshot,
+                           const std::vector<t_module_build_task>& tasks,
+                           const std::string& stage_name,
+                           const size_t& num_threads, const bool& verbose);
+
+} /* end namespace openfpga */
+
+#endif
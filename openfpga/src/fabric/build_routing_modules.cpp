@@ -16,8 +16,11 @@
 /* Headers from openfpgautil library */
 #include "build_memory_modules.h"
 #include "build_module_graph_utils.h"
+#include "build_module_stages.h"
 #include "build_routing_module_utils.h"
 #include "build_routing_modules.h"
+#include "command_exit_codes.h"
+#include "fabric_build_fingerprint.h"
 #include "module_manager_utils.h"
 #include "openfpga_naming.h"
 #include "openfpga_reserved_words.h"
@@ -1139,12 +1142,12 @@ static void build_connection_block_module(
 }
 
 /********************************************************************
- * Iterate over all the connection blocks in a device
- * and build a module for each of them
+ * Create a task for each connection block in a device, which builds a
+ * module for the connection block
  *******************************************************************/
-static void build_flatten_connection_block_modules(
-  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+static void add_flatten_connection_block_module_tasks(
+  std::vector<t_module_build_task>& tasks, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation,
   const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const t_rr_type& cb_type,
@@ -1162,10 +1165,23 @@ static void build_flatten_connection_block_modules(
       if (false == rr_gsb.is_cb_exist(cb_type)) {
         continue;
       }
-      build_connection_block_module(
-        module_manager, decoder_lib, device_annotation, device_ctx.grid,
-        device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model,
-        device_rr_gsb, rr_gsb, cb_type, group_config_block, verbose);
+      t_module_build_task task;
+      task.key = generate_connection_block_module_name(
+        cb_type, vtr::Point<size_t>(rr_gsb.get_cb_x(cb_type),
+                                    rr_gsb.get_cb_y(cb_type)));
+      task.fingerprint = [&]() {
+        return rr_gsb_fingerprint(device_ctx.rr_graph, device_annotation,
+                                  circuit_lib, rr_gsb);
+      };
+      task.build = [&, cb_type](ModuleManager& module_manager,
+                                DecoderLibrary& decoder_lib) {
+        build_connection_block_module(
+          module_manager, decoder_lib, device_annotation, device_ctx.grid,
+          device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model,
+          device_rr_gsb, rr_gsb, cb_type, group_config_block, verbose);
+        return CMD_EXEC_SUCCESS;
+      };
+      tasks.push_back(task);
     }
   }
 }
@@ -1178,18 +1194,23 @@ static void build_flatten_connection_block_modules(
  * Covering:
  * 1. Connection blocks
  * 2. Switch blocks
+ * Modules are independent from each other, so they can be built by
+ * multiple threads. See build_modules_in_stage() for details
  *******************************************************************/
-void build_flatten_routing_modules(
+int build_flatten_routing_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  FabricBuildSnapshot& snapshot, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation,
   const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const bool& group_config_block,
-  const bool& verbose) {
+  const size_t& num_threads, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build routing modules...");
 
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
 
+  std::vector<t_module_build_task> tasks;
+
   /* Build unique switch block modules */
   for (size_t ix = 0; ix < sb_range.x(); ++ix) {
     for (size_t iy = 0; iy < sb_range.y(); ++iy) {
@@ -1197,22 +1218,36 @@ void build_flatten_routing_modules(
       if (false == rr_gsb.is_sb_exist(device_ctx.rr_graph)) {
         continue;
       }
-      build_switch_block_module(
-        module_manager, decoder_lib, device_annotation, device_ctx.grid,
-        device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model,
-        device_rr_gsb, rr_gsb, group_config_block, verbose);
+      t_module_build_task task;
+      task.key = generate_switch_block_module_name(
+        vtr::Point<size_t>(rr_gsb.get_sb_x(), rr_gsb.get_sb_y()));
+      task.fingerprint = [&]() {
+        return rr_gsb_fingerprint(device_ctx.rr_graph, device_annotation,
+                                  circuit_lib, rr_gsb);
+      };
+      task.build = [&](ModuleManager& curr_module_manager,
+                       DecoderLibrary& curr_decoder_lib) {
+        build_switch_block_module(
+          curr_module_manager, curr_decoder_lib, device_annotation,
+          device_ctx.grid, device_ctx.rr_graph, circuit_lib, sram_orgz_type,
+          sram_model, device_rr_gsb, rr_gsb, group_config_block, verbose);
+        return CMD_EXEC_SUCCESS;
+      };
+      tasks.push_back(task);
     }
   }
 
-  build_flatten_connection_block_modules(
-    module_manager, decoder_lib, device_ctx, device_annotation, device_rr_gsb,
-    circuit_lib, sram_orgz_type, sram_model, CHANX, group_config_block,
-    verbose);
+  add_flatten_connection_block_module_tasks(
+    tasks, device_ctx, device_annotation, device_rr_gsb, circuit_lib,
+    sram_orgz_type, sram_model, CHANX, group_config_block, verbose);
+
+  add_flatten_connection_block_module_tasks(
+    tasks, device_ctx, device_annotation, device_rr_gsb, circuit_lib,
+    sram_orgz_type, sram_model, CHANY, group_config_block, verbose);
 
-  build_flatten_connection_block_modules(
-    module_manager, decoder_lib, device_ctx, device_annotation, device_rr_gsb,
-    circuit_lib, sram_orgz_type, sram_model, CHANY, group_config_block,
-    verbose);
+  return build_modules_in_stage(module_manager, decoder_lib, snapshot, tasks,
+                                std::string("routing modules"), num_threads,
+                                verbose);
 }
 
 /********************************************************************
@@ -1222,49 +1257,75 @@ void build_flatten_routing_modules(
  * to build only unique modules (in terms of graph connections) of
  * 1. Connection blocks
  * 2. Switch blocks
+ * Modules are independent from each other, so they can be built by
+ * multiple threads. See build_modules_in_stage() for details
  *
  * Note: this function SHOULD be called only when
  * the option compact_routing_hierarchy is turned on!!!
  *******************************************************************/
-void build_unique_routing_modules(
+int build_unique_routing_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  FabricBuildSnapshot& snapshot, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation,
   const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const bool& group_config_block,
-  const bool& verbose) {
+  const size_t& num_threads, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build unique routing modules...");
 
+  std::vector<t_module_build_task> tasks;
+
   /* Build unique switch block modules */
   for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
     const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
-    build_switch_block_module(module_manager, decoder_lib, device_annotation,
-                              device_ctx.grid, device_ctx.rr_graph, circuit_lib,
-                              sram_orgz_type, sram_model, device_rr_gsb,
-                              unique_mirror, group_config_block, verbose);
+    t_module_build_task task;
+    task.key = generate_switch_block_module_name(
+      vtr::Point<size_t>(unique_mirror.get_sb_x(), unique_mirror.get_sb_y()));
+    task.fingerprint = [&]() {
+      return rr_gsb_fingerprint(device_ctx.rr_graph, device_annotation,
+                                circuit_lib, unique_mirror);
+    };
+    task.build = [&](ModuleManager& curr_module_manager,
+                     DecoderLibrary& curr_decoder_lib) {
+      build_switch_block_module(
+        curr_module_manager, curr_decoder_lib, device_annotation,
+        device_ctx.grid, device_ctx.rr_graph, circuit_lib, sram_orgz_type,
+        sram_model, device_rr_gsb, unique_mirror, group_config_block, verbose);
+      return CMD_EXEC_SUCCESS;
+    };
+    tasks.push_back(task);
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANX);
-       ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANX, icb);
-
-    build_connection_block_module(
-      module_manager, decoder_lib, device_annotation, device_ctx.grid,
-      device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model,
-      device_rr_gsb, unique_mirror, CHANX, group_config_block, verbose);
+  /* Build unique X-direction and Y-direction connection block modules */
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(cb_type);
+         ++icb) {
+      const RRGSB& unique_mirror =
+        device_rr_gsb.get_cb_unique_module(cb_type, icb);
+      t_module_build_task task;
+      task.key = generate_connection_block_module_name(
+        cb_type, vtr::Point<size_t>(unique_mirror.get_cb_x(cb_type),
+                                    unique_mirror.get_cb_y(cb_type)));
+      task.fingerprint = [&]() {
+        return rr_gsb_fingerprint(device_ctx.rr_graph, device_annotation,
+                                  circuit_lib, unique_mirror);
+      };
+      task.build = [&, cb_type](ModuleManager& curr_module_manager,
+                                DecoderLibrary& curr_decoder_lib) {
+        build_connection_block_module(
+          curr_module_manager, curr_decoder_lib, device_annotation,
+          device_ctx.grid, device_ctx.rr_graph, circuit_lib, sram_orgz_type,
+          sram_model, device_rr_gsb, unique_mirror, cb_type,
+          group_config_block, verbose);
+        return CMD_EXEC_SUCCESS;
+      };
+      tasks.push_back(task);
+    }
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANY);
-       ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANY, icb);
-
-    build_connection_block_module(
-      module_manager, decoder_lib, device_annotation, device_ctx.grid,
-      device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model,
-      device_rr_gsb, unique_mirror, CHANY, group_config_block, verbose);
-  }
+  return build_modules_in_stage(module_manager, decoder_lib, snapshot, tasks,
+                                std::string("unique routing modules"),
+                                num_threads, verbose);
 }
 
 } /* end namespace openfpga */
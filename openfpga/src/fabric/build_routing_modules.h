@@ -7,6 +7,7 @@
 #include "circuit_library.h"
 #include "decoder_library.h"
 #include "device_rr_gsb.h"
+#include "fabric_build_snapshot.h"
 #include "module_manager.h"
 #include "mux_library.h"
 #include "vpr_context.h"
@@ -19,21 +20,23 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-void build_flatten_routing_modules(
+int build_flatten_routing_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  FabricBuildSnapshot& snapshot, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation,
   const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const bool& group_config_block,
-  const bool& verbose);
+  const size_t& num_threads, const bool& verbose);
 
-void build_unique_routing_modules(
+int build_unique_routing_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  FabricBuildSnapshot& snapshot, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation,
   const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const bool& group_config_block,
-  const bool& verbose);
+  const size_t& num_threads, const bool& verbose);
 
 } /* end namespace openfpga */
 
@@ -8,11 +8,15 @@
 
 #include <algorithm>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "build_grid_module_utils.h"
+#include "build_module_stages.h"
 #include "build_routing_module_utils.h"
 #include "build_top_module_utils.h"
 #include "command_exit_codes.h"
+#include "fabric_build_fingerprint.h"
 #include "module_manager_utils.h"
 #include "openfpga_device_grid_utils.h"
 #include "openfpga_naming.h"
@@ -1701,30 +1705,46 @@ static int build_tile_module(
  *******************************************************************/
 int build_tile_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const FabricTile& fabric_tile, const DeviceGrid& grids,
-  const VprDeviceAnnotation& vpr_device_annotation,
+  FabricBuildSnapshot& snapshot, const FabricTile& fabric_tile,
+  const DeviceGrid& grids, const VprDeviceAnnotation& vpr_device_annotation,
   const DeviceRRGSB& device_rr_gsb, const RRGraphView& rr_graph_view,
   const TileAnnotation& tile_annotation, const CircuitLibrary& circuit_lib,
   const CircuitModelId& sram_model,
   const e_config_protocol_type& sram_orgz_type,
   const bool& name_module_using_index, const bool& perimeter_cb,
-  const bool& frame_view, const bool& verbose) {
+  const bool& frame_view, const size_t& num_threads, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build tile modules for the FPGA fabric");
 
   int status_code = CMD_EXEC_SUCCESS;
 
   size_t layer = 0;
 
-  /* Build a module for each unique tile  */
+  /* Build a module for each unique tile. Tiles only depend on the grid and
+   * routing modules, which are built already. Therefore, each of them is a
+   * task which can be built by a dedicated thread */
+  std::vector<t_module_build_task> tasks;
   for (FabricTileId fabric_tile_id : fabric_tile.unique_tiles()) {
-    status_code = build_tile_module(
-      module_manager, decoder_lib, fabric_tile, fabric_tile_id, grids, layer,
-      vpr_device_annotation, device_rr_gsb, rr_graph_view, tile_annotation,
-      circuit_lib, sram_model, sram_orgz_type, name_module_using_index,
-      perimeter_cb, frame_view, verbose);
-    if (status_code != CMD_EXEC_SUCCESS) {
-      return CMD_EXEC_FATAL_ERROR;
-    }
+    t_module_build_task task;
+    task.key =
+      generate_tile_module_name(fabric_tile.tile_coordinate(fabric_tile_id));
+    task.fingerprint = [&, fabric_tile_id]() {
+      return fabric_tile_fingerprint(fabric_tile, fabric_tile_id);
+    };
+    task.build = [&, fabric_tile_id](ModuleManager& curr_module_manager,
+                                     DecoderLibrary& curr_decoder_lib) {
+      return build_tile_module(
+        curr_module_manager, curr_decoder_lib, fabric_tile, fabric_tile_id,
+        grids, layer, vpr_device_annotation, device_rr_gsb, rr_graph_view,
+        tile_annotation, circuit_lib, sram_model, sram_orgz_type,
+        name_module_using_index, perimeter_cb, frame_view, verbose);
+    };
+    tasks.push_back(task);
+  }
+  status_code =
+    build_modules_in_stage(module_manager, decoder_lib, snapshot, tasks,
+                           std::string("tile modules"), num_threads, verbose);
+  if (status_code != CMD_EXEC_SUCCESS) {
+    return CMD_EXEC_FATAL_ERROR;
   }
 
   return status_code;
@@ -12,6 +12,7 @@
 #include "decoder_library.h"
 #include "device_grid.h"
 #include "device_rr_gsb.h"
+#include "fabric_build_snapshot.h"
 #include "fabric_tile.h"
 #include "module_manager.h"
 #include "rr_graph_view.h"
@@ -27,14 +28,14 @@ namespace openfpga {
 
 int build_tile_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const FabricTile& fabric_tile, const DeviceGrid& grids,
-  const VprDeviceAnnotation& vpr_device_annotation,
+  FabricBuildSnapshot& snapshot, const FabricTile& fabric_tile,
+  const DeviceGrid& grids, const VprDeviceAnnotation& vpr_device_annotation,
   const DeviceRRGSB& device_rr_gsb, const RRGraphView& rr_graph_view,
   const TileAnnotation& tile_annotation, const CircuitLibrary& circuit_lib,
   const CircuitModelId& sram_model,
   const e_config_protocol_type& sram_orgz_type,
   const bool& name_module_using_index, const bool& perimeter_cb,
-  const bool& frame_view, const bool& verbose);
+  const bool& frame_view, const size_t& num_threads, const bool& verbose);
 
 } /* end namespace openfpga */
 
@@ -0,0 +1,350 @@
+/********************************************************************
+ * This file includes functions to compute fingerprints of the inputs
+ * of fabric modules, which are used by incremental fabric builds to
+ * detect which modules are not impacted by architecture changes.
+ * A fingerprint is a hash value: two different fingerprints guarantee that
+ * the inputs are different, while two equal fingerprints mean that the
+ * inputs are the same (with a negligible chance of hash collision)
+ *******************************************************************/
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+
+/* Headers from openfpgautil library */
+#include "fabric_build_fingerprint.h"
+#include "openfpga_side_manager.h"
+#include "pb_type_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * Fingerprint the name of a circuit model, which is stable across
+ * architecture reloads, unlike the id of a circuit model
+ *******************************************************************/
+static void fingerprint_circuit_model(size_t& fingerprint,
+                                      const CircuitLibrary& circuit_lib,
+                                      const CircuitModelId& circuit_model) {
+  if (false == circuit_lib.valid_model_id(circuit_model)) {
+    fingerprint_combine(fingerprint, std::string());
+    return;
+  }
+  fingerprint_combine(fingerprint, circuit_lib.model_name(circuit_model));
+}
+
+/********************************************************************
+ * Fingerprint a string of VPR architecture data structures, which may be
+ * a null pointer when it is not specified in the architecture
+ *******************************************************************/
+static void fingerprint_c_string(size_t& fingerprint, const char* c_string) {
+  if (nullptr == c_string) {
+    fingerprint_combine(fingerprint, std::string());
+    return;
+  }
+  fingerprint_combine(fingerprint, std::string(c_string));
+}
+
+/********************************************************************
+ * Fingerprint the content of a module, including
+ * - its ports
+ * - its child modules and their instance names
+ * - its configurable children
+ * - its nets
+ * Child modules are referred by names, so that fingerprints of modules
+ * in different module managers can be compared
+ *******************************************************************/
+size_t module_content_fingerprint(const ModuleManager& module_manager,
+                                  const ModuleId& module) {
+  VTR_ASSERT(module_manager.valid_module_id(module));
+
+  size_t fingerprint = 0;
+  fingerprint_combine(fingerprint, module_manager.module_name(module));
+  fingerprint_combine(fingerprint,
+                      size_t(module_manager.module_usage(module)));
+
+  for (const ModulePortId& port : module_manager.module_ports(module)) {
+    const BasicPort& port_info = module_manager.module_port(module, port);
+    fingerprint_combine(fingerprint, port_info.get_name());
+    fingerprint_combine(fingerprint, port_info.get_lsb());
+    fingerprint_combine(fingerprint, port_info.get_msb());
+    fingerprint_combine(fingerprint,
+                        size_t(module_manager.port_type(module, port)));
+  }
+
+  for (const ModuleId& child : module_manager.child_modules(module)) {
+    fingerprint_combine(fingerprint, module_manager.module_name(child));
+    size_t num_instances = module_manager.num_instance(module, child);
+    fingerprint_combine(fingerprint, num_instances);
+    for (size_t inst = 0; inst < num_instances; ++inst) {
+      fingerprint_combine(fingerprint,
+                          module_manager.instance_name(module, child, inst));
+    }
+  }
+
+  for (const ModuleManager::e_config_child_type& config_child_type :
+       {ModuleManager::e_config_child_type::LOGICAL,
+        ModuleManager::e_config_child_type::PHYSICAL}) {
+    std::vector<ModuleId> config_children =
+      module_manager.configurable_children(module, config_child_type);
+    std::vector<size_t> config_child_instances =
+      module_manager.configurable_child_instances(module, config_child_type);
+    for (size_t ichild = 0; ichild < config_children.size(); ++ichild) {
+      fingerprint_combine(fingerprint,
+                          module_manager.module_name(config_children[ichild]));
+      fingerprint_combine(fingerprint, config_child_instances[ichild]);
+    }
+  }
+
+  for (const ModuleNetId& net : module_manager.module_nets(module)) {
+    fingerprint_combine(fingerprint, module_manager.net_name(module, net));
+    auto src_modules = module_manager.net_source_modules(module, net);
+    auto src_instances = module_manager.net_source_instances(module, net);
+    auto src_ports = module_manager.net_source_ports(module, net);
+    auto src_pins = module_manager.net_source_pins(module, net);
+    for (const ModuleNetSrcId& src :
+         module_manager.module_net_sources(module, net)) {
+      fingerprint_combine(fingerprint,
+                          module_manager.module_name(src_modules[src]));
+      fingerprint_combine(fingerprint, src_instances[src]);
+      fingerprint_combine(fingerprint, size_t(src_ports[src]));
+      fingerprint_combine(fingerprint, src_pins[src]);
+    }
+    auto sink_modules = module_manager.net_sink_modules(module, net);
+    auto sink_instances = module_manager.net_sink_instances(module, net);
+    auto sink_ports = module_manager.net_sink_ports(module, net);
+    auto sink_pins = module_manager.net_sink_pins(module, net);
+    for (const ModuleNetSinkId& sink :
+         module_manager.module_net_sinks(module, net)) {
+      fingerprint_combine(fingerprint,
+                          module_manager.module_name(sink_modules[sink]));
+      fingerprint_combine(fingerprint, sink_instances[sink]);
+      fingerprint_combine(fingerprint, size_t(sink_ports[sink]));
+      fingerprint_combine(fingerprint, sink_pins[sink]);
+    }
+  }
+
+  return fingerprint;
+}
+
+/********************************************************************
+ * Fingerprint the configuration protocol, which impacts the memory
+ * organization of almost every configurable module
+ *******************************************************************/
+size_t config_protocol_fingerprint(const ConfigProtocol& config_protocol) {
+  size_t fingerprint = 0;
+  fingerprint_combine(fingerprint, size_t(config_protocol.type()));
+  fingerprint_combine(fingerprint, config_protocol.memory_model_name());
+  fingerprint_combine(fingerprint, config_protocol.num_regions());
+  fingerprint_combine(fingerprint, config_protocol.num_prog_clocks());
+  fingerprint_combine(fingerprint, size_t(config_protocol.bl_protocol_type()));
+  fingerprint_combine(fingerprint, config_protocol.bl_memory_model_name());
+  fingerprint_combine(fingerprint, config_protocol.bl_num_banks());
+  fingerprint_combine(fingerprint, size_t(config_protocol.wl_protocol_type()));
+  fingerprint_combine(fingerprint, config_protocol.wl_memory_model_name());
+  fingerprint_combine(fingerprint, config_protocol.wl_num_banks());
+  return fingerprint;
+}
+
+/********************************************************************
+ * Fingerprint a General Switch Block (GSB), including
+ * - the routing tracks, input and output pins on each side
+ * - the drivers of each routing track and input pin
+ * - the circuit models of routing segments and switches
+ *******************************************************************/
+size_t rr_gsb_fingerprint(const RRGraphView& rr_graph,
+                          const VprDeviceAnnotation& device_annotation,
+                          const CircuitLibrary& circuit_lib,
+                          const RRGSB& rr_gsb) {
+  size_t fingerprint = 0;
+  fingerprint_combine(fingerprint, rr_gsb.get_x());
+  fingerprint_combine(fingerprint, rr_gsb.get_y());
+
+  for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
+    SideManager side_manager(side);
+    e_side gsb_side = side_manager.get_side();
+
+    fingerprint_combine(fingerprint, rr_gsb.get_chan_width(gsb_side));
+    for (size_t itrack = 0; itrack < rr_gsb.get_chan_width(gsb_side);
+         ++itrack) {
+      fingerprint_combine(fingerprint,
+                          size_t(rr_gsb.get_chan_node(gsb_side, itrack)));
+      fingerprint_combine(
+        fingerprint, size_t(rr_gsb.get_chan_node_direction(gsb_side, itrack)));
+      fingerprint_circuit_model(
+        fingerprint, circuit_lib,
+        device_annotation.rr_segment_circuit_model(
+          rr_gsb.get_chan_node_segment(gsb_side, itrack)));
+      for (const RREdgeId& edge :
+           rr_gsb.get_chan_node_in_edges(rr_graph, gsb_side, itrack)) {
+        fingerprint_combine(fingerprint, size_t(rr_graph.edge_src_node(edge)));
+        fingerprint_circuit_model(fingerprint, circuit_lib,
+                                  device_annotation.rr_switch_circuit_model(
+                                    RRSwitchId(rr_graph.edge_switch(edge))));
+      }
+    }
+
+    fingerprint_combine(fingerprint, rr_gsb.get_num_ipin_nodes(gsb_side));
+    for (size_t inode = 0; inode < rr_gsb.get_num_ipin_nodes(gsb_side);
+         ++inode) {
+      fingerprint_combine(fingerprint,
+                          size_t(rr_gsb.get_ipin_node(gsb_side, inode)));
+      for (const RREdgeId& edge :
+           rr_gsb.get_ipin_node_in_edges(rr_graph, gsb_side, inode)) {
+        fingerprint_combine(fingerprint, size_t(rr_graph.edge_src_node(edge)));
+        fingerprint_circuit_model(fingerprint, circuit_lib,
+                                  device_annotation.rr_switch_circuit_model(
+                                    RRSwitchId(rr_graph.edge_switch(edge))));
+      }
+    }
+
+    fingerprint_combine(fingerprint, rr_gsb.get_num_opin_nodes(gsb_side));
+    for (size_t inode = 0; inode < rr_gsb.get_num_opin_nodes(gsb_side);
+         ++inode) {
+      fingerprint_combine(fingerprint,
+                          size_t(rr_gsb.get_opin_node(gsb_side, inode)));
+    }
+  }
+
+  return fingerprint;
+}
+
+/********************************************************************
+ * Fingerprint a pb_type and all its physical children in a recursive way,
+ * including
+ * - the ports of each pb_type, e.g., their types and port classes
+ * - the interconnects of each physical mode, e.g., their types and the
+ *   pins they connect
+ * - the pb_type annotations (physical modes, circuit models of primitives
+ *   and interconnects)
+ *******************************************************************/
+size_t pb_type_fingerprint(const VprDeviceAnnotation& device_annotation,
+                           const CircuitLibrary& circuit_lib,
+                           t_pb_type* pb_type) {
+  size_t fingerprint = 0;
+  fingerprint_combine(fingerprint, std::string(pb_type->name));
+  fingerprint_combine(fingerprint, pb_type->num_pb);
+  fingerprint_c_string(fingerprint, pb_type->blif_model);
+  fingerprint_combine(fingerprint, size_t(pb_type->class_type));
+  for (int iport = 0; iport < pb_type->num_ports; ++iport) {
+    const t_port& pb_port = pb_type->ports[iport];
+    fingerprint_combine(fingerprint, std::string(pb_port.name));
+    fingerprint_combine(fingerprint, pb_port.num_pins);
+    fingerprint_combine(fingerprint, size_t(pb_port.type));
+    fingerprint_combine(fingerprint, pb_port.is_clock);
+    fingerprint_combine(fingerprint, size_t(pb_port.equivalent));
+    fingerprint_c_string(fingerprint, pb_port.port_class);
+  }
+
+  if (true == is_primitive_pb_type(pb_type)) {
+    fingerprint_circuit_model(
+      fingerprint, circuit_lib,
+      device_annotation.pb_type_circuit_model(pb_type));
+    for (const size_t& mode_bit :
+         device_annotation.pb_type_mode_bits(pb_type)) {
+      fingerprint_combine(fingerprint, mode_bit);
+    }
+    return fingerprint;
+  }
+
+  t_mode* physical_mode = device_annotation.physical_mode(pb_type);
+  if (nullptr == physical_mode) {
+    return fingerprint;
+  }
+  fingerprint_combine(fingerprint, std::string(physical_mode->name));
+  for (int interc = 0; interc < physical_mode->num_interconnect; ++interc) {
+    t_interconnect* pb_interc = &(physical_mode->interconnect[interc]);
+    fingerprint_combine(fingerprint, std::string(pb_interc->name));
+    fingerprint_combine(fingerprint, size_t(pb_interc->type));
+    fingerprint_c_string(fingerprint, pb_interc->input_string);
+    fingerprint_c_string(fingerprint, pb_interc->output_string);
+    fingerprint_combine(
+      fingerprint,
+      size_t(device_annotation.interconnect_physical_type(pb_interc)));
+    fingerprint_circuit_model(
+      fingerprint, circuit_lib,
+      device_annotation.interconnect_circuit_model(pb_interc));
+  }
+  for (int ichild = 0; ichild < physical_mode->num_pb_type_children;
+       ++ichild) {
+    fingerprint_combine(
+      fingerprint,
+      pb_type_fingerprint(device_annotation, circuit_lib,
+                          &(physical_mode->pb_type_children[ichild])));
+  }
+
+  return fingerprint;
+}
+
+/********************************************************************
+ * Fingerprint a physical tile at a given border side, including the tile
+ * annotations (global ports and merged ports) related to the tile
+ *******************************************************************/
+size_t physical_tile_fingerprint(const TileAnnotation& tile_annotation,
+                                 t_physical_tile_type_ptr phy_block_type,
+                                 const e_side& border_side) {
+  std::string tile_name(phy_block_type->name);
+
+  size_t fingerprint = 0;
+  fingerprint_combine(fingerprint, tile_name);
+  fingerprint_combine(fingerprint, size_t(border_side));
+
+  for (const TileGlobalPortId& global_port : tile_annotation.global_ports()) {
+    std::vector<std::string> port_tile_names =
+      tile_annotation.global_port_tile_names(global_port);
+    std::vector<BasicPort> port_tile_ports =
+      tile_annotation.global_port_tile_ports(global_port);
+    for (size_t itile = 0; itile < port_tile_names.size(); ++itile) {
+      if (tile_name != port_tile_names[itile]) {
+        continue;
+      }
+      fingerprint_combine(fingerprint,
+                          tile_annotation.global_port_name(global_port));
+      fingerprint_combine(fingerprint, port_tile_ports[itile].get_name());
+      fingerprint_combine(fingerprint, port_tile_ports[itile].get_lsb());
+      fingerprint_combine(fingerprint, port_tile_ports[itile].get_msb());
+      fingerprint_combine(fingerprint,
+                          tile_annotation.global_port_is_clock(global_port));
+      fingerprint_combine(fingerprint,
+                          tile_annotation.global_port_is_set(global_port));
+      fingerprint_combine(fingerprint,
+                          tile_annotation.global_port_is_reset(global_port));
+    }
+  }
+
+  for (const std::string& port_name :
+       tile_annotation.tile_ports_to_merge(tile_name)) {
+    fingerprint_combine(fingerprint, port_name);
+  }
+
+  return fingerprint;
+}
+
+/********************************************************************
+ * Fingerprint a tile, i.e., the programmable blocks and routing blocks
+ * grouped by the tile
+ *******************************************************************/
+size_t fabric_tile_fingerprint(const FabricTile& fabric_tile,
+                               const FabricTileId& tile_id) {
+  size_t fingerprint = 0;
+  vtr::Point<size_t> tile_coord = fabric_tile.tile_coordinate(tile_id);
+  fingerprint_combine(fingerprint, tile_coord.x());
+  fingerprint_combine(fingerprint, tile_coord.y());
+  for (const vtr::Point<size_t>& coord : fabric_tile.pb_coordinates(tile_id)) {
+    fingerprint_combine(fingerprint, coord.x());
+    fingerprint_combine(fingerprint, coord.y());
+  }
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    fingerprint_combine(fingerprint, size_t(cb_type));
+    for (const vtr::Point<size_t>& coord :
+         fabric_tile.cb_coordinates(tile_id, cb_type)) {
+      fingerprint_combine(fingerprint, coord.x());
+      fingerprint_combine(fingerprint, coord.y());
+    }
+  }
+  for (const vtr::Point<size_t>& coord : fabric_tile.sb_coordinates(tile_id)) {
+    fingerprint_combine(fingerprint, coord.x());
+    fingerprint_combine(fingerprint, coord.y());
+  }
+  return fingerprint;
+}
+
+} /* end namespace openfpga */
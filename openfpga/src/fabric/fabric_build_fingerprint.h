@@ -0,0 +1,57 @@
+#ifndef FABRIC_BUILD_FINGERPRINT_H
+#define FABRIC_BUILD_FINGERPRINT_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <functional>
+#include <string>
+
+#include "circuit_library.h"
+#include "config_protocol.h"
+#include "fabric_tile.h"
+#include "module_manager.h"
+#include "physical_types.h"
+#include "rr_graph_view.h"
+#include "rr_gsb.h"
+#include "tile_annotation.h"
+#include "vpr_device_annotation.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Mix the hash of a value into a fingerprint */
+template <typename T>
+void fingerprint_combine(size_t& fingerprint, const T& value) {
+  fingerprint ^= std::hash<T>()(value) + 0x9e3779b97f4a7c15ULL +
+                 (fingerprint << 6) + (fingerprint >> 2);
+}
+
+size_t module_content_fingerprint(const ModuleManager& module_manager,
+                                  const ModuleId& module);
+
+size_t config_protocol_fingerprint(const ConfigProtocol& config_protocol);
+
+size_t rr_gsb_fingerprint(const RRGraphView& rr_graph,
+                          const VprDeviceAnnotation& device_annotation,
+                          const CircuitLibrary& circuit_lib,
+                          const RRGSB& rr_gsb);
+
+size_t pb_type_fingerprint(const VprDeviceAnnotation& device_annotation,
+                           const CircuitLibrary& circuit_lib,
+                           t_pb_type* pb_type);
+
+size_t physical_tile_fingerprint(const TileAnnotation& tile_annotation,
+                                 t_physical_tile_type_ptr phy_block_type,
+                                 const e_side& border_side);
+
+size_t fabric_tile_fingerprint(const FabricTile& fabric_tile,
+                               const FabricTileId& tile_id);
+
+} /* end namespace openfpga */
+
+#endif
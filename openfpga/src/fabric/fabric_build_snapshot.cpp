@@ -0,0 +1,262 @@
+/********************************************************************
+ * Member functions for a data structure which supports incremental builds
+ * of the fabric module graph
+ *******************************************************************/
+#include <algorithm>
+#include <set>
+
+#include "vtr_assert.h"
+
+/* Headers from openfpgautil library */
+#include "fabric_build_fingerprint.h"
+#include "fabric_build_snapshot.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * Find the modules which a module depends on, i.e., its child modules and
+ * the physical modules of its logical configurable children
+ *******************************************************************/
+static std::vector<ModuleId> find_module_dependencies(
+  const ModuleManager& module_manager, const ModuleId& module) {
+  std::vector<ModuleId> dependencies = module_manager.child_modules(module);
+  for (const ModuleId& physical_child :
+       module_manager.logical2physical_configurable_children(module)) {
+    if (module_manager.valid_module_id(physical_child) &&
+        dependencies.end() == std::find(dependencies.begin(),
+                                        dependencies.end(), physical_child)) {
+      dependencies.push_back(physical_child);
+    }
+  }
+  return dependencies;
+}
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+FabricBuildSnapshot::FabricBuildSnapshot() { enabled_ = false; }
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+bool FabricBuildSnapshot::is_enabled() const { return enabled_; }
+
+size_t FabricBuildSnapshot::num_previous_tasks() const {
+  return previous_.tasks.size();
+}
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void FabricBuildSnapshot::set_enabled(const bool& enabled) {
+  enabled_ = enabled;
+  if (false == enabled_) {
+    clear();
+  }
+}
+
+void FabricBuildSnapshot::start_build(const size_t& build_fingerprint) {
+  if (build_fingerprint != previous_.fingerprint) {
+    previous_ = t_build_record();
+  }
+  current_ = t_build_record();
+  current_.fingerprint = build_fingerprint;
+  module_fingerprint_cache_.clear();
+}
+
+/********************************************************************
+ * A task can be reused only when
+ * - its fingerprint is the same as the one in the previous build
+ * - the modules which are instanciated by the task, directly or through
+ *   other modules, but are not created by the task already exist in the
+ *   module manager and have the same content as in the previous build
+ * - the modules which are created by the task but already exist in the
+ *   module manager (e.g., shared by another task) have the same content
+ *   as in the previous build
+ * The content of a module only covers the names of its child modules, so
+ * the whole hierarchy below the task is checked. Otherwise, a change deep
+ * in the hierarchy, e.g., the intermediate buffers of a LUT multiplexer,
+ * would be missed by the tasks which only instanciate the LUT
+ *******************************************************************/
+bool FabricBuildSnapshot::reuse_task(const std::string& task_key,
+                                     const size_t& task_fingerprint,
+                                     ModuleManager& module_manager,
+                                     DecoderLibrary& decoder_lib,
+                                     std::vector<ModuleId>& task_modules,
+                                     std::vector<DecoderId>& task_decoders) {
+  auto task_it = previous_.tasks.find(task_key);
+  if (task_it == previous_.tasks.end()) {
+    return false;
+  }
+  const t_task_record& task = task_it->second;
+  if (task_fingerprint != task.fingerprint) {
+    return false;
+  }
+
+  const ModuleManager& prev_module_manager = previous_.module_manager;
+  std::set<ModuleId> task_module_set(task.modules.begin(), task.modules.end());
+
+  /* Check dependencies, including the dependencies of dependencies */
+  std::set<ModuleId> visited_modules;
+  std::vector<ModuleId> modules_to_check(task.modules.begin(),
+                                         task.modules.end());
+  while (false == modules_to_check.empty()) {
+    ModuleId module = modules_to_check.back();
+    modules_to_check.pop_back();
+    if (false == visited_modules.insert(module).second) {
+      continue;
+    }
+    for (const ModuleId& dependency :
+         find_module_dependencies(prev_module_manager, module)) {
+      modules_to_check.push_back(dependency);
+    }
+    ModuleId curr_module =
+      module_manager.find_module(prev_module_manager.module_name(module));
+    if (false == module_manager.valid_module_id(curr_module)) {
+      /* Only the modules created by the task can be missing */
+      if (0 < task_module_set.count(module)) {
+        continue;
+      }
+      return false;
+    }
+    if (previous_.module_fingerprints[module] !=
+        current_module_fingerprint(module_manager, curr_module)) {
+      return false;
+    }
+  }
+
+  /* Copy the modules, which are sorted in the order of creation */
+  vtr::vector<ModuleId, ModuleId> module_map(prev_module_manager.num_modules(),
+                                             ModuleId::INVALID());
+  for (const ModuleId& module : task.modules) {
+    for (const ModuleId& child :
+         find_module_dependencies(prev_module_manager, module)) {
+      if (!module_map[child]) {
+        module_map[child] =
+          module_manager.find_module(prev_module_manager.module_name(child));
+      }
+      VTR_ASSERT(module_manager.valid_module_id(module_map[child]));
+    }
+    module_map[module] =
+      module_manager.find_module(prev_module_manager.module_name(module));
+    if (module_manager.valid_module_id(module_map[module])) {
+      continue;
+    }
+    module_map[module] =
+      module_manager.import_module(prev_module_manager, module, module_map);
+    task_modules.push_back(module_map[module]);
+  }
+
+  for (const DecoderId& decoder : task.decoders) {
+    const DecoderLibrary& prev_decoder_lib = previous_.decoder_lib;
+    size_t addr_size = prev_decoder_lib.addr_size(decoder);
+    size_t data_size = prev_decoder_lib.data_size(decoder);
+    bool use_enable = prev_decoder_lib.use_enable(decoder);
+    bool use_data_in = prev_decoder_lib.use_data_in(decoder);
+    bool use_data_inv_port = prev_decoder_lib.use_data_inv_port(decoder);
+    bool use_readback = prev_decoder_lib.use_readback(decoder);
+    if (!decoder_lib.find_decoder(addr_size, data_size, use_enable, use_data_in,
+                                  use_data_inv_port, use_readback)) {
+      task_decoders.push_back(
+        decoder_lib.add_decoder(addr_size, data_size, use_enable, use_data_in,
+                                use_data_inv_port, use_readback));
+    }
+  }
+
+  return true;
+}
+
+void FabricBuildSnapshot::record_task(
+  const std::string& task_key, const size_t& task_fingerprint,
+  const ModuleManager& module_manager,
+  const std::vector<ModuleId>& task_modules, const DecoderLibrary& decoder_lib,
+  const std::vector<DecoderId>& task_decoders) {
+  t_task_record& task = current_.tasks[task_key];
+  task.fingerprint = task_fingerprint;
+
+  vtr::vector<ModuleId, ModuleId> module_map(module_manager.num_modules(),
+                                             ModuleId::INVALID());
+  for (const ModuleId& module : task_modules) {
+    task.modules.push_back(
+      rec_record_module(module_manager, module, module_map));
+  }
+
+  for (const DecoderId& decoder : task_decoders) {
+    size_t addr_size = decoder_lib.addr_size(decoder);
+    size_t data_size = decoder_lib.data_size(decoder);
+    bool use_enable = decoder_lib.use_enable(decoder);
+    bool use_data_in = decoder_lib.use_data_in(decoder);
+    bool use_data_inv_port = decoder_lib.use_data_inv_port(decoder);
+    bool use_readback = decoder_lib.use_readback(decoder);
+    DecoderId recorded_decoder = current_.decoder_lib.find_decoder(
+      addr_size, data_size, use_enable, use_data_in, use_data_inv_port,
+      use_readback);
+    if (!recorded_decoder) {
+      recorded_decoder = current_.decoder_lib.add_decoder(
+        addr_size, data_size, use_enable, use_data_in, use_data_inv_port,
+        use_readback);
+    }
+    task.decoders.push_back(recorded_decoder);
+  }
+}
+
+void FabricBuildSnapshot::finish_build() {
+  previous_ = std::move(current_);
+  current_ = t_build_record();
+  module_fingerprint_cache_.clear();
+}
+
+void FabricBuildSnapshot::clear() {
+  previous_ = t_build_record();
+  current_ = t_build_record();
+  module_fingerprint_cache_.clear();
+}
+
+/**************************************************
+ * Private Functions
+ *************************************************/
+/********************************************************************
+ * Copy a module, as well as all the modules it depends on, into the
+ * module manager of the current build record. Modules which have been
+ * recorded are not copied again
+ *******************************************************************/
+ModuleId FabricBuildSnapshot::rec_record_module(
+  const ModuleManager& module_manager, const ModuleId& module,
+  vtr::vector<ModuleId, ModuleId>& module_map) {
+  if (module_map[module]) {
+    return module_map[module];
+  }
+  ModuleId recorded_module =
+    current_.module_manager.find_module(module_manager.module_name(module));
+  if (current_.module_manager.valid_module_id(recorded_module)) {
+    module_map[module] = recorded_module;
+    return recorded_module;
+  }
+
+  for (const ModuleId& child :
+       find_module_dependencies(module_manager, module)) {
+    rec_record_module(module_manager, child, module_map);
+  }
+  recorded_module =
+    current_.module_manager.import_module(module_manager, module, module_map);
+  current_.module_fingerprints.push_back(
+    current_module_fingerprint(module_manager, module));
+  VTR_ASSERT(size_t(recorded_module) + 1 ==
+             current_.module_fingerprints.size());
+  module_map[module] = recorded_module;
+  return recorded_module;
+}
+
+size_t FabricBuildSnapshot::current_module_fingerprint(
+  const ModuleManager& module_manager, const ModuleId& module) {
+  auto result = module_fingerprint_cache_.find(module);
+  if (result != module_fingerprint_cache_.end()) {
+    return result->second;
+  }
+  size_t fingerprint = module_content_fingerprint(module_manager, module);
+  module_fingerprint_cache_[module] = fingerprint;
+  return fingerprint;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,119 @@
+#ifndef FABRIC_BUILD_SNAPSHOT_H
+#define FABRIC_BUILD_SNAPSHOT_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <map>
+#include <string>
+#include <vector>
+
+#include "decoder_library.h"
+#include "module_manager.h"
+#include "vtr_vector.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A data structure to support incremental builds of the fabric module graph
+ *
+ * During a build, the modules created by each build task (e.g., a unique
+ * switch block, a logical tile etc.) are recorded along with a fingerprint
+ * of the task inputs. Recorded modules are copied into a private module
+ * manager, so that the snapshot is not affected by the changes applied to
+ * the fabric after the build (e.g., module renaming).
+ *
+ * During the next build, a task is reused, i.e., its modules are copied
+ * from the snapshot rather than built again, when
+ * - the task has the same fingerprint as in the previous build
+ * - every module instanciated by the task, directly or indirectly, but not
+ *   created by the task, e.g., a routing multiplexer and its branches, has
+ *   the same content as in the previous build. This is how changes on
+ *   circuit models are propagated to the modules depending on them.
+ * The global fingerprint of a build (configuration protocol, options of
+ * build_fabric etc.) must be the same as the previous build. Otherwise,
+ * nothing can be reused.
+ *
+ * Typical usage:
+ *   // Start a build
+ *   snapshot.start_build(build_fingerprint);
+ *   // For each task, try to reuse, otherwise build and record
+ *   if (!snapshot.reuse_task(...)) {
+ *     ...
+ *   }
+ *   snapshot.record_task(...);
+ *   // The current build becomes the reference of next build
+ *   snapshot.finish_build();
+ *******************************************************************/
+class FabricBuildSnapshot {
+ public: /* Constructors */
+  FabricBuildSnapshot();
+
+ public: /* Public accessors */
+  /* Identify if the snapshot should be used during a build */
+  bool is_enabled() const;
+  /* Number of tasks recorded by the previous build */
+  size_t num_previous_tasks() const;
+
+ public: /* Public mutators */
+  void set_enabled(const bool& enabled);
+  /* Start a new build with a given global fingerprint. Previous records are
+   * dropped if the fingerprint does not match */
+  void start_build(const size_t& build_fingerprint);
+  /* Try to copy the modules and decoders of a task from the previous build.
+   * Return true if succeed. The new modules and decoders are appended to the
+   * given lists */
+  bool reuse_task(const std::string& task_key, const size_t& task_fingerprint,
+                  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
+                  std::vector<ModuleId>& task_modules,
+                  std::vector<DecoderId>& task_decoders);
+  /* Record the modules and decoders created by a task in the current build */
+  void record_task(const std::string& task_key, const size_t& task_fingerprint,
+                   const ModuleManager& module_manager,
+                   const std::vector<ModuleId>& task_modules,
+                   const DecoderLibrary& decoder_lib,
+                   const std::vector<DecoderId>& task_decoders);
+  /* The current build becomes the reference of the next build */
+  void finish_build();
+  /* Drop all the records */
+  void clear();
+
+ private: /* Internal data structures */
+  /* Modules and decoders created by a task */
+  struct t_task_record {
+    size_t fingerprint = 0;
+    std::vector<ModuleId> modules;
+    std::vector<DecoderId> decoders;
+  };
+  /* Records of a build */
+  struct t_build_record {
+    size_t fingerprint = 0;
+    /* Copy of the recorded modules as well as the modules they depend on */
+    ModuleManager module_manager;
+    /* Content fingerprint of each module at the time it was recorded */
+    vtr::vector<ModuleId, size_t> module_fingerprints;
+    DecoderLibrary decoder_lib;
+    std::map<std::string, t_task_record> tasks;
+  };
+
+ private: /* Internal functions */
+  ModuleId rec_record_module(const ModuleManager& module_manager,
+                             const ModuleId& module,
+                             vtr::vector<ModuleId, ModuleId>& module_map);
+  size_t current_module_fingerprint(const ModuleManager& module_manager,
+                                    const ModuleId& module);
+
+ private: /* Internal data */
+  bool enabled_;
+  t_build_record previous_;
+  t_build_record current_;
+  /* Content fingerprints of the modules in the module manager under build.
+   * Modules are never modified once their build stage is finished, so that
+   * fingerprints can be cached across stages */
+  std::map<ModuleId, size_t> module_fingerprint_cache_;
+};
+
+} /* end namespace openfpga */
+
+#endif
@@ -1,11 +1,17 @@
 /***************************************************************************************
  * Output internal structure of Module Graph hierarchy to file formats
  ***************************************************************************************/
+#include <map>
 #include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "vtr_vector.h"
 
 /* Headers from openfpgautil library */
 #include "command_exit_codes.h"
@@ -16,124 +22,173 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-/** Identify if the module has no child whose name matches the filter */
-static bool module_filter_all_children(const ModuleManager& module_manager,
-                                       const ModuleId& curr_module,
-                                       const ModuleNameMap& module_name_map,
-                                       const std::string& module_name_filter) {
-  for (const ModuleId& child_module :
-       module_manager.child_modules(curr_module)) {
-    /* Filter out the names which do not match the pattern */
-    std::string child_module_name = module_manager.module_name(child_module);
-    if (module_name_map.name_exist(child_module_name)) {
-      child_module_name = module_name_map.name(child_module_name);
-    }
-    std::string pattern = module_name_filter;
-    std::regex star_replace("\\*");
-    std::regex questionmark_replace("\\?");
-    std::string wildcard_pattern =
-      std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
-                         questionmark_replace, ".");
-    std::regex wildcard_regex(wildcard_pattern);
-    if (std::regex_match(child_module_name, wildcard_regex)) {
-      return false;
-    }
-  }
-  return true;
+/***************************************************************************************
+ * Convert a name pattern with wildcards '*' and '?' to a regular expression,
+ * which is compiled only once for all the names to match
+ ***************************************************************************************/
+static std::regex build_wildcard_regex(const std::string& pattern) {
+  std::regex star_replace("\\*");
+  std::regex questionmark_replace("\\?");
+  std::string wildcard_pattern =
+    std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
+                       questionmark_replace, ".");
+  return std::regex(wildcard_pattern);
 }
 
 /***************************************************************************************
- * Recursively output child module of the parent_module to a text file
- * We use Depth-First Search (DFS) here so that we can output a tree down to
- *leaf first Add space (indent) based on the depth in hierarchy e.g. depth = 1
- *means a space as indent
+ * A writer to output the hierarchy of modules to a text file.
+ * A module may appear under many parent modules, e.g., a tile in a tiled
+ * fabric, and its hierarchy used to be visited again under each of them.
+ * The writer caches the following for each module, so that it is computed
+ * only once:
+ * - the name to output, i.e., the customized name if any
+ * - if the name matches the module name filter
+ * - if none of its child modules matches the module name filter
+ * - the text of its hierarchy at a given depth, as the indent and the
+ *   depth to stop depend on the depth
  ***************************************************************************************/
-static int rec_output_module_hierarchy_to_text_file(
-  std::fstream& fp, const size_t& hie_depth_to_stop,
-  const size_t& current_hie_depth, const ModuleManager& module_manager,
-  const ModuleId& parent_module, const ModuleNameMap& module_name_map,
-  const std::string& module_name_filter, const bool& verbose) {
-  /* Stop if hierarchy depth is beyond the stop line */
-  if (hie_depth_to_stop < current_hie_depth) {
-    return CMD_EXEC_SUCCESS;
+class ModuleHierarchyTextWriter {
+ public: /* Constructors */
+  ModuleHierarchyTextWriter(const ModuleManager& module_manager,
+                            const ModuleNameMap& module_name_map,
+                            const std::string& module_name_filter,
+                            const size_t& hie_depth_to_stop,
+                            const bool& verbose)
+    : module_manager_(module_manager),
+      hie_depth_to_stop_(hie_depth_to_stop),
+      verbose_(verbose) {
+    std::regex filter_regex = build_wildcard_regex(module_name_filter);
+    size_t num_modules = module_manager_.num_modules();
+    module_names_.resize(num_modules);
+    module_name_matched_.resize(num_modules, false);
+    module_filter_all_children_.resize(num_modules, -1);
+    for (const ModuleId& module : module_manager_.modules()) {
+      module_names_[module] = module_manager_.module_name(module);
+      if (module_name_map.name_exist(module_names_[module])) {
+        module_names_[module] = module_name_map.name(module_names_[module]);
+      }
+      module_name_matched_[module] =
+        std::regex_match(module_names_[module], filter_regex);
+    }
   }
 
-  if (false == valid_file_stream(fp)) {
-    return CMD_EXEC_FATAL_ERROR;
+ public: /* Public accessors */
+  const std::string& module_name(const ModuleId& module) const {
+    return module_names_[module];
   }
 
-  /* Check if all the child module has not qualified grand-child, use leaf for
-   * this level */
-  bool use_list = true;
-  for (const ModuleId& child_module :
-       module_manager.child_modules(parent_module)) {
-    if (!module_filter_all_children(module_manager, child_module,
-                                    module_name_map, module_name_filter)) {
-      use_list = false;
-      break;
+ public: /* Public mutators */
+  /** Identify if the module has no child whose name matches the filter */
+  bool module_filter_all_children(const ModuleId& module) {
+    if (-1 == module_filter_all_children_[module]) {
+      module_filter_all_children_[module] = 1;
+      for (const ModuleId& child_module :
+           module_manager_.child_modules(module)) {
+        if (true == module_name_matched_[child_module]) {
+          module_filter_all_children_[module] = 0;
+          break;
+        }
+      }
     }
+    return 1 == module_filter_all_children_[module];
   }
-  /* For debug use only
-  VTR_LOGV(verbose, "Current depth: %lu, Target depth: %lu\n",
-           current_hie_depth, hie_depth_to_stop);
-  */
-  std::string parent_module_name = module_manager.module_name(parent_module);
-  if (module_name_map.name_exist(parent_module_name)) {
-    parent_module_name = module_name_map.name(parent_module_name);
-  }
-  VTR_LOGV(
-    use_list && verbose, "Use list as module '%s' contains only leaf nodes\n",
-    module_name_map.name(module_manager.module_name(parent_module)).c_str());
-
-  /* Iterate over all the child module */
-  for (const ModuleId& child_module :
-       module_manager.child_modules(parent_module)) {
-    if (true != module_manager.valid_module_id(child_module)) {
-      VTR_LOGV_ERROR(
-        verbose,
-        "Unable to find the child module '%s' under its parent '%s'!\n",
-        module_manager.module_name(child_module).c_str(),
-        module_manager.module_name(parent_module).c_str());
+
+  /** Output the child modules of a root module to a text file */
+  int write_module_hierarchy(std::fstream& fp, const ModuleId& root_module) {
+    if (false == valid_file_stream(fp)) {
       return CMD_EXEC_FATAL_ERROR;
     }
+    /* Start with level 1 */
+    int status = rec_build_module_hierarchy_text(root_module, 1);
+    if (CMD_EXEC_SUCCESS != status) {
+      return status;
+    }
+    fp << hierarchy_texts_.at(std::make_pair(root_module, size_t(1)));
+    return CMD_EXEC_SUCCESS;
+  }
 
-    /* Filter out the names which do not match the pattern */
-    std::string child_module_name = module_manager.module_name(child_module);
-    if (module_name_map.name_exist(child_module_name)) {
-      child_module_name = module_name_map.name(child_module_name);
+ private: /* Internal builders */
+  /********************************************************************
+   * Recursively build the text of child modules of the parent_module
+   * We use Depth-First Search (DFS) here so that we can output a tree down
+   * to leaf first Add space (indent) based on the depth in hierarchy e.g.
+   * depth = 1 means a space as indent
+   *******************************************************************/
+  int rec_build_module_hierarchy_text(const ModuleId& parent_module,
+                                      const size_t& current_hie_depth) {
+    std::pair<ModuleId, size_t> text_key(parent_module, current_hie_depth);
+    if (0 < hierarchy_texts_.count(text_key)) {
+      return CMD_EXEC_SUCCESS;
     }
-    std::string pattern = module_name_filter;
-    std::regex star_replace("\\*");
-    std::regex questionmark_replace("\\?");
-    std::string wildcard_pattern =
-      std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
-                         questionmark_replace, ".");
-    std::regex wildcard_regex(wildcard_pattern);
-    if (!std::regex_match(child_module_name, wildcard_regex)) {
-      continue;
+    std::string text;
+    /* Stop if hierarchy depth is beyond the stop line */
+    if (hie_depth_to_stop_ < current_hie_depth) {
+      hierarchy_texts_.emplace(text_key, text);
+      return CMD_EXEC_SUCCESS;
     }
 
-    if (false == write_space_to_file(fp, current_hie_depth * 2)) {
-      return CMD_EXEC_FATAL_ERROR;
-    }
-    if (hie_depth_to_stop == current_hie_depth || use_list) {
-      fp << "- " << child_module_name.c_str() << "\n";
-    } else {
-      fp << child_module_name.c_str() << ":\n";
+    std::vector<ModuleId> child_modules =
+      module_manager_.child_modules(parent_module);
+
+    /* Check if all the child module has not qualified grand-child, use leaf
+     * for this level */
+    bool use_list = true;
+    for (const ModuleId& child_module : child_modules) {
+      if (!module_filter_all_children(child_module)) {
+        use_list = false;
+        break;
+      }
     }
-    /* Go to next level */
-    int status = rec_output_module_hierarchy_to_text_file(
-      fp, hie_depth_to_stop,
-      current_hie_depth + 1, /* Increment the depth for the next level */
-      module_manager, child_module, module_name_map, module_name_filter,
-      verbose);
-    if (status != CMD_EXEC_SUCCESS) {
-      return status;
+    VTR_LOGV(use_list && verbose_,
+             "Use list as module '%s' contains only leaf nodes\n",
+             module_names_[parent_module].c_str());
+
+    /* Iterate over all the child module */
+    for (const ModuleId& child_module : child_modules) {
+      if (true != module_manager_.valid_module_id(child_module)) {
+        VTR_LOGV_ERROR(
+          verbose_,
+          "Unable to find the child module '%s' under its parent '%s'!\n",
+          module_manager_.module_name(child_module).c_str(),
+          module_manager_.module_name(parent_module).c_str());
+        return CMD_EXEC_FATAL_ERROR;
+      }
+
+      /* Filter out the names which do not match the pattern */
+      if (false == module_name_matched_[child_module]) {
+        continue;
+      }
+
+      text.append(current_hie_depth * 2, ' ');
+      if (hie_depth_to_stop_ == current_hie_depth || use_list) {
+        text += "- " + module_names_[child_module] + "\n";
+      } else {
+        text += module_names_[child_module] + ":\n";
+      }
+      /* Go to next level */
+      int status =
+        rec_build_module_hierarchy_text(child_module, current_hie_depth + 1);
+      if (status != CMD_EXEC_SUCCESS) {
+        return status;
+      }
+      text += hierarchy_texts_.at(
+        std::make_pair(child_module, current_hie_depth + 1));
     }
+
+    hierarchy_texts_.emplace(text_key, std::move(text));
+    return CMD_EXEC_SUCCESS;
   }
 
-  return CMD_EXEC_SUCCESS;
-}
+ private: /* Internal data */
+  const ModuleManager& module_manager_;
+  size_t hie_depth_to_stop_;
+  bool verbose_;
+  vtr::vector<ModuleId, std::string> module_names_;
+  vtr::vector<ModuleId, bool> module_name_matched_;
+  /* -1 when unknown, 0 for false and 1 for true */
+  vtr::vector<ModuleId, char> module_filter_all_children_;
+  std::map<std::pair<ModuleId, size_t>, std::string> hierarchy_texts_;
+};
 
 /***************************************************************************************
  * Write the hierarchy of modules to a plain text file
@@ -175,42 +230,33 @@ int write_fabric_hierarchy_to_text_file(
   /* Validate the file stream */
   check_file_stream(fname.c_str(), fp);
 
+  ModuleHierarchyTextWriter hierarchy_writer(
+    module_manager, module_name_map, module_name_filter, hie_depth_to_stop,
+    verbose);
+  std::regex root_regex = build_wildcard_regex(root_module_names);
+
   size_t cnt = 0;
   /* Use regular expression to capture the module whose name matches the pattern
    */
   for (ModuleId curr_module : module_manager.modules()) {
-    std::string curr_module_name = module_manager.module_name(curr_module);
-    if (module_name_map.name_exist(curr_module_name)) {
-      curr_module_name = module_name_map.name(curr_module_name);
-    }
-    std::string pattern = root_module_names;
-    std::regex star_replace("\\*");
-    std::regex questionmark_replace("\\?");
-    std::string wildcard_pattern =
-      std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
-                         questionmark_replace, ".");
-    std::regex wildcard_regex(wildcard_pattern);
-    if (!std::regex_match(curr_module_name, wildcard_regex)) {
+    const std::string& curr_module_name =
+      hierarchy_writer.module_name(curr_module);
+    if (!std::regex_match(curr_module_name, root_regex)) {
       continue;
     }
     /* Filter out module without children if required */
     if (exclude_empty_modules &&
-        module_filter_all_children(module_manager, curr_module, module_name_map,
-                                   module_name_filter)) {
+        hierarchy_writer.module_filter_all_children(curr_module)) {
       continue;
     }
     VTR_LOGV(verbose, "Select module '%s' as root\n", curr_module_name.c_str());
-    /* Record current depth of module: top module is the root with 0 depth */
-    size_t hie_depth = 0;
 
+    /* Top module is the root with 0 depth */
     fp << curr_module_name << ":"
        << "\n";
 
     /* Visit child module recursively and output the hierarchy */
-    int err_code = rec_output_module_hierarchy_to_text_file(
-      fp, hie_depth_to_stop, hie_depth + 1, /* Start with level 1 */
-      module_manager, curr_module, module_name_map, module_name_filter,
-      verbose);
+    int err_code = hierarchy_writer.write_module_hierarchy(fp, curr_module);
     /* Catch error code and exit if required */
     if (err_code == CMD_EXEC_FATAL_ERROR) {
       return err_code;
@@ -0,0 +1,157 @@
+/********************************************************************
+ * Member functions for a data structure which provides the statistics
+ * of each module in a module graph
+ *******************************************************************/
+#include "module_hierarchy_statistics.h"
+
+#include <algorithm>
+
+#include "vtr_assert.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+ModuleHierarchyStatistics::ModuleHierarchyStatistics(
+  const ModuleManager& module_manager)
+  : module_manager_(module_manager) {
+  size_t num_modules = module_manager_.num_modules();
+  visited_.resize(num_modules, false);
+  child_modules_.resize(num_modules);
+  child_num_instances_.resize(num_modules);
+  num_child_instances_.resize(num_modules, 0);
+  num_instances_.resize(num_modules, 0);
+  num_config_bits_.resize(num_modules, 0);
+  num_nets_.resize(num_modules, 0);
+  num_hierarchy_nets_.resize(num_modules, 0);
+  depths_.resize(num_modules, 0);
+
+  for (const ModuleId& module : module_manager_.modules()) {
+    rec_build_statistics(module);
+  }
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+size_t ModuleHierarchyStatistics::num_child_instances(
+  const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return num_child_instances_[module];
+}
+
+size_t ModuleHierarchyStatistics::num_instances(const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return num_instances_[module];
+}
+
+size_t ModuleHierarchyStatistics::num_config_bits(
+  const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return num_config_bits_[module];
+}
+
+size_t ModuleHierarchyStatistics::num_nets(const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return num_nets_[module];
+}
+
+size_t ModuleHierarchyStatistics::num_hierarchy_nets(
+  const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return num_hierarchy_nets_[module];
+}
+
+size_t ModuleHierarchyStatistics::depth(const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return depths_[module];
+}
+
+std::vector<ModuleId> ModuleHierarchyStatistics::hierarchy_modules(
+  const ModuleId& root_module) const {
+  VTR_ASSERT(valid_module_id(root_module));
+  vtr::vector<ModuleId, bool> visited(visited_.size(), false);
+  std::vector<ModuleId> post_order;
+  rec_find_hierarchy_modules(root_module, visited, post_order);
+  /* A reversed post order is a topological order */
+  std::reverse(post_order.begin(), post_order.end());
+  return post_order;
+}
+
+vtr::vector<ModuleId, size_t>
+ModuleHierarchyStatistics::hierarchy_instance_counts(
+  const ModuleId& root_module) const {
+  vtr::vector<ModuleId, size_t> instance_counts(visited_.size(), 0);
+  instance_counts[root_module] = 1;
+  /* Parent modules are visited before their child modules, so that the
+   * counter of a parent module is final when it is propagated */
+  for (const ModuleId& module : hierarchy_modules(root_module)) {
+    for (size_t ichild = 0; ichild < child_modules_[module].size(); ++ichild) {
+      instance_counts[child_modules_[module][ichild]] +=
+        instance_counts[module] * child_num_instances_[module][ichild];
+    }
+  }
+  return instance_counts;
+}
+
+/**************************************************
+ * Private Functions
+ *************************************************/
+/********************************************************************
+ * Build the statistics of a module after those of its child modules.
+ * A module is visited only once
+ *******************************************************************/
+void ModuleHierarchyStatistics::rec_build_statistics(const ModuleId& module) {
+  if (true == visited_[module]) {
+    return;
+  }
+  visited_[module] = true;
+
+  child_modules_[module] = module_manager_.child_modules(module);
+  num_nets_[module] = module_manager_.num_nets(module);
+  num_hierarchy_nets_[module] = num_nets_[module];
+
+  for (const ModuleId& child : child_modules_[module]) {
+    rec_build_statistics(child);
+    size_t num_child_inst = module_manager_.num_instance(module, child);
+    child_num_instances_[module].push_back(num_child_inst);
+    num_child_instances_[module] += num_child_inst;
+    num_instances_[module] += num_child_inst * (1 + num_instances_[child]);
+    num_hierarchy_nets_[module] += num_child_inst * num_hierarchy_nets_[child];
+    depths_[module] = std::max(depths_[module], 1 + depths_[child]);
+  }
+
+  /* Those configurable children which have no configurable children are
+   * actually configurable memory elements, each of which is a bit */
+  for (const ModuleId& config_child : module_manager_.configurable_children(
+         module, ModuleManager::e_config_child_type::PHYSICAL)) {
+    if (0 == module_manager_.num_configurable_children(
+               config_child, ModuleManager::e_config_child_type::PHYSICAL)) {
+      num_config_bits_[module]++;
+      continue;
+    }
+    rec_build_statistics(config_child);
+    num_config_bits_[module] += num_config_bits_[config_child];
+  }
+}
+
+void ModuleHierarchyStatistics::rec_find_hierarchy_modules(
+  const ModuleId& module, vtr::vector<ModuleId, bool>& visited,
+  std::vector<ModuleId>& post_order) const {
+  if (true == visited[module]) {
+    return;
+  }
+  visited[module] = true;
+  for (const ModuleId& child : child_modules_[module]) {
+    rec_find_hierarchy_modules(child, visited, post_order);
+  }
+  post_order.push_back(module);
+}
+
+bool ModuleHierarchyStatistics::valid_module_id(const ModuleId& module) const {
+  return (size_t(module) < visited_.size()) && (true == visited_[module]);
+}
+
+} /* end namespace openfpga */
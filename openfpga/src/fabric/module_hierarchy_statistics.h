@@ -0,0 +1,84 @@
+#ifndef MODULE_HIERARCHY_STATISTICS_H
+#define MODULE_HIERARCHY_STATISTICS_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <vector>
+
+#include "module_manager.h"
+#include "vtr_vector.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A data structure to provide the statistics of each module in a module
+ * graph, considering all the modules in its hierarchy.
+ *
+ * The statistics of all the modules are computed bottom-up in one pass when
+ * the object is constructed, where each module is visited only once.
+ * Afterwards, any query is a simple look-up. Note that the statistics are
+ * not updated when the module graph is modified. Create a new object in such
+ * case.
+ *
+ * The statistics include:
+ * - the number of child instances, both direct and in the whole hierarchy
+ * - the number of configuration bits, i.e., the number of memory elements
+ *   which are the physical configurable children without any configurable
+ *   children in the whole hierarchy
+ * - the number of nets, both direct and in the whole hierarchy
+ * - the depth of hierarchy, which is 0 for a primitive module
+ *******************************************************************/
+class ModuleHierarchyStatistics {
+ public: /* Constructors */
+  ModuleHierarchyStatistics(const ModuleManager& module_manager);
+
+ public: /* Public accessors */
+  /* Number of child instances directly under a module */
+  size_t num_child_instances(const ModuleId& module) const;
+  /* Number of instances in the whole hierarchy under a module */
+  size_t num_instances(const ModuleId& module) const;
+  /* Number of configuration bits in the whole hierarchy under a module */
+  size_t num_config_bits(const ModuleId& module) const;
+  /* Number of nets directly under a module */
+  size_t num_nets(const ModuleId& module) const;
+  /* Number of nets in the whole hierarchy under a module */
+  size_t num_hierarchy_nets(const ModuleId& module) const;
+  /* Depth of hierarchy under a module */
+  size_t depth(const ModuleId& module) const;
+  /* Find all the modules in the hierarchy of a root module, including the
+   * root module itself. Modules are sorted in a topological order, where
+   * a parent module always comes before its child modules */
+  std::vector<ModuleId> hierarchy_modules(const ModuleId& root_module) const;
+  /* Count the number of instances of each module in the hierarchy of a root
+   * module. The root module has only 1 instance. Modules which are not in
+   * the hierarchy have 0 instance */
+  vtr::vector<ModuleId, size_t> hierarchy_instance_counts(
+    const ModuleId& root_module) const;
+
+ private: /* Internal functions */
+  void rec_build_statistics(const ModuleId& module);
+  void rec_find_hierarchy_modules(const ModuleId& module,
+                                  vtr::vector<ModuleId, bool>& visited,
+                                  std::vector<ModuleId>& post_order) const;
+  bool valid_module_id(const ModuleId& module) const;
+
+ private: /* Internal data */
+  const ModuleManager& module_manager_;
+  vtr::vector<ModuleId, bool> visited_;
+  /* Child modules and the number of their instances, cached to avoid
+   * building the vectors again during queries */
+  vtr::vector<ModuleId, std::vector<ModuleId>> child_modules_;
+  vtr::vector<ModuleId, std::vector<size_t>> child_num_instances_;
+  vtr::vector<ModuleId, size_t> num_child_instances_;
+  vtr::vector<ModuleId, size_t> num_instances_;
+  vtr::vector<ModuleId, size_t> num_config_bits_;
+  vtr::vector<ModuleId, size_t> num_nets_;
+  vtr::vector<ModuleId, size_t> num_hierarchy_nets_;
+  vtr::vector<ModuleId, size_t> depths_;
+};
+
+} /* end namespace openfpga */
+
+#endif
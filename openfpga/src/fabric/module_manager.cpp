@@ -355,9 +355,10 @@ BasicPort ModuleManager::module_port(const ModuleId& module_id,
 
 /* Find the module id by a given name, return invalid if not found */
 ModuleId ModuleManager::find_module(const std::string& name) const {
-  if (name_id_map_.find(name) != name_id_map_.end()) {
+  auto result = name_id_map_.find(name);
+  if (result != name_id_map_.end()) {
     /* Find it, return the id */
-    return name_id_map_.at(name);
+    return result->second;
   }
   /* Not found, return an invalid id */
   return ModuleId::INVALID();
@@ -713,8 +714,7 @@ size_t ModuleManager::find_child_module_index_in_parent_module(
 ModuleId ModuleManager::add_module(const std::string& name) {
   /* Find if the name has been used. If used, return an invalid Id and report
    * error! */
-  std::map<std::string, ModuleId>::iterator it = name_id_map_.find(name);
-  if (it != name_id_map_.end()) {
+  if (name_id_map_.find(name) != name_id_map_.end()) {
     return ModuleId::INVALID();
   }
 
@@ -839,6 +839,34 @@ void ModuleManager::set_module_name(const ModuleId& module,
   name_id_map_[name] = module;
 }
 
+bool ModuleManager::set_module_names(
+  const std::vector<std::pair<ModuleId, std::string>>& module_names) {
+  std::vector<std::string> old_names;
+  old_names.reserve(module_names.size());
+  for (const auto& module_name : module_names) {
+    /* Validate the id of module */
+    VTR_ASSERT(valid_module_id(module_name.first));
+    old_names.push_back(names_[module_name.first]);
+    names_[module_name.first] = module_name.second;
+  }
+
+  /* Rebuild the fast look-up in one pass */
+  std::unordered_map<std::string, ModuleId> name_id_map;
+  name_id_map.reserve(ids_.size());
+  for (const ModuleId& module : ids_) {
+    if (false == name_id_map.emplace(names_[module], module).second) {
+      /* Name conflict: restore the names in the reverse order, in case a
+       * module is renamed more than once */
+      for (size_t irename = module_names.size(); irename > 0; --irename) {
+        names_[module_names[irename - 1].first] = old_names[irename - 1];
+      }
+      return false;
+    }
+  }
+  name_id_map_ = std::move(name_id_map);
+  return true;
+}
+
 void ModuleManager::set_module_usage(const ModuleId& module,
                                      const e_module_usage_type& usage) {
   /* Validate the id of module */
@@ -1470,6 +1498,143 @@ ModuleId ModuleManager::create_wrapper_module(
   return wrapper_module;
 }
 
+ModuleId ModuleManager::import_module(
+  const ModuleManager& src_manager, const ModuleId& src_module,
+  const vtr::vector<ModuleId, ModuleId>& module_map) {
+  VTR_ASSERT(src_manager.valid_module_id(src_module));
+
+  ModuleId curr_module = add_module(src_manager.module_name(src_module));
+  if (!curr_module) {
+    return curr_module;
+  }
+  set_module_usage(curr_module, src_manager.module_usage(src_module));
+
+  /* Translate a module id from the source manager to the current one */
+  auto translate_module = [&](const ModuleId& src_id) {
+    if (src_id == src_module) {
+      return curr_module;
+    }
+    if (!src_id) {
+      return ModuleId::INVALID();
+    }
+    VTR_ASSERT(size_t(src_id) < module_map.size());
+    VTR_ASSERT(valid_module_id(module_map[src_id]));
+    return module_map[src_id];
+  };
+
+  /* Ports and their attributes. Port ids are kept unchanged */
+  for (ModulePortId src_port : src_manager.module_ports(src_module)) {
+    ModulePortId curr_port =
+      add_port(curr_module, src_manager.module_port(src_module, src_port),
+               src_manager.port_type(src_module, src_port));
+    VTR_ASSERT(curr_port == src_port);
+    set_port_side(curr_module, curr_port,
+                  src_manager.port_side(src_module, src_port));
+    set_port_is_wire(curr_module, curr_port,
+                     src_manager.port_is_wire(src_module, src_port));
+    set_port_is_mappable_io(
+      curr_module, curr_port,
+      src_manager.port_is_mappable_io(src_module, src_port));
+    set_port_is_register(curr_module, curr_port,
+                         src_manager.port_is_register(src_module, src_port));
+    set_port_preproc_flag(curr_module, curr_port,
+                          src_manager.port_preproc_flag(src_module, src_port));
+  }
+
+  /* Child instances. I/O children are copied later to keep their sequence */
+  const std::vector<ModuleId>& src_children = src_manager.children_[src_module];
+  for (size_t ichild = 0; ichild < src_children.size(); ++ichild) {
+    ModuleId curr_child = translate_module(src_children[ichild]);
+    for (size_t inst = 0;
+         inst < src_manager.num_child_instances_[src_module][ichild]; ++inst) {
+      add_child_module(curr_module, curr_child, false);
+      const std::string& inst_name =
+        src_manager.child_instance_names_[src_module][ichild][inst];
+      if (!inst_name.empty()) {
+        set_child_instance_name(curr_module, curr_child, inst, inst_name);
+      }
+    }
+  }
+  for (size_t ichild = 0; ichild < src_manager.io_children_[src_module].size();
+       ++ichild) {
+    add_io_child(curr_module,
+                 translate_module(src_manager.io_children_[src_module][ichild]),
+                 src_manager.io_child_instances_[src_module][ichild],
+                 src_manager.io_child_coordinates_[src_module][ichild]);
+  }
+
+  /* Configurable children, regions and logical-to-physical mapping */
+  for (const ModuleId& src_child :
+       src_manager.logical_configurable_children_[src_module]) {
+    logical_configurable_children_[curr_module].push_back(
+      translate_module(src_child));
+  }
+  logical_configurable_child_instances_[curr_module] =
+    src_manager.logical_configurable_child_instances_[src_module];
+  for (const ModuleId& src_child :
+       src_manager.logical2physical_configurable_children_[src_module]) {
+    logical2physical_configurable_children_[curr_module].push_back(
+      translate_module(src_child));
+  }
+  logical2physical_configurable_child_instance_names_[curr_module] =
+    src_manager.logical2physical_configurable_child_instance_names_[src_module];
+  for (const ModuleId& src_child :
+       src_manager.physical_configurable_children_[src_module]) {
+    physical_configurable_children_[curr_module].push_back(
+      translate_module(src_child));
+  }
+  physical_configurable_child_instances_[curr_module] =
+    src_manager.physical_configurable_child_instances_[src_module];
+  physical_configurable_child_regions_[curr_module] =
+    src_manager.physical_configurable_child_regions_[src_module];
+  physical_configurable_child_coordinates_[curr_module] =
+    src_manager.physical_configurable_child_coordinates_[src_module];
+  config_region_ids_[curr_module] = src_manager.config_region_ids_[src_module];
+  config_region_children_[curr_module] =
+    src_manager.config_region_children_[src_module];
+
+  /* Nets: terminals are added through the mutators so that the fast look-ups
+   * are updated as well */
+  reserve_module_nets(curr_module, src_manager.num_nets_[src_module]);
+  for (size_t inet = 0; inet < src_manager.num_nets_[src_module]; ++inet) {
+    ModuleNetId src_net = ModuleNetId(inet);
+    ModuleNetId curr_net = create_module_net(curr_module);
+    set_net_name(curr_module, curr_net,
+                 src_manager.net_names_[src_module][src_net]);
+    reserve_module_net_sources(
+      curr_module, curr_net,
+      src_manager.net_src_ids_[src_module][src_net].size());
+    for (ModuleNetSrcId src_id :
+         src_manager.net_src_ids_[src_module][src_net]) {
+      const std::pair<ModuleId, ModulePortId>& terminal =
+        src_manager.net_terminal_storage_
+          [src_manager.net_src_terminal_ids_[src_module][src_net][src_id]];
+      add_module_net_source(
+        curr_module, curr_net, translate_module(terminal.first),
+        src_manager.net_src_instance_ids_[src_module][src_net][src_id],
+        terminal.second,
+        src_manager.net_src_pin_ids_[src_module][src_net][src_id]);
+    }
+    reserve_module_net_sinks(
+      curr_module, curr_net,
+      src_manager.net_sink_ids_[src_module][src_net].size());
+    for (ModuleNetSinkId sink_id :
+         src_manager.net_sink_ids_[src_module][src_net]) {
+      const std::pair<ModuleId, ModulePortId>& terminal =
+        src_manager.net_terminal_storage_
+          [src_manager.net_sink_terminal_ids_[src_module][src_net][sink_id]];
+      add_module_net_sink(
+        curr_module, curr_net, translate_module(terminal.first),
+        src_manager.net_sink_instance_ids_[src_module][src_net][sink_id],
+        terminal.second,
+        src_manager.net_sink_pin_ids_[src_module][src_net][sink_id]);
+    }
+  }
+  invalid_net_ids_[curr_module] = src_manager.invalid_net_ids_[src_module];
+
+  return curr_module;
+}
+
 /******************************************************************************
  * Public Deconstructor
  ******************************************************************************/
@@ -353,6 +353,12 @@ class ModuleManager {
                             const std::string& port_name);
   /* Set a name for a module */
   void set_module_name(const ModuleId& module, const std::string& name);
+  /* Set names for a group of modules at once. The fast look-up is rebuilt
+   * only once, which is much cheaper than calling set_module_name() for each
+   * module when most of the modules are renamed. Return false and keep all
+   * the names unchanged if any name conflict is detected */
+  bool set_module_names(
+    const std::vector<std::pair<ModuleId, std::string>>& module_names);
   /* Set a usage for a module */
   void set_module_usage(const ModuleId& module,
                         const e_module_usage_type& usage);
@@ -505,6 +511,16 @@ class ModuleManager {
                                  const std::string& instance_name,
                                  const bool& add_nets);
 
+  /** @brief Copy a module from another module manager, e.g., a private module
+   * fragment built by a worker thread, into this module manager. All the
+   * module ids referred by the source module (child modules, configurable
+   * children, net terminals etc.) are translated through the given map, which
+   * should cover any source module created before the source module itself.
+   * Return an invalid id if the module name has already been used */
+  ModuleId import_module(const ModuleManager& src_manager,
+                         const ModuleId& src_module,
+                         const vtr::vector<ModuleId, ModuleId>& module_map);
+
  public: /* Public deconstructors */
   /* This is a strong function which will remove all the configurable children
    * under a given parent module
@@ -693,7 +709,7 @@ class ModuleManager {
     net_sink_pin_ids_; /* Pin ids that drive the net */
 
   /* fast look-up for module */
-  std::map<std::string, ModuleId> name_id_map_;
+  std::unordered_map<std::string, ModuleId> name_id_map_;
   /* fast look-up for ports */
   typedef vtr::vector<ModuleId, std::vector<std::vector<ModulePortId>>>
     PortLookup;
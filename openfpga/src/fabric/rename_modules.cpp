@@ -19,6 +19,7 @@ int init_fabric_module_name_map(ModuleNameMap& module_name_map,
   int status = CMD_EXEC_SUCCESS;
   /* the module name map should be empty! */
   module_name_map.clear();
+  module_name_map.reserve(module_manager.modules().size());
   size_t cnt = 0;
   for (ModuleId curr_module : module_manager.modules()) {
     status = module_name_map.set_tag_to_name_pair(
@@ -99,6 +100,7 @@ int rename_fabric_modules(ModuleManager& module_manager,
                           const bool& verbose) {
   int status = CMD_EXEC_SUCCESS;
   size_t cnt = 0;
+  std::vector<std::pair<ModuleId, std::string>> module_renamings;
   for (ModuleId curr_module : module_manager.modules()) {
     std::string curr_module_name = module_manager.module_name(curr_module);
     /* Error out if the new name does not exist ! */
@@ -112,10 +114,16 @@ int rename_fabric_modules(ModuleManager& module_manager,
     if (new_name != curr_module_name) {
       VTR_LOGV(verbose, "Rename module '%s' to its new name '%s'\n",
                curr_module_name.c_str(), new_name.c_str());
-      module_manager.set_module_name(curr_module, new_name);
+      module_renamings.emplace_back(curr_module, std::move(new_name));
     }
     cnt++;
   }
+  /* Apply all the new names at once */
+  if (!module_manager.set_module_names(module_renamings)) {
+    VTR_LOG_ERROR(
+      "Conflicts found in the new module names! Abort renaming...\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
   VTR_LOG("Renamed %lu modules\n", cnt);
   return status;
 }
@@ -128,6 +136,7 @@ int partial_rename_fabric_modules(ModuleManager& module_manager,
                                   const bool& verbose) {
   int status = CMD_EXEC_SUCCESS;
   size_t cnt = 0;
+  std::vector<std::pair<ModuleId, std::string>> module_renamings;
   for (std::string built_in_name : module_name_map.tags()) {
     ModuleId curr_module = module_manager.find_module(built_in_name);
     if (!module_manager.valid_module_id(curr_module)) {
@@ -140,10 +149,16 @@ int partial_rename_fabric_modules(ModuleManager& module_manager,
     if (new_name != built_in_name) {
       VTR_LOGV(verbose, "Rename module '%s' to its new name '%s'\n",
                built_in_name.c_str(), new_name.c_str());
-      module_manager.set_module_name(curr_module, new_name);
+      module_renamings.emplace_back(curr_module, std::move(new_name));
     }
     cnt++;
   }
+  /* Apply all the new names at once */
+  if (!module_manager.set_module_names(module_renamings)) {
+    VTR_LOG_ERROR(
+      "Conflicts found in the new module names! Abort renaming...\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
   VTR_LOG("Renamed %lu modules\n", cnt);
   return status;
 }
@@ -71,7 +71,7 @@ static std::vector<bool> build_cmos_mux_bitstream(
   if (!mux_lib.valid_mux_id(mux_graph_id)) {
     VTR_ASSERT(mux_lib.valid_mux_id(mux_graph_id));
   }
-  const MuxGraph mux_graph = mux_lib.mux_graph(mux_graph_id);
+  const MuxGraph& mux_graph = mux_lib.mux_graph(mux_graph_id);
 
   size_t datapath_id = path_id;
 
@@ -87,9 +87,10 @@ static std::vector<bool> build_cmos_mux_bitstream(
   /* We should have only one output for this MUX! */
   VTR_ASSERT(1 == mux_graph.outputs().size());
 
-  /* Generate the memory bits */
-  vtr::vector<MuxMemId, bool> raw_bitstream = mux_graph.decode_memory_bits(
-    MuxInputId(datapath_id), mux_graph.output_id(mux_graph.outputs()[0]));
+  /* Generate the memory bits, which are precomputed in the MUX graph */
+  const vtr::vector<MuxMemId, bool>& raw_bitstream =
+    mux_graph.decode_memory_bits(MuxInputId(datapath_id),
+                                 mux_graph.output_id(mux_graph.outputs()[0]));
 
   std::vector<bool> mux_bitstream;
   for (const bool& bit : raw_bitstream) {
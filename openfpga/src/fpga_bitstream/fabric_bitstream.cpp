@@ -49,49 +49,49 @@ void FabricBitstreamMemoryBank::add_bit(const fabric_size_t& bit_id,
     masks.emplace_back();
   }
   VTR_ASSERT(datas[region_id].size() == masks[region_id].size());
-  while ((size_t)(wl) >= datas[region_id].size()) {
-    datas[region_id].push_back(std::vector<uint8_t>((bl_addr_size + 7) / 8, 0));
-    masks[region_id].push_back(std::vector<uint8_t>((bl_addr_size + 7) / 8, 0));
+  size_t num_words = num_bl_words(region_id);
+  if ((size_t)(wl) >= num_wls(region_id)) {
+    datas[region_id].resize((wl + 1) * num_words, 0);
+    masks[region_id].resize((wl + 1) * num_words, 0);
   }
+  size_t word = wl * num_words + (bl >> 6);
+  uint64_t bit_mask = uint64_t(1) << (bl & 63);
   // Same uniqie config bit cannot be set twice
-  VTR_ASSERT((masks[region_id][wl][bl >> 3] & (1 << (bl & 7))) == 0);
+  VTR_ASSERT((masks[region_id][word] & bit_mask) == 0);
   if (bit) {
     // Mark the data value if bit (or din) is true
-    datas[region_id][wl][bl >> 3] |= (1 << (bl & 7));
+    datas[region_id][word] |= bit_mask;
   }
   // Mark the mask to indicate we had used this bit
-  masks[region_id][wl][bl >> 3] |= (1 << (bl & 7));
+  masks[region_id][word] |= bit_mask;
 }
 
 void FabricBitstreamMemoryBank::fast_configuration(
   const bool& fast, const bool& bit_value_to_skip) {
-  for (auto& wls : wls_to_skip) {
-    wls.clear();
-  }
   wls_to_skip.clear();
+  num_wls_to_skip.clear();
   for (size_t region = 0; region < datas.size(); region++) {
-    wls_to_skip.emplace_back();
+    wls_to_skip.emplace_back((num_wls(region) + 63) / 64, 0);
+    num_wls_to_skip.push_back(0);
     if (fast) {
+      size_t num_words = num_bl_words(region);
       for (fabric_size_t wl = 0; wl < blwl_lengths[region].wl; wl++) {
-        VTR_ASSERT((size_t)(wl) < datas[region].size());
+        VTR_ASSERT((size_t)(wl) < num_wls(region));
+        const uint64_t* data = wl_datas(region, wl);
+        const uint64_t* mask = wl_masks(region, wl);
+        // Only check the bits that being used (marked in the mask),
+        // otherwise they are just don't care. The WL can be skipped when
+        // the din (recorded in datas) of all the used bits is the same as
+        // bit_value_to_skip. Check 64 bits at a time
         bool skip_wl = true;
-        for (fabric_size_t bl = 0; bl < blwl_lengths[region].bl && skip_wl;
-             bl++) {
-          // Only check the bit that being used (marked in the mask),
-          // otherwise it is just a don't care, we can skip
-          if (masks[region][wl][bl >> 3] & (1 << (bl & 7))) {
-            if (datas[region][wl][bl >> 3] & (1 << (bl & 7))) {
-              // If bit_value_to_skip=true, and yet the din (recorded in
-              // datas) also 1, then we can skip
-              skip_wl = bit_value_to_skip;
-            } else {
-              skip_wl = !bit_value_to_skip;
-            }
-          }
+        for (size_t word = 0; word < num_words && skip_wl; word++) {
+          uint64_t conflicts = bit_value_to_skip ? ~data[word] : data[word];
+          skip_wl = (0 == (mask[word] & conflicts));
         }
         if (skip_wl) {
           // Record down that for this region, we will skip this WL
-          wls_to_skip[region].push_back(wl);
+          wls_to_skip[region][wl >> 6] |= uint64_t(1) << (wl & 63);
+          num_wls_to_skip[region]++;
         }
       }
     }
@@ -105,9 +105,8 @@ fabric_size_t FabricBitstreamMemoryBank::get_longest_effective_wl_count()
   // fast configuration from all the region, it return the longest
   fabric_size_t longest_wl = 0;
   for (size_t region = 0; region < datas.size(); region++) {
-    VTR_ASSERT((size_t)(region) < wls_to_skip.size());
-    fabric_size_t current_wl =
-      (fabric_size_t)(datas[region].size() - wls_to_skip[region].size());
+    VTR_ASSERT((size_t)(region) < num_wls_to_skip.size());
+    fabric_size_t current_wl = num_wls(region) - num_wls_to_skip[region];
     if (current_wl > longest_wl) {
       longest_wl = current_wl;
     }
@@ -73,13 +73,41 @@ struct FabricBitstreamMemoryBank {
   fabric_size_t get_total_bl_addr_size() const;
   fabric_size_t get_total_wl_addr_size() const;
 
+  // Number of regions
+  size_t num_regions() const { return datas.size(); }
+  // Number of 64-bit words required by the BLs of a WL in a region
+  size_t num_bl_words(const size_t& region) const {
+    return (blwl_lengths[region].bl + 63) / 64;
+  }
+  // Number of WLs which are stored in a region
+  // A region without any BL cannot store any bit, so it has no WL data
+  fabric_size_t num_wls(const size_t& region) const {
+    size_t num_words = num_bl_words(region);
+    if (0 == num_words) {
+      return 0;
+    }
+    return (fabric_size_t)(datas[region].size() / num_words);
+  }
+  // First word of the BLs of a WL in a region
+  const uint64_t* wl_datas(const size_t& region, const size_t& wl) const {
+    return &datas[region][wl * num_bl_words(region)];
+  }
+  const uint64_t* wl_masks(const size_t& region, const size_t& wl) const {
+    return &masks[region][wl * num_bl_words(region)];
+  }
+  // Identify if a WL of a region is skipped by fast configuration
+  bool skip_wl(const size_t& region, const size_t& wl) const {
+    return (wl < num_wls(region)) &&
+           ((wls_to_skip[region][wl >> 6] >> (wl & 63)) & 1);
+  }
+
   /*************************
    * All the database (except fabric_bit_datas) is sorted by region
    *  1. The very first layer of vector is region
    * For the datas and masks
-   *  1. They are sorted by WL, hence second layer is WL
-   *  2. Last layer is BL data stored in vector of uint8_t
-   *  3. Each uint8_t will store up-to 8 configuration bit info
+   *  1. They are sorted by WL, the BLs of each WL are a row of words
+   *  2. Rows of all the WLs are stored in a flat vector of uint64_t
+   *  3. Each uint64_t will store up-to 64 configuration bit info
    **************************/
   // Store the BL WL of each region
   std::vector<fabric_blwl_length> blwl_lengths;
@@ -94,31 +122,31 @@ struct FabricBitstreamMemoryBank {
   // 100K LE FPGA only need few mega bytes
   /*
     datas represent the Din value of a given WL and BL (1bit)
-      datas[region #0][wl #0] = std::vector<uint8_t> to represent BLs
-        where uint8_t #0 = MSB{ BL#7, BL#6, .... BL #1, BL #0 } LSB
-        where uint8_t #1 = MSB{ BL#15, BL#14, .... BL #9, BL #8 } LSB
-      datas[region #0][wl #1] = std::vector<uint8_t> to represent BLs
-      datas[region #0][wl #2] = std::vector<uint8_t> to represent BLs
-      ......
-      datas[region #0][wl #n-1] = std::vector<uint8_t> to represent BLs
+    Each WL takes num_bl_words(region) words
+      datas[region #0][0 .. n-1] = words to represent BLs of wl #0
+        where uint64_t #0 = MSB{ BL#63, BL#62, .... BL #1, BL #0 } LSB
+        where uint64_t #1 = MSB{ BL#127, BL#126, .... BL #65, BL #64 } LSB
+      datas[region #0][n .. 2n-1] = words to represent BLs of wl #1
       ......
-      datas[region #1][wl #0] = std::vector<uint8_t> to represent BLs
-      datas[region #1][wl #1] = std::vector<uint8_t> to represent BLs
+      datas[region #1][0 .. m-1] = words to represent BLs of wl #0
       ......
   */
-  std::vector<std::vector<std::vector<uint8_t>>> datas;
+  std::vector<std::vector<uint64_t>> datas;
   /*
     masks has same structure as datas
     but masks presents data that being used
     for exampe:
-      if mask's uint8_t #0 value = 0x41 it means for this WL
+      if mask's uint64_t #0 value = 0x41 it means for this WL
         a. BL #0 is being used, and its Din is recoreded in datas
         b. BL #6 is being used, and its Din is recoreded in datas
-        c. Other BLs #1, 2, 3, 4, 5, 7 are don't care bit (not being used)
+        c. Other BLs #1 - 5, 7 - 63 are don't care bit (not being used)
   */
-  std::vector<std::vector<std::vector<uint8_t>>> masks;
+  std::vector<std::vector<uint64_t>> masks;
   // This track which WL to skip because of fast configuration
-  std::vector<std::vector<fabric_size_t>> wls_to_skip;
+  // A bitmap for each region, where WL #i is the bit i
+  std::vector<std::vector<uint64_t>> wls_to_skip;
+  // Number of WLs to skip for each region
+  std::vector<fabric_size_t> num_wls_to_skip;
 };
 
 class FabricBitstream {
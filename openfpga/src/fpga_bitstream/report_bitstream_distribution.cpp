@@ -4,6 +4,8 @@
 #include <chrono>
 #include <ctime>
 #include <fstream>
+#include <string>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -11,6 +13,7 @@
 #include "vtr_time.h"
 
 /* Headers from openfpgautil library */
+#include "bitstream_manager_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_reserved_words.h"
 #include "openfpga_tokenizer.h"
@@ -45,15 +48,204 @@ static void report_bitstream_distribution_xml_file_head(
   fp << std::endl;
 }
 
+/********************************************************************
+ * Write a string as a JSON string, where quotes, backslashes and control
+ * characters (below 0x20) are escaped, as required by RFC 8259.
+ * Common control characters use their short escapes, e.g., \n, while the
+ * others are written as \u00XX
+ *******************************************************************/
+static void write_json_string(std::fstream& fp, const std::string& str) {
+  const char* hex_digits = "0123456789abcdef";
+  fp << "\"";
+  for (const char& c : str) {
+    switch (c) {
+      case '"':
+        fp << "\\\"";
+        break;
+      case '\\':
+        fp << "\\\\";
+        break;
+      case '\b':
+        fp << "\\b";
+        break;
+      case '\f':
+        fp << "\\f";
+        break;
+      case '\n':
+        fp << "\\n";
+        break;
+      case '\r':
+        fp << "\\r";
+        break;
+      case '\t':
+        fp << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          fp << "\\u00" << hex_digits[(c >> 4) & 0xf] << hex_digits[c & 0xf];
+        } else {
+          fp << c;
+        }
+        break;
+    }
+  }
+  fp << "\"";
+}
+
+/********************************************************************
+ * Recursively report the bitstream distribution of a block to a CSV file,
+ * one row per block, where a block is named by its full hierarchical path
+ *******************************************************************/
+static void rec_report_block_bitstream_distribution_to_csv_file(
+  std::fstream& fp, const BitstreamManager& bitstream_manager,
+  const ConfigBlockId& block, const std::string& parent_path,
+  const size_t& max_hierarchy_level, const size_t& hierarchy_level) {
+  std::string block_path = bitstream_manager.block_name(block);
+  if (false == parent_path.empty()) {
+    block_path = parent_path + std::string(".") + block_path;
+  }
+  fp << "block," << block_path << "," << hierarchy_level << ","
+     << bitstream_manager.block_sum_of_bits(block) << "\n";
+
+  if (hierarchy_level == max_hierarchy_level) {
+    return;
+  }
+  for (const ConfigBlockId& child_block :
+       bitstream_manager.block_children(block)) {
+    rec_report_block_bitstream_distribution_to_csv_file(
+      fp, bitstream_manager, child_block, block_path, max_hierarchy_level,
+      hierarchy_level + 1);
+  }
+}
+
+/********************************************************************
+ * Report the distribution of bitstream to a CSV file, with a header row
+ *   type,name,depth,number_of_bits
+ * where the type is either a region of fabric bitstream or a block of
+ * architecture bitstream. Regions have no depth.
+ * There is no time stamp, as CSV files do not support comments
+ *******************************************************************/
+static int report_bitstream_distribution_to_csv_file(
+  std::fstream& fp, const BitstreamManager& bitstream_manager,
+  const FabricBitstream& fabric_bitstream, const size_t& max_hierarchy_level) {
+  fp << "type,name,depth,number_of_bits\n";
+
+  for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
+    fp << "region," << size_t(region) << ",,"
+       << fabric_bitstream.region_bits(region).size() << "\n";
+  }
+
+  std::vector<ConfigBlockId> top_block =
+    find_bitstream_manager_top_blocks(bitstream_manager);
+  /* Make sure we have only 1 top block */
+  VTR_ASSERT(1 == top_block.size());
+  rec_report_block_bitstream_distribution_to_csv_file(
+    fp, bitstream_manager, top_block[0], std::string(), max_hierarchy_level, 0);
+
+  return 0;
+}
+
+/********************************************************************
+ * Recursively report the bitstream distribution of a block to a JSON file
+ * as an object, whose child blocks are nested in the same way as the
+ * XML report
+ *******************************************************************/
+static void rec_report_block_bitstream_distribution_to_json_file(
+  std::fstream& fp, const BitstreamManager& bitstream_manager,
+  const ConfigBlockId& block, const size_t& max_hierarchy_level,
+  const size_t& hierarchy_level) {
+  write_tab_to_file(fp, hierarchy_level + 2);
+  fp << "{\"name\": ";
+  write_json_string(fp, bitstream_manager.block_name(block));
+  fp << ", \"number_of_bits\": " << bitstream_manager.block_sum_of_bits(block);
+
+  std::vector<ConfigBlockId> child_blocks =
+    bitstream_manager.block_children(block);
+  if ((hierarchy_level < max_hierarchy_level) &&
+      (false == child_blocks.empty())) {
+    fp << ", \"blocks\": [\n";
+    for (size_t ichild = 0; ichild < child_blocks.size(); ++ichild) {
+      rec_report_block_bitstream_distribution_to_json_file(
+        fp, bitstream_manager, child_blocks[ichild], max_hierarchy_level,
+        hierarchy_level + 1);
+      fp << (ichild + 1 < child_blocks.size() ? ",\n" : "\n");
+    }
+    write_tab_to_file(fp, hierarchy_level + 2);
+    fp << "]";
+  }
+  fp << "}";
+}
+
+/********************************************************************
+ * Report the distribution of bitstream to a JSON file, i.e., an object
+ * with the regions of fabric bitstream and the blocks of architecture
+ * bitstream. The time stamp is reported as the fields of the object
+ *******************************************************************/
+static int report_bitstream_distribution_to_json_file(
+  std::fstream& fp, const BitstreamManager& bitstream_manager,
+  const FabricBitstream& fabric_bitstream, const bool& include_time_stamp,
+  const size_t& max_hierarchy_level) {
+  fp << "{\n";
+
+  if (include_time_stamp) {
+    auto end = std::chrono::system_clock::now();
+    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
+    std::string date(std::ctime(&end_time));
+    /* Remove the new line at the end */
+    date.erase(date.find_last_not_of("\n") + 1);
+    write_tab_to_file(fp, 1);
+    fp << "\"version\": ";
+    write_json_string(fp, openfpga::VERSION);
+    fp << ",\n";
+    write_tab_to_file(fp, 1);
+    fp << "\"date\": ";
+    write_json_string(fp, date);
+    fp << ",\n";
+  }
+
+  write_tab_to_file(fp, 1);
+  fp << "\"regions\": [";
+  size_t num_regions = 0;
+  for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
+    fp << (0 == num_regions ? "\n" : ",\n");
+    write_tab_to_file(fp, 2);
+    fp << "{\"id\": " << size_t(region) << ", \"number_of_bits\": "
+       << fabric_bitstream.region_bits(region).size() << "}";
+    num_regions++;
+  }
+  fp << "\n";
+  write_tab_to_file(fp, 1);
+  fp << "],\n";
+
+  std::vector<ConfigBlockId> top_block =
+    find_bitstream_manager_top_blocks(bitstream_manager);
+  /* Make sure we have only 1 top block */
+  VTR_ASSERT(1 == top_block.size());
+  write_tab_to_file(fp, 1);
+  fp << "\"blocks\": [\n";
+  rec_report_block_bitstream_distribution_to_json_file(
+    fp, bitstream_manager, top_block[0], max_hierarchy_level, 0);
+  fp << "\n";
+  write_tab_to_file(fp, 1);
+  fp << "]\n";
+
+  fp << "}\n";
+
+  return 0;
+}
+
 /********************************************************************
  * Report the distribution of bitstream at architecture-level and fabric-level
- * This function can generate a report to a file
+ * This function can generate a report to a file in XML, CSV or JSON format.
+ * The number of bits under each block is cached by the bitstream manager,
+ * so that the runtime only depends on the number of blocks reported
  *******************************************************************/
 int report_bitstream_distribution(const std::string& fname,
                                   const BitstreamManager& bitstream_manager,
                                   const FabricBitstream& fabric_bitstream,
                                   const bool& include_time_stamp,
-                                  const size_t& max_hierarchy_level) {
+                                  const size_t& max_hierarchy_level,
+                                  const std::string& file_format) {
   /* Ensure that we have a valid file name */
   if (true == fname.empty()) {
     VTR_LOG_ERROR(
@@ -62,9 +254,19 @@ int report_bitstream_distribution(const std::string& fname,
     return 1;
   }
 
+  /* Ensure that we have a valid file format */
+  if ((file_format != "xml") && (file_format != "csv") &&
+      (file_format != "json")) {
+    VTR_LOG_ERROR(
+      "Invalid file format '%s' to report bitstream distribution! Expect "
+      "[xml|csv|json].\n",
+      file_format.c_str());
+    return 1;
+  }
+
   std::string timer_message =
-    std::string("Report bitstream distribution into XML file '") + fname +
-    std::string("'");
+    std::string("Report bitstream distribution into ") + file_format +
+    std::string(" file '") + fname + std::string("'");
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
@@ -73,6 +275,21 @@ int report_bitstream_distribution(const std::string& fname,
 
   check_file_stream(fname.c_str(), fp);
 
+  int status = 0;
+  if (file_format == "csv") {
+    status = report_bitstream_distribution_to_csv_file(
+      fp, bitstream_manager, fabric_bitstream, max_hierarchy_level);
+    fp.close();
+    return status;
+  }
+  if (file_format == "json") {
+    status = report_bitstream_distribution_to_json_file(
+      fp, bitstream_manager, fabric_bitstream, include_time_stamp,
+      max_hierarchy_level);
+    fp.close();
+    return status;
+  }
+
   /* Put down a brief introduction */
   report_bitstream_distribution_xml_file_head(fp, include_time_stamp);
 
@@ -80,7 +297,6 @@ int report_bitstream_distribution(const std::string& fname,
   write_tab_to_file(fp, curr_level);
   fp << "<bitstream_distribution>" << std::endl;
 
-  int status = 0;
   status =
     report_fabric_bitstream_distribution(fp, fabric_bitstream, curr_level + 1);
   if (status == 1) {
@@ -2,6 +2,7 @@
  * This file includes functions that output a fabric-dependent
  * bitstream database to files in plain text
  *******************************************************************/
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <fstream>
@@ -301,33 +302,35 @@ static int fast_write_memory_bank_flatten_fabric_bitstream_to_text_file(
   // It could either be 0 (if wl_incremental_order=true) or
   // last WL index (if wl_incremental_order=false)
   std::vector<fabric_size_t> wl_indexes;
-  for (size_t region = 0; region < memory_bank.datas.size(); region++) {
+  for (size_t region = 0; region < memory_bank.num_regions(); region++) {
     if (wl_incremental_order) {
       wl_indexes.push_back(0);
     } else {
-      wl_indexes.push_back(
-        (fabric_size_t)(memory_bank.datas[region].size() - 1));
+      wl_indexes.push_back(memory_bank.num_wls(region) - 1);
     }
   }
+  // Each line is built in a buffer and then written to the file at once
+  std::string line;
+  line.reserve(memory_bank.get_total_bl_addr_size() +
+               memory_bank.get_total_wl_addr_size());
   // Step 2
   // Loop through total WL count that we would like to configure
   for (size_t wl_index = 0; wl_index < longest_effective_wl_count; wl_index++) {
+    line.clear();
     // Step 3
     // Write BL address
     // We cascade all regions: 0, 1, 2 ...
-    for (size_t region = 0; region < memory_bank.datas.size(); region++) {
+    for (size_t region = 0; region < memory_bank.num_regions(); region++) {
       // Step 3a
       // The sequence of configuration of each region WL is not the same
       //   since WL to skip for each region is not the same
       // If it happen that current WL that we are going to program is
-      //   one of the WLs (stored in wls_to_skip) that we had determined
+      //   one of the WLs (marked in wls_to_skip) that we had determined
       //   to skip, the we will increment or decrement to next
       //   depending on wl_incremental_order
       const fabric_blwl_length& lengths = memory_bank.blwl_lengths[region];
       fabric_size_t current_wl = wl_indexes[region];
-      while (std::find(memory_bank.wls_to_skip[region].begin(),
-                       memory_bank.wls_to_skip[region].end(),
-                       current_wl) != memory_bank.wls_to_skip[region].end()) {
+      while (memory_bank.skip_wl(region, current_wl)) {
         // We would like to skip this
         if (wl_incremental_order) {
           wl_indexes[region]++;
@@ -344,75 +347,55 @@ static int fast_write_memory_bank_flatten_fabric_bitstream_to_text_file(
       // Since fabric_blwl_length is unsigned, hence underflow of -1 will be
       //   considered as overflow too
       // If it is overflow/underflow, then we just print don't care
-      if (current_wl < memory_bank.datas[region].size()) {
-        const std::vector<uint8_t>& data =
-          memory_bank.datas[region][current_wl];
-        const std::vector<uint8_t>& mask =
-          memory_bank.masks[region][current_wl];
+      if (current_wl < memory_bank.num_wls(region)) {
+        const uint64_t* data = memory_bank.wl_datas(region, current_wl);
+        const uint64_t* mask = memory_bank.wl_masks(region, current_wl);
         // Step 3c
         // Real code to print BL data that we had stored
         // mask tell you each BL is valid
         //   for invalid BL, we will print don't care
         // data tell you the real din value
-        // (bl >> 3) - This is to find Byte index of the BL
-        // (1 << (bl & 7)) - This is to find Bit index of the BL
-        //                   within that Byte index
+        // (bl >> 6) - This is to find word index of the BL
+        // (bl & 63) - This is to find Bit index of the BL within that word
         // When we '&' both, we can know if that BL is set or unset
-        /*
-          -----------------------------------------------------------------
-          |  bit (bl)  |  Byte index (bl >> 3) | Bit index (1 << (bl & 7)) |
-          |----------------------------------------------------------------
-          |  0         |             0         |    b0000_0001 (or 0x01)   |
-          |  1         |             0         |    b0000_0010 (or 0x02)   |
-          |  2         |             0         |    b0000_0100 (or 0x04)   |
-          |  3         |             0         |    b0000_1000 (or 0x08)   |
-          |  4         |             0         |    b0001_0000 (or 0x10)   |
-          |  5         |             0         |    b0010_0000 (or 0x20)   |
-          |  6         |             0         |    b0100_0000 (or 0x40)   |
-          |  7         |             0         |    b1000_0000 (or 0x80)   |
-          |  8         |             1         |    b0000_0001 (or 0x01)   |
-          | ...        |            ...        |          ...              |
-          ------------------------------------------------------------------
-          Each BL can be uniquely represented by bit slice in byte array
-        */
-        for (size_t bl = 0; bl < lengths.bl; bl++) {
-          if (mask[bl >> 3] & (1 << (bl & 7))) {
-            if (data[bl >> 3] & (1 << (bl & 7))) {
-              fp << "1";
+        // Words without any valid BL are printed at once
+        for (size_t bl = 0; bl < lengths.bl; bl += 64) {
+          size_t num_bls = std::min(size_t(64), lengths.bl - bl);
+          uint64_t mask_word = mask[bl >> 6];
+          uint64_t data_word = data[bl >> 6];
+          if (0 == mask_word) {
+            line.append(num_bls, dont_care_bit[0]);
+            continue;
+          }
+          for (size_t ibit = 0; ibit < num_bls; ibit++) {
+            if ((mask_word >> ibit) & 1) {
+              line.push_back(((data_word >> ibit) & 1) ? '1' : '0');
             } else {
-              fp << "0";
+              line.push_back(dont_care_bit[0]);
             }
-          } else {
-            fp << dont_care_bit.c_str();
           }
         }
       } else {
         /* However not all region has equal WL, for those that is shorter,
          * print 'x' for all BL*/
-        for (size_t bl = 0; bl < lengths.bl; bl++) {
-          fp << dont_care_bit.c_str();
-        }
+        line.append(lengths.bl, dont_care_bit[0]);
       }
     }
     // Step 4
     // Write WL address
     // We cascade all regions: 0, 1, 2 ...
-    for (size_t region = 0; region < memory_bank.datas.size(); region++) {
+    for (size_t region = 0; region < memory_bank.num_regions(); region++) {
       const fabric_blwl_length& lengths = memory_bank.blwl_lengths[region];
       fabric_size_t current_wl = wl_indexes[region];
       // Step 4a
       // If current WL still within the valid range, we will print WL
       // Otherwise it is overflow/underflow then we will print don't care
-      if (current_wl < memory_bank.datas[region].size()) {
+      if (current_wl < memory_bank.num_wls(region)) {
         // Step 4b
         // One hot printing
-        for (size_t wl_temp = 0; wl_temp < lengths.wl; wl_temp++) {
-          if (wl_temp == current_wl) {
-            fp << "1";
-          } else {
-            fp << "0";
-          }
-        }
+        size_t wl_start = line.size();
+        line.append(lengths.wl, '0');
+        line[wl_start + current_wl] = '1';
         // Step 4b
         // Increment or decrement to next depending on wl_incremental_order
         if (wl_incremental_order) {
@@ -423,12 +406,10 @@ static int fast_write_memory_bank_flatten_fabric_bitstream_to_text_file(
       } else {
         /* However not all region has equal WL, for those that is shorter,
          * print 'x' for all WL */
-        for (size_t wl_temp = 0; wl_temp < lengths.wl; wl_temp++) {
-          fp << dont_care_bit.c_str();
-        }
+        line.append(lengths.wl, dont_care_bit[0]);
       }
     }
-    fp << std::endl;
+    fp << line << std::endl;
   }
   return status;
 }
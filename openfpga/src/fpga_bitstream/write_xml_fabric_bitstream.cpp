@@ -5,6 +5,7 @@
 #include <chrono>
 #include <ctime>
 #include <fstream>
+#include <string>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -13,6 +14,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_progress_reporter.h"
 
 /* Headers from archopenfpga library */
 
@@ -242,9 +244,9 @@ static int write_fabric_regional_config_bit_to_xml_file(
   fp << "\"";
   fp << ">\n";
 
-  size_t bit_index = 0;
-  size_t total_bits = fabric_bitstream.region_bits(fabric_region).size();
-  size_t percentage = 0;
+  ProgressReporter progress(
+    "Wrote bits of region " + std::to_string(size_t(fabric_region)),
+    fabric_bitstream.region_bits(fabric_region).size());
   for (const FabricBitId& fabric_bit :
        fabric_bitstream.region_bits(fabric_region)) {
     status = write_fabric_config_bit_to_xml_file(
@@ -253,14 +255,9 @@ static int write_fabric_regional_config_bit_to_xml_file(
     if (1 == status) {
       return status;
     }
-    // Misc to print percentage of the process
-    bit_index++;
-    size_t temp = (bit_index * 100) / total_bits;
-    if (temp != percentage) {
-      VTR_LOG("  Progress: %lu%\r", percentage);
-      percentage = temp;
-    }
+    progress.update();
   }
+  progress.finish();
 
   write_tab_to_file(fp, xml_hierarchy_depth);
   fp << "</region>\n";
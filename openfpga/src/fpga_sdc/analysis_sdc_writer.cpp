@@ -18,6 +18,7 @@
 #include "openfpga_atom_netlist_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "sdc_memory_utils.h"
 #include "sdc_writer_naming.h"
@@ -243,7 +244,7 @@ void print_analysis_sdc(const AnalysisSdcOption& option,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate file stream */
@@ -19,6 +19,7 @@
 #include "configuration_chain_sdc_writer.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "openfpga_scale.h"
 #include "sdc_writer_utils.h"
@@ -144,7 +145,7 @@ void print_pnr_sdc_constrain_configurable_chain(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
@@ -23,6 +23,7 @@
 #include "configure_port_sdc_writer.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "openfpga_reserved_words.h"
 #include "openfpga_scale.h"
@@ -196,7 +197,7 @@ int print_sdc_disable_timing_configure_ports(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
@@ -19,6 +19,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "openfpga_scale.h"
 #include "pnr_sdc_global_port.h"
@@ -177,7 +178,7 @@ void print_pnr_sdc_global_ports(const PnrSdcOption& options,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
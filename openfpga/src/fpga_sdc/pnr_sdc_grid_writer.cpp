@@ -20,6 +20,7 @@
 #include "openfpga_digest.h"
 #include "openfpga_interconnect_types.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_physical_tile_utils.h"
 #include "openfpga_port.h"
 #include "openfpga_reserved_words.h"
@@ -269,7 +270,7 @@ static void print_pnr_sdc_constrain_pb_graph_node_timing(
                         std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
@@ -389,7 +390,7 @@ static void print_pnr_sdc_constrain_primitive_pb_graph_node(
                         std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
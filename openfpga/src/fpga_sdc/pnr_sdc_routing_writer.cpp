@@ -21,6 +21,7 @@
 #include "mux_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "openfpga_rr_graph_utils.h"
 #include "openfpga_scale.h"
@@ -142,7 +143,7 @@ static void print_pnr_sdc_constrain_sb_timing(
                         std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate file stream */
@@ -390,7 +391,7 @@ static void print_pnr_sdc_constrain_cb_timing(
     std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate file stream */
@@ -22,6 +22,7 @@
 #include "mux_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "openfpga_wildcard_string.h"
 #include "pnr_sdc_global_port.h"
@@ -58,7 +59,7 @@ static void print_pnr_sdc_constrain_configurable_memory_outputs(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
@@ -100,7 +101,7 @@ static void print_pnr_sdc_flatten_routing_disable_switch_block_outputs(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
@@ -226,7 +227,7 @@ static void print_pnr_sdc_compact_routing_disable_switch_block_outputs(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
@@ -9,6 +9,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_physical_tile_utils.h"
 #include "openfpga_reserved_words.h"
 #include "pb_type_utils.h"
@@ -51,7 +52,7 @@ void print_pnr_sdc_routing_sb_hierarchy(const std::string& sdc_dir,
   VTR_ASSERT(true != fname.empty());
 
   /* Create a file handler*/
-  std::fstream fp;
+  OutputFileStream fp;
   /* Open a file */
   fp.open(fname, std::fstream::out | std::fstream::trunc);
 
@@ -137,7 +138,7 @@ void print_pnr_sdc_routing_cb_hierarchy(const std::string& sdc_dir,
   VTR_ASSERT(true != fname.empty());
 
   /* Create a file handler*/
-  std::fstream fp;
+  OutputFileStream fp;
   /* Open a file */
   fp.open(fname, std::fstream::out | std::fstream::trunc);
 
@@ -291,7 +292,7 @@ void print_pnr_sdc_grid_hierarchy(const std::string& sdc_dir,
   VTR_ASSERT(true != fname.empty());
 
   /* Create a file handler*/
-  std::fstream fp;
+  OutputFileStream fp;
   /* Open a file */
   fp.open(fname, std::fstream::out | std::fstream::trunc);
 
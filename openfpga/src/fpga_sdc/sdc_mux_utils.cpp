@@ -16,6 +16,7 @@
 #include "mux_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_reserved_words.h"
 #include "sdc_mux_utils.h"
 #include "sdc_writer_naming.h"
@@ -46,7 +47,7 @@ void print_sdc_disable_routing_multiplexer_outputs(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
@@ -12,6 +12,7 @@
 #include "circuit_library_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "spice_auxiliary_netlists.h"
 #include "spice_constants.h"
 #include "spice_writer_utils.h"
@@ -36,7 +37,7 @@ void print_spice_fabric_include_netlist(const NetlistManager& netlist_manager,
     src_dir + std::string(FABRIC_INCLUDE_SPICE_NETLIST_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
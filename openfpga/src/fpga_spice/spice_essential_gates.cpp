@@ -19,6 +19,7 @@
 #include "circuit_library_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "spice_buffer.h"
 #include "spice_constants.h"
 #include "spice_essential_gates.h"
@@ -86,7 +87,7 @@ int print_spice_supply_wrappers(NetlistManager& netlist_manager,
   std::string spice_fname =
     submodule_dir + std::string(SUPPLY_WRAPPER_SPICE_FILE_NAME);
 
-  std::fstream fp;
+  OutputFileStream fp;
 
   /* Create the file stream */
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
@@ -175,7 +176,7 @@ int print_spice_essential_gates(
                               circuit_lib.model_name(circuit_model) +
                               std::string(SPICE_NETLIST_FILE_POSTFIX);
 
-    std::fstream fp;
+    OutputFileStream fp;
 
     /* Create the file stream */
     fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
@@ -16,6 +16,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_side_manager.h"
 
 /* Headers from vpr library */
@@ -83,7 +84,7 @@ static void print_spice_primitive_block(
   VTR_LOGV(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
@@ -189,7 +190,7 @@ static void rec_print_spice_logical_tile(
   VTR_LOGV(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
@@ -297,7 +298,7 @@ static void print_spice_physical_tile_netlist(
   }
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
@@ -12,6 +12,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 
 /* Headers from openfpgashell library */
 #include "circuit_library_utils.h"
@@ -107,7 +108,7 @@ int print_spice_submodule_memories(NetlistManager& netlist_manager,
                           std::string(MEMORIES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
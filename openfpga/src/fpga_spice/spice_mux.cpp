@@ -21,6 +21,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 
 /* Headers from openfpgashell library */
 #include "circuit_library_utils.h"
@@ -152,7 +153,7 @@ static int print_spice_submodule_mux_primitives(
                           std::string(MUX_PRIMITIVES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
@@ -212,7 +213,7 @@ static int print_spice_submodule_mux_top_subckt(
   std::string spice_fname(submodule_dir + std::string(MUXES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
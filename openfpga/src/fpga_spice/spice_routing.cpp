@@ -9,6 +9,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 
 /* Include FPGA-Verilog header files*/
 #include "openfpga_naming.h"
@@ -88,7 +89,7 @@ static void print_spice_routing_connection_box_unique_module(
       cb_type, gsb_coordinate, std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
@@ -191,7 +192,7 @@ static void print_spice_routing_switch_box_unique_module(
                             std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
@@ -13,6 +13,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "spice_constants.h"
 #include "spice_subckt_writer.h"
 #include "spice_top_module.h"
@@ -50,7 +51,7 @@ void print_spice_top_module(NetlistManager& netlist_manager,
           spice_fname.c_str());
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
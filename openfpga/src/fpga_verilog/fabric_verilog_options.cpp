@@ -24,6 +24,7 @@ FabricVerilogOption::FabricVerilogOption() {
   constant_undriven_inputs_ = FabricVerilogOption::e_undriven_input_type::NONE;
   CONSTANT_UNDRIVEN_INPUT_TYPE_STRING_ = {"none", "bus0", "bus1", "bit0",
                                           "bit1"};
+  compress_netlist_ = false;
   verbose_output_ = false;
 }
 
@@ -91,6 +92,10 @@ std::string FabricVerilogOption::full_constant_undriven_input_type_str() const {
   return full_type_str;
 }
 
+bool FabricVerilogOption::compress_netlist() const {
+  return compress_netlist_;
+}
+
 bool FabricVerilogOption::verbose_output() const { return verbose_output_; }
 
 /******************************************************************************
@@ -171,6 +176,10 @@ bool FabricVerilogOption::set_constant_undriven_inputs(
   return type != FabricVerilogOption::e_undriven_input_type::NUM_TYPES;
 }
 
+void FabricVerilogOption::set_compress_netlist(const bool& enabled) {
+  compress_netlist_ = enabled;
+}
+
 void FabricVerilogOption::set_verbose_output(const bool& enabled) {
   verbose_output_ = enabled;
 }
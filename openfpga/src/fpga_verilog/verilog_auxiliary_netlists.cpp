@@ -12,6 +12,7 @@
 #include "circuit_library_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "verilog_auxiliary_netlists.h"
 #include "verilog_constants.h"
 #include "verilog_writer_utils.h"
@@ -42,7 +43,7 @@ void print_verilog_mock_fabric_include_netlist(
     src_dir_path + std::string(FABRIC_INCLUDE_VERILOG_NETLIST_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
@@ -86,7 +87,7 @@ void print_verilog_fabric_include_netlist(const NetlistManager& netlist_manager,
     src_dir_path + std::string(FABRIC_INCLUDE_VERILOG_NETLIST_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
@@ -178,7 +179,7 @@ void print_verilog_full_testbench_include_netlists(
   bool no_self_checking = options.no_self_checking();
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
@@ -240,7 +241,7 @@ void print_verilog_preconfigured_testbench_include_netlists(
   bool no_self_checking = options.no_self_checking();
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
@@ -298,7 +299,7 @@ void print_verilog_preprocessing_flags_netlist(
   std::string verilog_fname = src_dir + std::string(DEFINES_VERILOG_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
@@ -13,6 +13,7 @@
 #include "openfpga_decode.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_reserved_words.h"
 #include "verilog_constants.h"
 #include "verilog_decoders.h"
@@ -187,7 +188,7 @@ void print_verilog_submodule_mux_local_decoders(
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -789,7 +790,7 @@ void print_verilog_submodule_arch_decoders(
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
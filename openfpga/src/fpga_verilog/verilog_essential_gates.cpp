@@ -15,6 +15,7 @@
 #include "module_manager_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "verilog_constants.h"
 #include "verilog_essential_gates.h"
@@ -553,7 +554,7 @@ void print_verilog_submodule_essentials(const ModuleManager& module_manager,
   std::string verilog_fname(ESSENTIALS_VERILOG_FILE_NAME);
   std::string verilog_fpath = submodule_dir + verilog_fname;
 
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
 
   /* Create the file stream */
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
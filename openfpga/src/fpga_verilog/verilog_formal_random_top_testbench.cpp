@@ -17,6 +17,7 @@
 #include "fabric_global_port_info_utils.h"
 #include "openfpga_atom_netlist_utils.h"
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "openfpga_reserved_words.h"
 #include "simulation_utils.h"
@@ -286,7 +287,7 @@ void print_verilog_random_top_testbench(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
@@ -16,6 +16,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_side_manager.h"
 
 /* Headers from vpr library */
@@ -87,7 +88,7 @@ static void print_verilog_primitive_block(
   VTR_LOGV(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -205,7 +206,7 @@ static void rec_print_verilog_logical_tile(
   VTR_LOGV(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -322,7 +323,7 @@ static void print_verilog_physical_tile_netlist(
   }
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
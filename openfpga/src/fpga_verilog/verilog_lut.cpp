@@ -14,6 +14,7 @@
 #include "mux_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "verilog_constants.h"
 #include "verilog_lut.h"
 #include "verilog_module_writer.h"
@@ -36,7 +37,7 @@ void print_verilog_submodule_luts(const ModuleManager& module_manager,
   std::string verilog_fname(LUTS_VERILOG_FILE_NAME);
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
 
   /* Create the file stream */
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
@@ -27,6 +27,7 @@
 #include "mux_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "verilog_constants.h"
 #include "verilog_module_writer.h"
 #include "verilog_mux.h"
@@ -1461,7 +1462,7 @@ static void print_verilog_submodule_mux_primitives(
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -1525,7 +1526,7 @@ static void print_verilog_submodule_mux_top_modules(
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
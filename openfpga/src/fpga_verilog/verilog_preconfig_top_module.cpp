@@ -15,6 +15,7 @@
 #include "openfpga_atom_netlist_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 #include "openfpga_reserved_words.h"
 #include "verilog_constants.h"
@@ -390,7 +391,7 @@ int print_verilog_preconfig_top_module(
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
@@ -9,6 +9,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 
 /* Include FPGA-Verilog header files*/
 #include "openfpga_naming.h"
@@ -96,7 +97,7 @@ static void print_verilog_routing_connection_box_unique_module(
   std::string verilog_fpath(subckt_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -215,7 +216,7 @@ static void print_verilog_routing_switch_box_unique_module(
   std::string verilog_fpath(subckt_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -13,6 +13,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_output_stream.h"
 #include "openfpga_port.h"
 
 /* Headers from readarchopenfpga library */
@@ -195,7 +196,7 @@ void print_verilog_submodule_templates(const ModuleManager& module_manager,
                             USER_DEFINED_TEMPLATE_VERILOG_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fname.c_str(), fp);
@@ -11,6 +11,7 @@
 #include "command_exit_codes.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "verilog_constants.h"
 #include "verilog_module_writer.h"
 #include "verilog_writer_utils.h"
@@ -49,7 +50,7 @@ static int print_verilog_tile_module_netlist(
           verilog_fpath.c_str(), tile_module_name.c_str());
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
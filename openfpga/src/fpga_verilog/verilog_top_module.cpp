@@ -13,6 +13,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "verilog_constants.h"
 #include "verilog_module_writer.h"
 #include "verilog_top_module.h"
@@ -52,7 +53,7 @@ void print_verilog_core_module(NetlistManager& netlist_manager,
           verilog_fpath.c_str());
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -116,7 +117,7 @@ void print_verilog_top_module(NetlistManager& netlist_manager,
           verilog_fpath.c_str());
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
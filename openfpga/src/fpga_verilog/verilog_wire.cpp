@@ -14,6 +14,7 @@
 #include "module_manager_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "verilog_constants.h"
 #include "verilog_submodule_utils.h"
 #include "verilog_wire.h"
@@ -115,7 +116,7 @@ void print_verilog_submodule_wires(const ModuleManager& module_manager,
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp(options.compress_netlist());
   fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -19,6 +19,7 @@
 #include "circuit_library_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_output_stream.h"
 #include "verilog_constants.h"
 #include "verilog_writer_utils.h"
 
@@ -1663,7 +1664,7 @@ void print_verilog_netlist_include_header_file(
                             std::string(header_file_name));
 
   /* Create the file stream */
-  std::fstream fp;
+  OutputFileStream fp;
   fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   VTR_ASSERT(true == valid_file_stream(fp));
@@ -69,19 +69,14 @@ DecoderId DecoderLibrary::find_decoder(const size_t& addr_size,
                                        const bool& use_data_in,
                                        const bool& use_data_inv_port,
                                        const bool& use_readback) const {
-  for (auto decoder : decoders()) {
-    if ((addr_size == addr_sizes_[decoder]) &&
-        (data_size == data_sizes_[decoder]) &&
-        (use_enable == use_enable_[decoder]) &&
-        (use_data_in == use_data_in_[decoder]) &&
-        (use_data_inv_port == use_data_inv_port_[decoder]) &&
-        (use_readback == use_readback_[decoder])) {
-      return decoder;
-    }
+  auto it = decoder_lookup_.find(decoder_spec(addr_size, data_size,
+                                              use_enable, use_data_in,
+                                              use_data_inv_port, use_readback));
+  if (it == decoder_lookup_.end()) {
+    /* Not found, return an invalid id by default */
+    return DecoderId::INVALID();
   }
-
-  /* Not found, return an invalid id by default */
-  return DecoderId::INVALID();
+  return it->second;
 }
 
 /***************************************************************************************
@@ -114,7 +109,43 @@ DecoderId DecoderLibrary::add_decoder(const size_t& addr_size,
   use_data_inv_port_.push_back(use_data_inv_port);
   use_readback_.push_back(use_readback);
 
+  /* Update the fast look-up. Keep the first decoder if duplicated */
+  decoder_lookup_.emplace(
+    decoder_spec(addr_size, data_size, use_enable, use_data_in,
+                 use_data_inv_port, use_readback),
+    decoder);
+
   return decoder;
 }
 
+/***************************************************************************************
+ * Private functions
+ **************************************************************************************/
+bool DecoderLibrary::t_decoder_spec::operator==(
+  const t_decoder_spec& other) const {
+  return (addr_size == other.addr_size) && (data_size == other.data_size) &&
+         (flags == other.flags);
+}
+
+size_t DecoderLibrary::t_decoder_spec_hash::operator()(
+  const t_decoder_spec& spec) const {
+  /* The flags take the 4 lowest bits, shifted along with address size */
+  size_t hash = std::hash<size_t>()(spec.data_size);
+  hash ^= std::hash<size_t>()((spec.addr_size << 4) | spec.flags) +
+          0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+DecoderLibrary::t_decoder_spec DecoderLibrary::decoder_spec(
+  const size_t& addr_size, const size_t& data_size, const bool& use_enable,
+  const bool& use_data_in, const bool& use_data_inv_port,
+  const bool& use_readback) {
+  t_decoder_spec spec;
+  spec.addr_size = addr_size;
+  spec.data_size = data_size;
+  spec.flags = (use_enable ? 0x1 : 0) | (use_data_in ? 0x2 : 0) |
+               (use_data_inv_port ? 0x4 : 0) | (use_readback ? 0x8 : 0);
+  return spec;
+}
+
 } /* End namespace openfpga*/
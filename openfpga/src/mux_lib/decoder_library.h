@@ -22,6 +22,8 @@
 #ifndef DECODER_LIBRARY_H
 #define DECODER_LIBRARY_H
 
+#include <unordered_map>
+
 #include "decoder_library_fwd.h"
 #include "vtr_range.h"
 #include "vtr_vector.h"
@@ -79,6 +81,27 @@ class DecoderLibrary {
                         const bool& use_data_inv_port,
                         const bool& use_readback);
 
+ private: /* Internal types */
+  /* The full specification of a decoder, which is the key of the fast
+   * look-up. The flags are packed into a bit mask */
+  struct t_decoder_spec {
+    size_t addr_size;
+    size_t data_size;
+    unsigned char flags;
+    bool operator==(const t_decoder_spec& other) const;
+  };
+  struct t_decoder_spec_hash {
+    size_t operator()(const t_decoder_spec& spec) const;
+  };
+
+ private: /* Internal functions */
+  static t_decoder_spec decoder_spec(const size_t& addr_size,
+                                     const size_t& data_size,
+                                     const bool& use_enable,
+                                     const bool& use_data_in,
+                                     const bool& use_data_inv_port,
+                                     const bool& use_readback);
+
  private: /* Internal Data */
   vtr::vector<DecoderId, DecoderId> decoder_ids_;
   vtr::vector<DecoderId, size_t> addr_sizes_;
@@ -87,6 +110,11 @@ class DecoderLibrary {
   vtr::vector<DecoderId, bool> use_data_in_;
   vtr::vector<DecoderId, bool> use_data_inv_port_;
   vtr::vector<DecoderId, bool> use_readback_;
+
+  /* Fast look-up to find a decoder with its specification. When duplicated
+   * decoders are added, the first one is kept */
+  std::unordered_map<t_decoder_spec, DecoderId, t_decoder_spec_hash>
+    decoder_lookup_;
 };
 
 } /* End namespace openfpga*/
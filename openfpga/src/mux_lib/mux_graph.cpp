@@ -47,27 +47,8 @@ MuxGraph::node_range MuxGraph::nodes() const {
 }
 
 /* Find the non-input nodes */
-std::vector<MuxNodeId> MuxGraph::non_input_nodes() const {
-  /* Must be an valid graph */
-  VTR_ASSERT_SAFE(valid_mux_graph());
-  std::vector<MuxNodeId> node_list;
-
-  /* Build the node list, level by level */
-  for (size_t level = 0; level < num_node_levels(); ++level) {
-    for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES);
-         ++node_type) {
-      /* Bypass any nodes which are not OUTPUT and INTERNAL */
-      if (size_t(MUX_INPUT_NODE) == node_type) {
-        continue;
-      }
-      /* Reach here, this is either an OUTPUT or INTERNAL node */
-      for (auto node : node_lookup_[level][node_type]) {
-        node_list.push_back(node);
-      }
-    }
-  }
-
-  return node_list;
+const std::vector<MuxNodeId>& MuxGraph::non_input_nodes() const {
+  return non_input_nodes_;
 }
 
 MuxGraph::edge_range MuxGraph::edges() const {
@@ -104,25 +85,14 @@ size_t MuxGraph::num_inputs() const {
   VTR_ASSERT_SAFE(valid_mux_graph());
   /* Sum up the number of INPUT nodes in each level */
   size_t num_inputs = 0;
-  for (auto node_per_level : node_lookup_) {
+  for (const auto& node_per_level : node_lookup_) {
     num_inputs += node_per_level[MUX_INPUT_NODE].size();
   }
   return num_inputs;
 }
 
 /* Return the node ids of all the inputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::inputs() const {
-  std::vector<MuxNodeId> input_nodes;
-  /* need to check if the graph is valid or not */
-  VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the input nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    input_nodes.insert(input_nodes.end(),
-                       node_per_level[MUX_INPUT_NODE].begin(),
-                       node_per_level[MUX_INPUT_NODE].end());
-  }
-  return input_nodes;
-}
+const std::vector<MuxNodeId>& MuxGraph::inputs() const { return inputs_; }
 
 /* Find the number of outputs in the MUX graph */
 size_t MuxGraph::num_outputs() const {
@@ -130,25 +100,14 @@ size_t MuxGraph::num_outputs() const {
   VTR_ASSERT_SAFE(valid_mux_graph());
   /* Sum up the number of INPUT nodes in each level */
   size_t num_outputs = 0;
-  for (auto node_per_level : node_lookup_) {
+  for (const auto& node_per_level : node_lookup_) {
     num_outputs += node_per_level[MUX_OUTPUT_NODE].size();
   }
   return num_outputs;
 }
 
 /* Return the node ids of all the outputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::outputs() const {
-  std::vector<MuxNodeId> output_nodes;
-  /* need to check if the graph is valid or not */
-  VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the output nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    output_nodes.insert(output_nodes.end(),
-                        node_per_level[MUX_OUTPUT_NODE].begin(),
-                        node_per_level[MUX_OUTPUT_NODE].end());
-  }
-  return output_nodes;
-}
+const std::vector<MuxNodeId>& MuxGraph::outputs() const { return outputs_; }
 
 /* Find the edge between two MUX nodes */
 std::vector<MuxEdgeId> MuxGraph::find_edges(const MuxNodeId& from_node,
@@ -202,7 +161,8 @@ size_t MuxGraph::num_memory_bits_at_level(const size_t& level) const {
 }
 
 /* Return memory id at level */
-std::vector<MuxMemId> MuxGraph::memories_at_level(const size_t& level) const {
+const std::vector<MuxMemId>& MuxGraph::memories_at_level(
+  const size_t& level) const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_level(level));
   VTR_ASSERT_SAFE(valid_mux_graph());
@@ -238,17 +198,23 @@ size_t MuxGraph::node_index_at_level(const MuxNodeId& node) const {
 }
 
 /* Find the  input edges for a node */
-std::vector<MuxEdgeId> MuxGraph::node_in_edges(const MuxNodeId& node) const {
+MuxGraph::edge_list_range MuxGraph::node_in_edges(
+  const MuxNodeId& node) const {
   /* validate the node */
   VTR_ASSERT(valid_node_id(node));
-  return node_in_edges_[node];
+  return vtr::make_range(
+    csr_in_edges_.begin() + csr_in_edge_offsets_[size_t(node)],
+    csr_in_edges_.begin() + csr_in_edge_offsets_[size_t(node) + 1]);
 }
 
 /* Find the input nodes for a edge */
-std::vector<MuxNodeId> MuxGraph::edge_src_nodes(const MuxEdgeId& edge) const {
+MuxGraph::node_list_range MuxGraph::edge_src_nodes(
+  const MuxEdgeId& edge) const {
   /* validate the edge */
   VTR_ASSERT(valid_edge_id(edge));
-  return edge_src_nodes_[edge];
+  return vtr::make_range(
+    csr_src_nodes_.begin() + csr_src_node_offsets_[size_t(edge)],
+    csr_src_nodes_.begin() + csr_src_node_offsets_[size_t(edge) + 1]);
 }
 
 /* Find the mem that control the edge */
@@ -277,7 +243,7 @@ std::vector<size_t> MuxGraph::branch_sizes() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -316,7 +282,7 @@ std::vector<size_t> MuxGraph::branch_sizes(const size_t& level) const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -366,10 +332,10 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
 
   /* Add input nodes and edges to subgraph */
   size_t input_cnt = 0;
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
-    VTR_ASSERT_SAFE(1 == edge_src_nodes_[edge_origin].size());
+  for (auto edge_origin : this->node_in_edges(root_node)) {
+    VTR_ASSERT_SAFE(1 == edge_src_nodes(edge_origin).size());
     /* Add nodes */
-    MuxNodeId from_node_origin = this->edge_src_nodes_[edge_origin][0];
+    MuxNodeId from_node_origin = *(this->edge_src_nodes(edge_origin).begin());
     MuxNodeId from_node_subgraph = mux_graph.add_node(MUX_INPUT_NODE);
     /* Configure the nodes */
     mux_graph.node_levels_[from_node_subgraph] = 0;
@@ -392,7 +358,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
   std::map<MuxMemId, MuxMemId> mem2mem_map;
 
   /* Add memory bits and configure edges */
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
+  for (auto edge_origin : this->node_in_edges(root_node)) {
     MuxMemId mem_origin = this->edge_mem_ids_[edge_origin];
     /* Try to find if the mem is already in the list */
     std::map<MuxMemId, MuxMemId>::iterator it = mem2mem_map.find(mem_origin);
@@ -415,6 +381,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
   /* Since the graph is finalized, it is time to build the fast look-up */
   mux_graph.build_node_lookup();
   mux_graph.build_mem_lookup();
+  mux_graph.compile();
 
   return mux_graph;
 }
@@ -441,7 +408,7 @@ std::vector<MuxGraph> MuxGraph::build_mux_branch_graphs() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -498,30 +465,18 @@ bool MuxGraph::is_node_output(const MuxNodeId& node_id) const {
 
 /* Get the node id of a given input */
 MuxNodeId MuxGraph::node_id(const MuxInputId& input_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_INPUT_NODE]) {
-      if (input_id == node_input_ids_[cand_node]) {
-        return cand_node;
-      }
-    }
+  if (size_t(input_id) >= input_nodes_.size()) {
+    return MuxNodeId::INVALID();
   }
-
-  return MuxNodeId::INVALID();
+  return input_nodes_[input_id];
 }
 
 /* Get the node id of a given output */
 MuxNodeId MuxGraph::node_id(const MuxOutputId& output_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_OUTPUT_NODE]) {
-      if (output_id == node_output_ids_[cand_node]) {
-        return cand_node;
-      }
-    }
+  if (size_t(output_id) >= output_nodes_.size()) {
+    return MuxNodeId::INVALID();
   }
-
-  return MuxNodeId::INVALID();
+  return output_nodes_[output_id];
 }
 
 /* Get the node id w.r.t. the node level and node_index at the level
@@ -529,107 +484,29 @@ MuxNodeId MuxGraph::node_id(const MuxOutputId& output_id) const {
  */
 MuxNodeId MuxGraph::node_id(const size_t& node_level,
                             const size_t& node_index_at_level) const {
-  /* Ensure we have a valid node_look-up */
-  VTR_ASSERT_SAFE(valid_node_lookup());
-
-  MuxNodeId ret_node = MuxNodeId::INVALID();
-
-  /* Search in the fast look up */
-  if (node_level >= node_lookup_.size()) {
-    return ret_node;
+  /* Search in the compiled levels */
+  if (node_level + 1 >= level_node_offsets_.size()) {
+    return MuxNodeId::INVALID();
   }
-
-  size_t node_cnt = 0;
-  /* Node level is valid, search in the node list */
-  for (const auto& nodes_by_type : node_lookup_[node_level]) {
-    /* Search the node_index_at_level of each node */
-    for (const auto& node : nodes_by_type) {
-      if (node_index_at_level != node_ids_at_level_[node]) {
-        continue;
-      }
-      /* Find the node, assign value and update the counter */
-      ret_node = node;
-      node_cnt++;
-    }
+  size_t inode = level_node_offsets_[node_level] + node_index_at_level;
+  if (inode >= level_node_offsets_[node_level + 1]) {
+    return MuxNodeId::INVALID();
   }
-
-  /* We should either find a node or nothing */
-  VTR_ASSERT((0 == node_cnt) || (1 == node_cnt));
-
-  return ret_node;
+  return level_nodes_[inode];
 }
 
 /* Decode memory bits based on an input id and an output id */
-vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(
+const vtr::vector<MuxMemId, bool>& MuxGraph::decode_memory_bits(
   const MuxInputId& input_id, const MuxOutputId& output_id) const {
-  /* initialize the memory bits: TODO: support default value */
-  vtr::vector<MuxMemId, bool> mem_bits(mem_ids_.size(), false);
-
   /* valid the input and output */
-  VTR_ASSERT_SAFE(valid_input_id(input_id));
-  VTR_ASSERT_SAFE(valid_output_id(output_id));
-
-  /* Mark all the nodes as not visited */
-  vtr::vector<MuxNodeId, bool> visited(nodes().size(), false);
-
-  /* Create a queue for Breadth-First Search */
-  std::list<MuxNodeId> queue;
-
-  /* Mark the input node as visited and enqueue it */
-  visited[node_id(input_id)] = true;
-  queue.push_back(node_id(input_id));
-
-  /* Create a flag to indicate if the route is success or not */
-  bool route_success = false;
-
-  while (!queue.empty()) {
-    /* Dequeue a mux node from queue,
-     * we will walk through all the fan-in of this node in this loop
-     */
-    MuxNodeId node_to_expand = queue.front();
-    queue.pop_front();
-    /* Get all fan-in nodes of the dequeued node
-     * If the node has not been visited,
-     * then mark it visited and enqueue it
-     */
-    VTR_ASSERT_SAFE(1 == node_out_edges_[node_to_expand].size());
-    MuxEdgeId edge = node_out_edges_[node_to_expand][0];
-
-    /* Configure the mem bits:
-     * if inv_mem is enabled, it means 0 to enable this edge
-     * otherwise, it is 1 to enable this edge
-     */
-    MuxMemId mem = edge_mem_ids_[edge];
-    VTR_ASSERT_SAFE(valid_mem_id(mem));
-    if (true == edge_inv_mem_[edge]) {
-      mem_bits[mem] = false;
-    } else {
-      mem_bits[mem] = true;
-    }
-
-    /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE(1 == edge_sink_nodes_[edge].size());
-
-    /* Get the fan-out node */
-    MuxNodeId next_node = edge_sink_nodes_[edge][0];
-
-    /* If next node is the output node we want, we can finish here */
-    if (next_node == node_id(output_id)) {
-      route_success = true;
-      break;
-    }
-
-    /* Add next node to the queue if not visited yet */
-    if (false == visited[next_node]) {
-      visited[next_node] = true;
-      queue.push_back(next_node);
-    }
-  }
+  VTR_ASSERT(size_t(input_id) < inputs_.size());
+  VTR_ASSERT(size_t(output_id) < outputs_.size());
 
+  size_t ipath = size_t(output_id) * inputs_.size() + size_t(input_id);
   /* Routing must be success! */
-  VTR_ASSERT(true == route_success);
+  VTR_ASSERT(true == path_found_[ipath]);
 
-  return mem_bits;
+  return path_mem_bits_[ipath];
 }
 
 /* Find the input node that the memory bits will route an output node to
@@ -670,7 +547,7 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(
      * then mark it visited and enqueue it
      */
     MuxEdgeId next_edge = MuxEdgeId::INVALID();
-    for (const MuxEdgeId& edge : node_in_edges_[node_to_expand]) {
+    for (const MuxEdgeId& edge : node_in_edges(node_to_expand)) {
       /* Configure the mem bits and find the edge that will propagate the signal
        * if inv_mem is enabled, it means false to enable this edge
        * otherwise, it is true to enable this edge
@@ -686,10 +563,10 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(
     VTR_ASSERT(MuxEdgeId::INVALID() != next_edge);
 
     /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE(1 == edge_src_nodes_[next_edge].size());
+    VTR_ASSERT_SAFE(1 == edge_src_nodes(next_edge).size());
 
     /* Get the fan-in node */
-    MuxNodeId next_node = edge_src_nodes_[next_edge][0];
+    MuxNodeId next_node = *(edge_src_nodes(next_edge).begin());
 
     /* If next node is an input node, we can finish here */
     if (true == is_node_input(next_node)) {
@@ -1144,6 +1021,9 @@ void MuxGraph::build_mux_graph(const CircuitLibrary& circuit_lib,
       (true == circuit_lib.is_lut_fracturable(circuit_model))) {
     add_fracturable_outputs(circuit_lib, circuit_model);
   }
+
+  /* The graph will not be modified any more, compile it for the readers */
+  compile();
 }
 
 /* Build fast node lookup */
@@ -1189,6 +1069,116 @@ void MuxGraph::build_mem_lookup() {
   }
 }
 
+/********************************************************************
+ * Build the compiled form of the graph, which is queried by all the
+ * readers. It should be called once the graph is finalized, i.e., after
+ * the node and mem look-ups are built
+ *******************************************************************/
+void MuxGraph::compile() {
+  /* Inputs, outputs and non-input nodes, level by level */
+  inputs_.clear();
+  outputs_.clear();
+  non_input_nodes_.clear();
+  for (const auto& lvl_nodes : node_lookup_) {
+    inputs_.insert(inputs_.end(), lvl_nodes[MUX_INPUT_NODE].begin(),
+                   lvl_nodes[MUX_INPUT_NODE].end());
+    outputs_.insert(outputs_.end(), lvl_nodes[MUX_OUTPUT_NODE].begin(),
+                    lvl_nodes[MUX_OUTPUT_NODE].end());
+    for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES);
+         ++node_type) {
+      if (size_t(MUX_INPUT_NODE) == node_type) {
+        continue;
+      }
+      non_input_nodes_.insert(non_input_nodes_.end(),
+                              lvl_nodes[node_type].begin(),
+                              lvl_nodes[node_type].end());
+    }
+  }
+
+  /* Nodes indexed by input and output ids */
+  input_nodes_.clear();
+  input_nodes_.resize(inputs_.size(), MuxNodeId::INVALID());
+  for (const MuxNodeId& node : inputs_) {
+    VTR_ASSERT(size_t(node_input_ids_[node]) < input_nodes_.size());
+    input_nodes_[node_input_ids_[node]] = node;
+  }
+  output_nodes_.clear();
+  output_nodes_.resize(outputs_.size(), MuxNodeId::INVALID());
+  for (const MuxNodeId& node : outputs_) {
+    VTR_ASSERT(size_t(node_output_ids_[node]) < output_nodes_.size());
+    output_nodes_[node_output_ids_[node]] = node;
+  }
+
+  /* Nodes indexed by levels and indices at each level */
+  level_node_offsets_.assign(1, 0);
+  level_nodes_.clear();
+  for (const auto& lvl_nodes : node_lookup_) {
+    size_t offset = level_nodes_.size();
+    size_t num_nodes = 0;
+    for (const auto& nodes_by_type : lvl_nodes) {
+      for (const MuxNodeId& node : nodes_by_type) {
+        num_nodes = std::max(num_nodes, node_ids_at_level_[node] + 1);
+      }
+    }
+    level_nodes_.resize(offset + num_nodes, MuxNodeId::INVALID());
+    for (const auto& nodes_by_type : lvl_nodes) {
+      for (const MuxNodeId& node : nodes_by_type) {
+        /* Each index at a level is used by only one node */
+        VTR_ASSERT(MuxNodeId::INVALID() ==
+                   level_nodes_[offset + node_ids_at_level_[node]]);
+        level_nodes_[offset + node_ids_at_level_[node]] = node;
+      }
+    }
+    level_node_offsets_.push_back(level_nodes_.size());
+  }
+
+  /* Incoming edges of nodes and source nodes of edges in CSR format */
+  csr_in_edge_offsets_.assign(1, 0);
+  csr_in_edges_.clear();
+  for (const MuxNodeId& node : node_ids_) {
+    csr_in_edges_.insert(csr_in_edges_.end(), node_in_edges_[node].begin(),
+                         node_in_edges_[node].end());
+    csr_in_edge_offsets_.push_back(csr_in_edges_.size());
+  }
+  csr_src_node_offsets_.assign(1, 0);
+  csr_src_nodes_.clear();
+  for (const MuxEdgeId& edge : edge_ids_) {
+    csr_src_nodes_.insert(csr_src_nodes_.end(), edge_src_nodes_[edge].begin(),
+                          edge_src_nodes_[edge].end());
+    csr_src_node_offsets_.push_back(csr_src_nodes_.size());
+  }
+
+  /* Memory bits of each path. Each node has only 1 fan-out, so the path of
+   * an input is a chain, which passes all the outputs it can reach.
+   * If inv_mem is enabled, it means 0 to enable an edge,
+   * otherwise, it is 1 to enable an edge
+   */
+  path_mem_bits_.clear();
+  path_mem_bits_.resize(outputs_.size() * inputs_.size());
+  path_found_.assign(outputs_.size() * inputs_.size(), false);
+  for (const MuxNodeId& input_node : inputs_) {
+    vtr::vector<MuxMemId, bool> mem_bits(mem_ids_.size(), false);
+    MuxNodeId node = input_node;
+    while (0 < node_out_edges_[node].size()) {
+      MuxEdgeId edge = node_out_edges_[node][0];
+      MuxMemId mem = edge_mem_ids_[edge];
+      VTR_ASSERT_SAFE(valid_mem_id(mem));
+      mem_bits[mem] = !edge_inv_mem_[edge];
+
+      /* each edge must have 1 fan-out */
+      VTR_ASSERT_SAFE(1 == edge_sink_nodes_[edge].size());
+      node = edge_sink_nodes_[edge][0];
+      if (MUX_OUTPUT_NODE != node_types_[node]) {
+        continue;
+      }
+      size_t ipath = size_t(node_output_ids_[node]) * inputs_.size() +
+                     size_t(node_input_ids_[input_node]);
+      path_mem_bits_[ipath] = mem_bits;
+      path_found_[ipath] = true;
+    }
+  }
+}
+
 /* Invalidate (empty) the node fast lookup*/
 void MuxGraph::invalidate_node_lookup() { node_lookup_.clear(); }
 
@@ -1243,8 +1233,6 @@ bool MuxGraph::valid_level(const size_t& level) const {
   return level < num_node_levels();
 }
 
-bool MuxGraph::valid_node_lookup() const { return node_lookup_.empty(); }
-
 /* validate a mux graph and see if it is valid */
 bool MuxGraph::valid_mux_graph() const {
   /* A valid MUX graph should be
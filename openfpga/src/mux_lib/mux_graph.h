@@ -38,6 +38,15 @@ namespace openfpga {
  * mux_inputs--->| Branch[N] |--->|        |
  *               +-----------+    +--------+
  *
+ * Once a graph is built, it is compiled into an immutable form, where
+ * - the inputs, outputs and nodes at each level are stored in contiguous
+ *   arrays
+ * - the incoming edges of each node and the source nodes of each edge are
+ *   stored in compressed-sparse-row (CSR) format
+ * - the memory bits which route each input to each output are precomputed
+ * All the readers, e.g., bitstream generator and netlist writers, query
+ * the compiled form without any memory allocation
+ *
  *************************************************/
 class MuxGraph {
  private: /* data types used only in this class */
@@ -57,6 +66,12 @@ class MuxGraph {
   typedef vtr::Range<edge_iterator> edge_range;
   typedef vtr::Range<mem_iterator> mem_range;
 
+  /* Ranges of the edges of a node and of the nodes of an edge */
+  typedef std::vector<MuxNodeId>::const_iterator node_list_iterator;
+  typedef std::vector<MuxEdgeId>::const_iterator edge_list_iterator;
+  typedef vtr::Range<node_list_iterator> node_list_range;
+  typedef vtr::Range<edge_list_iterator> edge_list_range;
+
  public: /* Public Constructors */
   /* Create an object based on a Circuit Model which is MUX */
   MuxGraph(const CircuitLibrary& circuit_lib,
@@ -69,7 +84,7 @@ class MuxGraph {
  public: /* Public accessors: Aggregates */
   node_range nodes() const;
   /* Find the non-input nodes */
-  std::vector<MuxNodeId> non_input_nodes() const;
+  const std::vector<MuxNodeId>& non_input_nodes() const;
   edge_range edges() const;
   mem_range memories() const;
   /* Find the number of levels in terms of the multiplexer */
@@ -80,10 +95,10 @@ class MuxGraph {
  public: /* Public accessors: Data query */
   /* Find the number of inputs in the MUX graph */
   size_t num_inputs() const;
-  std::vector<MuxNodeId> inputs() const;
+  const std::vector<MuxNodeId>& inputs() const;
   /* Find the number of outputs in the MUX graph */
   size_t num_outputs() const;
-  std::vector<MuxNodeId> outputs() const;
+  const std::vector<MuxNodeId>& outputs() const;
   /* Find the edge between two MUX nodes */
   std::vector<MuxEdgeId> find_edges(const MuxNodeId& from_node,
                                     const MuxNodeId& to_node) const;
@@ -95,7 +110,7 @@ class MuxGraph {
   /* Find the number of SRAMs at a level in the MUX graph */
   size_t num_memory_bits_at_level(const size_t& level) const;
   /* Return memory id at level */
-  std::vector<MuxMemId> memories_at_level(const size_t& level) const;
+  const std::vector<MuxMemId>& memories_at_level(const size_t& level) const;
   /* Find the number of nodes at a given level in the MUX graph */
   size_t num_nodes_at_level(const size_t& level) const;
   /* Find the level of a node */
@@ -103,9 +118,9 @@ class MuxGraph {
   /* Find the index of a node at its level */
   size_t node_index_at_level(const MuxNodeId& node) const;
   /* Find the input edges for a node */
-  std::vector<MuxEdgeId> node_in_edges(const MuxNodeId& node) const;
+  edge_list_range node_in_edges(const MuxNodeId& node) const;
   /* Find the input nodes for a edge */
-  std::vector<MuxNodeId> edge_src_nodes(const MuxEdgeId& edge) const;
+  node_list_range edge_src_nodes(const MuxEdgeId& edge) const;
   /* Find the mem that control the edge */
   MuxMemId find_edge_mem(const MuxEdgeId& edge) const;
   /* Identify if the edge is controlled by the inverted output of a mem */
@@ -133,10 +148,11 @@ class MuxGraph {
   /* Identify if the node is an output of the MUX */
   bool is_node_output(const MuxNodeId& node_id) const;
   /* Decode memory bits based on an input id and an output id
-   * This function will start from the input node
-   * and do a forward propagation until reaching the output node
+   * The memory bits are precomputed when the graph is compiled, by
+   * starting from the input node and doing a forward propagation until
+   * reaching the output node
    */
-  vtr::vector<MuxMemId, bool> decode_memory_bits(
+  const vtr::vector<MuxMemId, bool>& decode_memory_bits(
     const MuxInputId& input_id, const MuxOutputId& output_id) const;
   /* Find the input node that the memory bits will route an output node to
    * This function backward propagate from the output node to an input node
@@ -179,6 +195,8 @@ class MuxGraph {
   void build_node_lookup();
   /* Build fast mem lookup */
   void build_mem_lookup();
+  /* Build the compiled form of a finalized graph */
+  void compile();
 
  private: /* Private validators */
   /* valid ids */
@@ -188,8 +206,7 @@ class MuxGraph {
   bool valid_input_id(const MuxInputId& input_id) const;
   bool valid_output_id(const MuxOutputId& output_id) const;
   bool valid_level(const size_t& level) const;
-  /* validate/invalidate node lookup */
-  bool valid_node_lookup() const;
+  /* invalidate node lookup */
   void invalidate_node_lookup();
   void invalidate_mem_lookup();
   /* validate graph */
@@ -234,6 +251,33 @@ class MuxGraph {
     node_lookup_; /* [num_levels][num_types][num_nodes_per_level] */
   typedef std::vector<std::vector<MuxMemId>> MemLookup;
   mutable MemLookup mem_lookup_; /* [num_levels][num_mems_per_level] */
+
+  /* Compiled form of the graph. The adjacency lists above are only used to
+   * build and validate the graph, and to find the edges between two nodes.
+   * - The inputs, outputs and non-input nodes are sorted by levels.
+   * - The nodes at level i are the elements of level_nodes_ in the range
+   *   [level_node_offsets_[i], level_node_offsets_[i + 1]), indexed by
+   *   their index at the level.
+   * - The incoming edges of node i are the elements of csr_in_edges_ in the
+   *   range [csr_in_edge_offsets_[i], csr_in_edge_offsets_[i + 1]), and so
+   *   are the source nodes of each edge.
+   * - The memory bits routing input i to output o are the element
+   *   [o * num_inputs + i] of path_mem_bits_. Note that some inputs cannot
+   *   be routed to the outputs of a fracturable LUT
+   */
+  std::vector<MuxNodeId> inputs_;
+  std::vector<MuxNodeId> outputs_;
+  std::vector<MuxNodeId> non_input_nodes_;
+  vtr::vector<MuxInputId, MuxNodeId> input_nodes_;
+  vtr::vector<MuxOutputId, MuxNodeId> output_nodes_;
+  std::vector<size_t> level_node_offsets_;
+  std::vector<MuxNodeId> level_nodes_;
+  std::vector<size_t> csr_in_edge_offsets_;
+  std::vector<MuxEdgeId> csr_in_edges_;
+  std::vector<size_t> csr_src_node_offsets_;
+  std::vector<MuxNodeId> csr_src_nodes_;
+  std::vector<vtr::vector<MuxMemId, bool>> path_mem_bits_;
+  std::vector<bool> path_found_;
 };
 
 } /* End namespace openfpga*/
@@ -32,7 +32,11 @@ MuxId MuxLibrary::mux_graph(const CircuitModelId& circuit_model,
   /* Validate circuit model id and mux_size */
   VTR_ASSERT_SAFE(valid_mux_size(circuit_model, mux_size));
 
-  return mux_lookup_[circuit_model][mux_size];
+  auto it = mux_lookup_.find(t_mux_spec(circuit_model, mux_size));
+  if (it == mux_lookup_.end()) {
+    return MuxId::INVALID();
+  }
+  return it->second;
 }
 
 const MuxGraph& MuxLibrary::mux_graph(const MuxId& mux_id) const {
@@ -78,7 +82,7 @@ void MuxLibrary::add_mux(const CircuitLibrary& circuit_lib,
   mux_circuit_models_.push_back(circuit_model);
 
   /* update mux_lookup*/
-  mux_lookup_[circuit_model][mux_size] = mux;
+  mux_lookup_[t_mux_spec(circuit_model, mux_size)] = mux;
 }
 
 /**************************************************
@@ -88,22 +92,22 @@ bool MuxLibrary::valid_mux_id(const MuxId& mux) const {
   return size_t(mux) < mux_ids_.size() && mux_ids_[mux] == mux;
 }
 
-bool MuxLibrary::valid_mux_lookup() const { return mux_lookup_.empty(); }
-
-bool MuxLibrary::valid_mux_circuit_model_id(
-  const CircuitModelId& circuit_model) const {
-  MuxLookup::iterator it = mux_lookup_.find(circuit_model);
-  return (it != mux_lookup_.end());
+/* Each mux has an unique pair of circuit model and size in the look-up */
+bool MuxLibrary::valid_mux_lookup() const {
+  return mux_lookup_.size() == mux_ids_.size();
 }
 
 bool MuxLibrary::valid_mux_size(const CircuitModelId& circuit_model,
                                 const size_t& mux_size) const {
-  if (false == valid_mux_circuit_model_id(circuit_model)) {
-    return false;
-  }
-  std::map<size_t, MuxId>::iterator it =
-    mux_lookup_[circuit_model].find(mux_size);
-  return (it != mux_lookup_[circuit_model].end());
+  return mux_lookup_.end() !=
+         mux_lookup_.find(t_mux_spec(circuit_model, mux_size));
+}
+
+size_t MuxLibrary::t_mux_spec_hash::operator()(const t_mux_spec& spec) const {
+  size_t hash = std::hash<size_t>()(size_t(spec.first));
+  hash ^= std::hash<size_t>()(spec.second) + 0x9e3779b9 + (hash << 6) +
+          (hash >> 2);
+  return hash;
 }
 
 /**************************************************
@@ -10,7 +10,7 @@
 #ifndef MUX_LIBRARY_H
 #define MUX_LIBRARY_H
 
-#include <map>
+#include <unordered_map>
 
 #include "mux_graph.h"
 #include "mux_library_fwd.h"
@@ -47,7 +47,6 @@ class MuxLibrary {
 
  private: /* Private accessors */
   bool valid_mux_lookup() const;
-  bool valid_mux_circuit_model_id(const CircuitModelId& circuit_model) const;
   bool valid_mux_size(const CircuitModelId& circuit_model,
                       const size_t& mux_size) const;
 
@@ -68,10 +67,15 @@ class MuxLibrary {
   // vtr::vector<MuxLocalDecoderId, Decoder> mux_local_encoders_; /* Graphs
   // describing MUX internal structures */
 
-  /* a fast look-up to search mux_graphs with given circuit model and mux size
+  /* a fast look-up to search mux_graphs with given circuit model and mux size.
+   * The key is a pair of circuit model id and mux size
    */
-  typedef std::map<CircuitModelId, std::map<size_t, MuxId>> MuxLookup;
-  mutable MuxLookup mux_lookup_;
+  typedef std::pair<CircuitModelId, size_t> t_mux_spec;
+  struct t_mux_spec_hash {
+    size_t operator()(const t_mux_spec& spec) const;
+  };
+  typedef std::unordered_map<t_mux_spec, MuxId, t_mux_spec_hash> MuxLookup;
+  MuxLookup mux_lookup_;
 };
 
 } /* end namespace openfpga */
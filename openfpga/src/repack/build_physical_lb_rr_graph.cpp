@@ -397,6 +397,9 @@ static LbRRGraph build_lb_type_physical_lb_rr_graph(
     }
   }
 
+  /* The graph is complete. Pack the edges for fast accesses by routers */
+  lb_rr_graph.freeze();
+
   VTR_LOGV(verbose, "\n\tNumber of nodes: %lu\n", lb_rr_graph.nodes().size());
 
   VTR_LOGV(verbose, "\tNumber of edges: %lu\n", lb_rr_graph.edges().size());
@@ -415,12 +418,25 @@ void build_physical_lb_rr_graphs(const DeviceContext& device_ctx,
     "Build routing resource graph for the physical implementation of logical "
     "tile");
 
+  size_t num_reused_graphs = 0;
+  size_t num_built_graphs = 0;
   for (const t_logical_block_type& lb_type : device_ctx.logical_block_types) {
     /* By pass nullptr for pb_graph head */
     if (nullptr == lb_type.pb_graph_head) {
       continue;
     }
 
+    /* By pass the graphs which have been loaded from files */
+    if (false ==
+        device_annotation.physical_lb_rr_graph(lb_type.pb_graph_head).empty()) {
+      VTR_LOGV(verbose,
+               "Reuse the loaded routing resource graph for logical tile "
+               "'%s'\n",
+               lb_type.pb_graph_head->pb_type->name);
+      num_reused_graphs++;
+      continue;
+    }
+
     VTR_LOGV(verbose,
              "Building routing resource graph for logical tile '%s'...",
              lb_type.pb_graph_head->pb_type->name);
@@ -439,8 +455,16 @@ void build_physical_lb_rr_graphs(const DeviceContext& device_ctx,
 
     device_annotation.add_physical_lb_rr_graph(lb_type.pb_graph_head,
                                                lb_rr_graph);
+    num_built_graphs++;
   }
 
+  /* Always report the numbers, so that a miss of the loaded graphs is
+   * visible in the log */
+  VTR_LOG(
+    "Reused %lu loaded and built %lu routing resource graphs of logical "
+    "tiles\n",
+    num_reused_graphs, num_built_graphs);
+
   VTR_LOGV(verbose, "Done\n");
 }
 
@@ -3,6 +3,8 @@
  ******************************************************************************/
 #include "lb_router.h"
 
+#include <algorithm>
+
 #include "lb_rr_graph_utils.h"
 #include "pb_type_graph.h"
 #include "pb_type_utils.h"
@@ -14,6 +16,11 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/* The minimum factor applied to the cost of a node when adjusting the cost by
+ * the fanout of a net, see expand_edges(). The lower bound of the cost to a
+ * sink has to be scaled by the factor to underestimate the actual cost */
+constexpr float LB_ROUTER_MIN_FANOUT_FACTOR = 0.85;
+
 /**************************************************
  * Public Constructors
  *************************************************/
@@ -30,10 +37,14 @@ LbRouter::LbRouter(const LbRRGraph& lb_rr_graph,
   params_.pres_fac = 1;
   params_.pres_fac_mult = 2;
   params_.hist_fac = 0.3;
+  params_.astar = false;
 
   is_routed_ = false;
 
   pres_con_fac_ = 1;
+
+  num_explored_nodes_ = 0;
+  target_lookahead_costs_ = nullptr;
 }
 
 /**************************************************
@@ -73,8 +84,8 @@ std::vector<LbRRNodeId> LbRouter::net_routed_nodes(const NetId& net) const {
   std::vector<LbRRNodeId> routed_nodes;
 
   for (size_t isrc = 0; isrc < lb_net_sources_[net].size(); ++isrc) {
-    t_trace* rt_tree = lb_net_rt_trees_[net][isrc];
-    if (nullptr == rt_tree) {
+    TraceId rt_tree = lb_net_rt_trees_[net][isrc];
+    if (!rt_tree) {
       return routed_nodes;
     }
     /* Walk through the routing tree of the net */
@@ -84,6 +95,12 @@ std::vector<LbRRNodeId> LbRouter::net_routed_nodes(const NetId& net) const {
   return routed_nodes;
 }
 
+std::vector<size_t> LbRouter::iteration_num_reroutes() const {
+  return iteration_num_reroutes_;
+}
+
+size_t LbRouter::num_explored_nodes() const { return num_explored_nodes_; }
+
 /**************************************************
  * Private accessors
  *************************************************/
@@ -105,34 +122,36 @@ bool LbRouter::is_route_success(const LbRRGraph& lb_rr_graph) const {
   return true;
 }
 
-LbRouter::t_trace* LbRouter::find_node_in_rt(t_trace* rt,
-                                             const LbRRNodeId& rt_index) {
-  t_trace* cur;
-  if (rt->current_node == rt_index) {
+LbRouter::TraceId LbRouter::find_node_in_rt(
+  const TraceId& rt, const LbRRNodeId& rt_index) const {
+  TraceId cur;
+  if (traces_[rt].current_node == rt_index) {
     return rt;
   } else {
-    for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-      cur = find_node_in_rt(&rt->next_nodes[i], rt_index);
-      if (cur != nullptr) {
+    for (TraceId next = traces_[rt].first_child; next;
+         next = traces_[next].next_sibling) {
+      cur = find_node_in_rt(next, rt_index);
+      if (cur) {
         return cur;
       }
     }
   }
-  return nullptr;
+  return TraceId::INVALID();
 }
 
 bool LbRouter::route_has_conflict(const LbRRGraph& lb_rr_graph,
-                                  t_trace* rt) const {
+                                  const TraceId& rt) const {
   t_mode* cur_mode = nullptr;
-  for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-    std::vector<LbRREdgeId> edges =
-      lb_rr_graph.find_edge(rt->current_node, rt->next_nodes[i].current_node);
+  for (TraceId next = traces_[rt].first_child; next;
+       next = traces_[next].next_sibling) {
+    std::vector<LbRREdgeId> edges = lb_rr_graph.find_edge(
+      traces_[rt].current_node, traces_[next].current_node);
     VTR_ASSERT(1 == edges.size());
     t_mode* new_mode = lb_rr_graph.edge_mode(edges[0]);
     if (cur_mode != nullptr && cur_mode != new_mode) {
       return true;
     }
-    if (route_has_conflict(lb_rr_graph, &rt->next_nodes[i]) == true) {
+    if (route_has_conflict(lb_rr_graph, next) == true) {
       return true;
     }
     cur_mode = new_mode;
@@ -142,14 +161,15 @@ bool LbRouter::route_has_conflict(const LbRRGraph& lb_rr_graph,
 }
 
 void LbRouter::rec_collect_trace_nodes(
-  const t_trace* trace, std::vector<LbRRNodeId>& routed_nodes) const {
+  const TraceId& trace, std::vector<LbRRNodeId>& routed_nodes) const {
   if (routed_nodes.end() == std::find(routed_nodes.begin(), routed_nodes.end(),
-                                      trace->current_node)) {
-    routed_nodes.push_back(trace->current_node);
+                                      traces_[trace].current_node)) {
+    routed_nodes.push_back(traces_[trace].current_node);
   }
 
-  for (const t_trace& next : trace->next_nodes) {
-    rec_collect_trace_nodes(&next, routed_nodes);
+  for (TraceId next = traces_[trace].first_child; next;
+       next = traces_[next].next_sibling) {
+    rec_collect_trace_nodes(next, routed_nodes);
   }
 }
 
@@ -170,7 +190,8 @@ LbRouter::NetId LbRouter::create_net_to_route(
 
   lb_net_sources_.push_back(sources);
   lb_net_sinks_.push_back(terminals);
-  lb_net_rt_trees_.push_back(std::vector<t_trace*>(sources.size(), nullptr));
+  lb_net_rt_trees_.push_back(
+    std::vector<TraceId>(sources.size(), TraceId::INVALID()));
 
   return net;
 }
@@ -219,6 +240,8 @@ void LbRouter::set_physical_pb_modes(
   }
 }
 
+void LbRouter::set_astar(const bool& enabled) { params_.astar = enabled; }
+
 bool LbRouter::try_route_net(
   const LbRRGraph& lb_rr_graph, const AtomNetlist& atom_nlist,
   const NetId& net_idx, t_expansion_node& exp_node,
@@ -237,6 +260,8 @@ bool LbRouter::try_route_net(
     return true;
   }
 
+  iteration_num_reroutes_.back()++;
+
   std::vector<bool> sink_routed(lb_net_sinks_[net_idx].size(), false);
 
   for (size_t isrc = 0; isrc < lb_net_sources_[net_idx].size(); ++isrc) {
@@ -247,8 +272,8 @@ bool LbRouter::try_route_net(
 
     commit_remove_rt(lb_rr_graph, lb_net_rt_trees_[net_idx][isrc], RT_REMOVE,
                      mode_map);
-    free_net_rt(lb_net_rt_trees_[net_idx][isrc]);
-    lb_net_rt_trees_[net_idx][isrc] = nullptr;
+    /* The traces of the ripped-up route tree are left in the arena */
+    lb_net_rt_trees_[net_idx][isrc] = TraceId::INVALID();
     add_source_to_rt(net_idx, isrc);
 
     /* Route each sink of net */
@@ -260,6 +285,9 @@ bool LbRouter::try_route_net(
 
       pq_.clear();
 
+      /* Guide the expansion towards the sink if A* is enabled */
+      set_lookahead_target(lb_rr_graph, lb_net_sinks_[net_idx][isink]);
+
       /* Get lowest cost next node, repeat until a path is found or if it is
        * impossible to route */
       expand_rt(net_idx, net_idx, isrc);
@@ -417,12 +445,17 @@ bool LbRouter::try_route(const LbRRGraph& lb_rr_graph,
 
   std::unordered_map<const t_pb_graph_node*, const t_mode*> mode_map;
 
+  iteration_num_reroutes_.clear();
+  num_explored_nodes_ = 0;
+
   /* Iteratively remove congestion until a successful route is found.
    * Cap the total number of iterations tried so that if a solution does not
    * exist, then the router won't run indefinitely */
   pres_con_fac_ = params_.pres_fac;
   for (int iter = 0;
        iter < params_.max_iterations && !is_routed_ && !is_impossible; iter++) {
+    iteration_num_reroutes_.push_back(0);
+
     unsigned int inet;
     /* Iterate across all nets internal to logic block */
     for (inet = 0; inet < lb_net_ids_.size() && !is_impossible; inet++) {
@@ -434,6 +467,9 @@ bool LbRouter::try_route(const LbRRGraph& lb_rr_graph,
       }
     }
 
+    VTR_LOGV(verbosity, "Iteration %d: rerouted %lu of %lu nets\n", iter,
+             iteration_num_reroutes_.back(), lb_net_ids_.size());
+
     if (!is_impossible) {
       is_routed_ = is_route_success(lb_rr_graph);
     } else {
@@ -606,15 +642,15 @@ bool LbRouter::check_edge_for_route_conflicts(
 }
 
 void LbRouter::commit_remove_rt(
-  const LbRRGraph& lb_rr_graph, t_trace* rt, const e_commit_remove& op,
+  const LbRRGraph& lb_rr_graph, const TraceId& rt, const e_commit_remove& op,
   std::unordered_map<const t_pb_graph_node*, const t_mode*>& mode_map) {
   int incr;
 
-  if (nullptr == rt) {
+  if (!rt) {
     return;
   }
 
-  LbRRNodeId inode = rt->current_node;
+  LbRRNodeId inode = traces_[rt].current_node;
 
   /* Determine if node is being used or removed */
   if (op == RT_COMMIT) {
@@ -635,12 +671,13 @@ void LbRouter::commit_remove_rt(
   t_pb_graph_pin* driver_pin = lb_rr_graph.node_pb_graph_pin(inode);
 
   /* Recursively update route tree */
-  for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
+  for (TraceId next = traces_[rt].first_child; next;
+       next = traces_[next].next_sibling) {
     // Check to see if there is no mode conflict between previous nets.
     // A conflict is present if there are differing modes between a
     // pb_graph_node and its children.
     if (op == RT_COMMIT && mode_status_.try_expand_all_modes) {
-      const LbRRNodeId& node = rt->next_nodes[i].current_node;
+      const LbRRNodeId& node = traces_[next].current_node;
       t_pb_graph_pin* pin = lb_rr_graph.node_pb_graph_pin(node);
 
       if (check_edge_for_route_conflicts(mode_map, driver_pin, pin)) {
@@ -648,19 +685,20 @@ void LbRouter::commit_remove_rt(
       }
     }
 
-    commit_remove_rt(lb_rr_graph, &rt->next_nodes[i], op, mode_map);
+    commit_remove_rt(lb_rr_graph, next, op, mode_map);
   }
 }
 
-bool LbRouter::is_skip_route_net(const LbRRGraph& lb_rr_graph, t_trace* rt) {
+bool LbRouter::is_skip_route_net(const LbRRGraph& lb_rr_graph,
+                                 const TraceId& rt) {
   /* Validate if the rr_graph is the one we used to initialize the router */
   VTR_ASSERT(true == matched_lb_rr_graph(lb_rr_graph));
 
-  if (rt == nullptr) {
+  if (!rt) {
     return false; /* Net is not routed, therefore must route net */
   }
 
-  LbRRNodeId inode = rt->current_node;
+  LbRRNodeId inode = traces_[rt].current_node;
 
   /* Determine if node is overused */
   if (routing_status_[inode].occ > lb_rr_graph.node_capacity(inode)) {
@@ -669,8 +707,9 @@ bool LbRouter::is_skip_route_net(const LbRRGraph& lb_rr_graph, t_trace* rt) {
   }
 
   /* Recursively check that rest of route tree does not have a conflict */
-  for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-    if (!is_skip_route_net(lb_rr_graph, &rt->next_nodes[i])) {
+  for (TraceId next = traces_[rt].first_child; next;
+       next = traces_[next].next_sibling) {
+    if (!is_skip_route_net(lb_rr_graph, next)) {
       return false;
     }
   }
@@ -679,11 +718,17 @@ bool LbRouter::is_skip_route_net(const LbRRGraph& lb_rr_graph, t_trace* rt) {
   return true;
 }
 
-bool LbRouter::add_to_rt(t_trace* rt, const LbRRNodeId& node_index,
+LbRouter::TraceId LbRouter::create_trace(const LbRRNodeId& node) {
+  TraceId trace = TraceId(traces_.size());
+  traces_.emplace_back();
+  traces_[trace].current_node = node;
+  return trace;
+}
+
+bool LbRouter::add_to_rt(const TraceId& rt, const LbRRNodeId& node_index,
                          const NetId& irt_net) {
   std::vector<LbRRNodeId> trace_forward;
-  t_trace* link_node;
-  t_trace curr_node;
+  TraceId link_node;
 
   /* Store path all the way back to route tree */
   LbRRNodeId rt_index = node_index;
@@ -695,7 +740,7 @@ bool LbRouter::add_to_rt(t_trace* rt, const LbRRNodeId& node_index,
 
   /* Find rt_index on the route tree */
   link_node = find_node_in_rt(rt, rt_index);
-  if (link_node == nullptr) {
+  if (!link_node) {
     VTR_LOG("Link node is nullptr. Routing impossible");
     return true;
   }
@@ -704,9 +749,15 @@ bool LbRouter::add_to_rt(t_trace* rt, const LbRRNodeId& node_index,
   LbRRNodeId trace_index;
   while (!trace_forward.empty()) {
     trace_index = trace_forward.back();
-    curr_node.current_node = trace_index;
-    link_node->next_nodes.push_back(curr_node);
-    link_node = &link_node->next_nodes.back();
+    TraceId curr_node = create_trace(trace_index);
+    /* Append the new node to the children of the link node */
+    if (!traces_[link_node].first_child) {
+      traces_[link_node].first_child = curr_node;
+    } else {
+      traces_[traces_[link_node].last_child].next_sibling = curr_node;
+    }
+    traces_[link_node].last_child = curr_node;
+    link_node = curr_node;
     trace_forward.pop_back();
   }
 
@@ -715,19 +766,39 @@ bool LbRouter::add_to_rt(t_trace* rt, const LbRRNodeId& node_index,
 
 void LbRouter::add_source_to_rt(const NetId& inet, const size_t& isrc) {
   /* TODO: Validate net id */
-  VTR_ASSERT(nullptr == lb_net_rt_trees_[inet][isrc]);
-  lb_net_rt_trees_[inet][isrc] = new t_trace;
-  lb_net_rt_trees_[inet][isrc]->current_node = lb_net_sources_[inet][isrc];
+  VTR_ASSERT(!lb_net_rt_trees_[inet][isrc]);
+  lb_net_rt_trees_[inet][isrc] = create_trace(lb_net_sources_[inet][isrc]);
 }
 
-void LbRouter::expand_rt_rec(t_trace* rt, const LbRRNodeId& prev_index,
+void LbRouter::set_lookahead_target(const LbRRGraph& lb_rr_graph,
+                                    const LbRRNodeId& sink) {
+  if (false == params_.astar) {
+    target_lookahead_costs_ = nullptr;
+    return;
+  }
+  /* The lookahead is built only once and shared by all the routings */
+  if (nullptr == lookahead_) {
+    lookahead_ = std::make_unique<LbRouterLookahead>(lb_rr_graph);
+  }
+  target_lookahead_costs_ = &(lookahead_->sink_costs(sink));
+}
+
+float LbRouter::lookahead_cost(const LbRRNodeId& node) const {
+  if (nullptr == target_lookahead_costs_) {
+    return 0.;
+  }
+  return LB_ROUTER_MIN_FANOUT_FACTOR * (*target_lookahead_costs_)[node];
+}
+
+void LbRouter::expand_rt_rec(const TraceId& rt, const LbRRNodeId& prev_index,
                              const NetId& irt_net,
                              const int& explore_id_index) {
   t_expansion_node enode;
 
   /* Perhaps should use a cost other than zero */
   enode.cost = 0;
-  enode.node_index = rt->current_node;
+  enode.node_index = traces_[rt].current_node;
+  enode.lookahead_cost = lookahead_cost(enode.node_index);
   enode.prev_index = prev_index;
   pq_.push(enode);
   explored_node_tb_[enode.node_index].inet = irt_net;
@@ -736,9 +807,9 @@ void LbRouter::expand_rt_rec(t_trace* rt, const LbRRNodeId& prev_index,
   explored_node_tb_[enode.node_index].enqueue_cost = 0;
   explored_node_tb_[enode.node_index].prev_index = prev_index;
 
-  for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-    expand_rt_rec(&rt->next_nodes[i], rt->current_node, irt_net,
-                  explore_id_index);
+  for (TraceId next = traces_[rt].first_child; next;
+       next = traces_[next].next_sibling) {
+    expand_rt_rec(next, traces_[rt].current_node, irt_net, explore_id_index);
   }
 }
 
@@ -760,7 +831,8 @@ void LbRouter::expand_edges(const LbRRGraph& lb_rr_graph, t_mode* mode,
   int usage;
   float incr_cost;
 
-  for (const LbRREdgeId& iedge : lb_rr_graph.node_out_edges(cur_inode, mode)) {
+  for (const LbRREdgeId& iedge :
+       lb_rr_graph.node_out_edge_range(cur_inode, mode)) {
     /* Init new expansion node */
     enode.prev_index = cur_inode;
     enode.node_index = lb_rr_graph.edge_sink_node(iedge);
@@ -797,7 +869,8 @@ void LbRouter::expand_edges(const LbRRGraph& lb_rr_graph, t_mode* mode,
                         ->parent_node->pb_type->modes[0]);
       }
     }
-    if (lb_rr_graph.node_out_edges(enode.node_index, next_mode).size() > 1) {
+    if (lb_rr_graph.node_out_edge_range(enode.node_index, next_mode).size() >
+        1) {
       fanout_factor = 0.85 + (0.25 / net_fanout);
     } else {
       fanout_factor = 1.15 - (0.25 / net_fanout);
@@ -805,6 +878,7 @@ void LbRouter::expand_edges(const LbRRGraph& lb_rr_graph, t_mode* mode,
 
     incr_cost *= fanout_factor;
     enode.cost = cur_cost + incr_cost;
+    enode.lookahead_cost = lookahead_cost(enode.node_index);
 
     /* Add to queue if cost is lower than lowest cost path to this enode */
     if (explored_node_tb_[enode.node_index].enqueue_id == explore_id_index_) {
@@ -877,7 +951,7 @@ void LbRouter::expand_node_all_modes(const LbRRGraph& lb_rr_graph,
   t_mode* cur_mode = routing_status_[cur_inode].mode;
   auto* pin = lb_rr_graph.node_pb_graph_pin(cur_inode);
 
-  for (const LbRREdgeId& edge : lb_rr_graph.node_out_edges(cur_inode)) {
+  for (const LbRREdgeId& edge : lb_rr_graph.node_out_edge_range(cur_inode)) {
     t_mode* mode = lb_rr_graph.edge_mode(edge);
     /* If a mode has been forced, only add edges from that mode, otherwise add
      * edges from all modes. */
@@ -952,6 +1026,7 @@ bool LbRouter::try_expand_nodes(const AtomNetlist& atom_nlist,
          */
         explored_node_tb_[exp_inode].explored_id = explore_id_index_;
         explored_node_tb_[exp_inode].prev_index = exp_node.prev_index;
+        num_explored_nodes_++;
         if (exp_inode != lb_net_sinks_[lb_net][itarget]) {
           if (!try_other_modes) {
             expand_node(lb_rr_graph, exp_node, lb_net_sinks_[lb_net].size());
@@ -1057,11 +1132,11 @@ void LbRouter::reset_explored_node_tb() {
 
 void LbRouter::reset_net_rt() {
   for (const NetId& inet : lb_net_ids_) {
-    for (size_t isrc = 0; isrc < lb_net_sources_[inet].size(); ++isrc) {
-      free_net_rt(lb_net_rt_trees_[inet][isrc]);
-      lb_net_rt_trees_[inet][isrc] = nullptr;
-    }
+    std::fill(lb_net_rt_trees_[inet].begin(), lb_net_rt_trees_[inet].end(),
+              TraceId::INVALID());
   }
+  /* All the traces are released at once, while the memory is kept */
+  traces_.clear();
 }
 
 void LbRouter::reset_routing_status() {
@@ -1072,8 +1147,8 @@ void LbRouter::reset_routing_status() {
 }
 
 void LbRouter::clear_nets() {
-  /* TODO: Trace should no longer use pointers */
   reset_net_rt();
+  reset_illegal_modes();
 
   lb_net_ids_.clear();
   lb_net_atom_net_ids_.clear();
@@ -1084,25 +1159,6 @@ void LbRouter::clear_nets() {
   lb_net_rt_trees_.clear();
 }
 
-void LbRouter::free_net_rt(t_trace* lb_trace) {
-  if (lb_trace != nullptr) {
-    for (unsigned int i = 0; i < lb_trace->next_nodes.size(); i++) {
-      free_lb_trace(&lb_trace->next_nodes[i]);
-    }
-    lb_trace->next_nodes.clear();
-    delete lb_trace;
-  }
-}
-
-void LbRouter::free_lb_trace(t_trace* lb_trace) {
-  if (lb_trace != nullptr) {
-    for (unsigned int i = 0; i < lb_trace->next_nodes.size(); i++) {
-      free_lb_trace(&lb_trace->next_nodes[i]);
-    }
-    lb_trace->next_nodes.clear();
-  }
-}
-
 void LbRouter::reset_illegal_modes() { illegal_modes_.clear(); }
 
 } /* end namespace openfpga */
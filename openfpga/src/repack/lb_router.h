@@ -5,10 +5,12 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include <map>
+#include <memory>
 #include <queue>
 #include <unordered_map>
 #include <vector>
 
+#include "lb_router_lookahead.h"
 #include "lb_rr_graph.h"
 #include "physical_types.h"
 #include "vpr_context.h"
@@ -72,6 +74,8 @@ class LbRouter {
  public: /* Strong ids */
   struct net_id_tag;
   typedef vtr::StrongId<net_id_tag> NetId;
+  struct trace_id_tag;
+  typedef vtr::StrongId<trace_id_tag> TraceId;
 
  public: /* Types and ranges */
   typedef vtr::vector<NetId, NetId>::const_iterator net_iterator;
@@ -98,13 +102,26 @@ class LbRouter {
   /**************************************************************************
    * Data structure forming the route tree of a net within one logic
    *cluster_ctx.blocks. A net is implemented using routing resource nodes. The
-   *t_lb_trace data structure records one of the nodes used by the net and the
+   *t_trace data structure records one of the nodes used by the net and the
    *connections to other nodes
+   *
+   * All the traces are stored in an arena owned by the router, where the
+   * children of a trace are linked through their ids in the order of
+   * creation. As a result, no memory is allocated or freed for each trace
+   * when route trees are ripped up and rebuilt.
    ***************************************************************************/
   struct t_trace {
     LbRRNodeId current_node; /* current t_lb_type_rr_node used by net */
-    std::vector<t_trace>
-      next_nodes; /* index of previous edge that drives current node */
+    TraceId first_child;     /* first node driven by current node */
+    TraceId last_child;      /* last node driven by current node */
+    TraceId next_sibling;    /* next node driven by the same parent node */
+
+    t_trace() {
+      current_node = LbRRNodeId::INVALID();
+      first_child = TraceId::INVALID();
+      last_child = TraceId::INVALID();
+      next_sibling = TraceId::INVALID();
+    }
   };
 
   /**************************************************************************
@@ -115,6 +132,8 @@ class LbRouter {
     float pres_fac;
     float pres_fac_mult;
     float hist_fac;
+    /* Guide the expansion with the lower bound of the cost to the sink */
+    bool astar;
   };
 
   /**************************************************************************
@@ -126,11 +145,14 @@ class LbRouter {
     LbRRNodeId prev_index; /* Index of logic cluster_ctx.blocks rr node that
                               drives this expansion node */
     float cost;
+    float lookahead_cost; /* Lower bound of the cost to reach the sink, which
+                             is always 0 unless A* is enabled */
 
     t_expansion_node() {
       node_index = LbRRNodeId::INVALID();
       prev_index = LbRRNodeId::INVALID();
       cost = 0;
+      lookahead_cost = 0;
     }
   };
 
@@ -138,7 +160,7 @@ class LbRouter {
    public:
     /* Returns true if t1 is earlier than t2 */
     bool operator()(t_expansion_node& e1, t_expansion_node& e2) {
-      if (e1.cost > e2.cost) {
+      if (e1.cost + e1.lookahead_cost > e2.cost + e2.lookahead_cost) {
         return true;
       }
       return false;
@@ -233,6 +255,17 @@ class LbRouter {
    */
   std::vector<LbRRNodeId> net_routed_nodes(const NetId& net) const;
 
+  /**
+   * Get the number of nets which are rerouted in each iteration of the
+   * last routing
+   */
+  std::vector<size_t> iteration_num_reroutes() const;
+
+  /**
+   * Get the number of nodes which are explored in the last routing
+   */
+  size_t num_explored_nodes() const;
+
  public: /* Public mutators */
   /**
    * Add net to be routed
@@ -254,6 +287,14 @@ class LbRouter {
   void set_physical_pb_modes(const LbRRGraph& lb_rr_graph,
                              const VprDeviceAnnotation& device_annotation);
 
+  /**
+   * Enable/disable the A* search. When enabled, the expansion is guided by
+   * the lower bound of the cost from each node to the sink, which is
+   * precomputed by a lookahead for each sink and reused by all the logic
+   * blocks routed by this router
+   */
+  void set_astar(const bool& enabled);
+
   /**
    * Perform routing algorithm on a given logical tile routing resource graph
    * Note: the lb_rr_graph must be the same as you initilized the router!!!
@@ -261,6 +302,13 @@ class LbRouter {
   bool try_route(const LbRRGraph& lb_rr_graph, const AtomNetlist& atom_nlist,
                  const bool& verbosity);
 
+  /**
+   * Remove all the nets as well as their routing results, so that the router
+   * can be reused to route another logical block of the same type.
+   * Memory of internal data, e.g., the route tree arena, is kept for reuse
+   */
+  void clear_nets();
+
  private: /* Private accessors */
   /**
    * Report if the routing is successfully done on a logical block routing
@@ -270,14 +318,16 @@ class LbRouter {
 
   /**
    * Try to find a node in the routing traces recursively
-   * If not found, will return an empty pointer
+   * If not found, will return an invalid id
    */
-  t_trace* find_node_in_rt(t_trace* rt, const LbRRNodeId& rt_index);
+  TraceId find_node_in_rt(const TraceId& rt,
+                          const LbRRNodeId& rt_index) const;
 
-  bool route_has_conflict(const LbRRGraph& lb_rr_graph, t_trace* rt) const;
+  bool route_has_conflict(const LbRRGraph& lb_rr_graph,
+                          const TraceId& rt) const;
 
   /* Recursively find all the nodes in the trace */
-  void rec_collect_trace_nodes(const t_trace* trace,
+  void rec_collect_trace_nodes(const TraceId& trace,
                                std::vector<LbRRNodeId>& routed_nodes) const;
 
  private: /* Private mutators */
@@ -296,13 +346,17 @@ class LbRouter {
     std::unordered_map<const t_pb_graph_node*, const t_mode*>& mode_map,
     const t_pb_graph_pin* driver_pin, const t_pb_graph_pin* pin);
   void commit_remove_rt(
-    const LbRRGraph& lb_rr_graph, t_trace* rt, const e_commit_remove& op,
+    const LbRRGraph& lb_rr_graph, const TraceId& rt, const e_commit_remove& op,
     std::unordered_map<const t_pb_graph_node*, const t_mode*>& mode_map);
-  bool is_skip_route_net(const LbRRGraph& lb_rr_graph, t_trace* rt);
-  bool add_to_rt(t_trace* rt, const LbRRNodeId& node_index,
+  bool is_skip_route_net(const LbRRGraph& lb_rr_graph, const TraceId& rt);
+  TraceId create_trace(const LbRRNodeId& node);
+  bool add_to_rt(const TraceId& rt, const LbRRNodeId& node_index,
                  const NetId& irt_net);
   void add_source_to_rt(const NetId& inet, const size_t& isrc);
-  void expand_rt_rec(t_trace* rt, const LbRRNodeId& prev_index,
+  void set_lookahead_target(const LbRRGraph& lb_rr_graph,
+                            const LbRRNodeId& sink);
+  float lookahead_cost(const LbRRNodeId& node) const;
+  void expand_rt_rec(const TraceId& rt, const LbRRNodeId& prev_index,
                      const NetId& irt_net, const int& explore_id_index);
   void expand_rt(const NetId& inet, const NetId& irt_net, const size_t& isrc);
   void expand_edges(const LbRRGraph& lb_rr_graph, t_mode* mode,
@@ -346,10 +400,6 @@ class LbRouter {
   void reset_routing_status();
   void reset_illegal_modes();
 
-  void clear_nets();
-  void free_net_rt(t_trace* lb_trace);
-  void free_lb_trace(t_trace* lb_trace);
-
  private: /* Stores all data needed by intra-logic cluster_ctx.blocks router */
   /* Logical Netlist Info */
   /* Pointer to vector of intra logic cluster_ctx.blocks nets and their
@@ -372,7 +422,14 @@ class LbRouter {
   vtr::vector<NetId, std::vector<LbRRNodeId>> lb_net_sinks_;
 
   /* Route tree head for each source of each net */
-  vtr::vector<NetId, std::vector<t_trace*>> lb_net_rt_trees_;
+  vtr::vector<NetId, std::vector<TraceId>> lb_net_rt_trees_;
+
+  /* Arena of the traces of all the route trees. A route tree which is ripped
+   * up is simply detached from its net, while its traces stay in the arena
+   * until all the route trees are reset. Note that the arena is cleared
+   * without releasing its memory, so that it can be reused by the next
+   * routing */
+  vtr::vector<TraceId, t_trace> traces_;
 
   /* Logical-to-physical mapping info */
   vtr::vector<LbRRNodeId, t_routing_status>
@@ -413,6 +470,17 @@ class LbRouter {
 
   /* current congestion factor */
   float pres_con_fac_;
+
+  /* Number of nets which are rerouted in each iteration */
+  std::vector<size_t> iteration_num_reroutes_;
+
+  /* Number of nodes which are explored during routing */
+  size_t num_explored_nodes_;
+
+  /* Lower bounds of the costs to sinks, created only when A* is enabled */
+  std::unique_ptr<LbRouterLookahead> lookahead_;
+  /* Lower bounds of the costs to the sink being routed */
+  const vtr::vector<LbRRNodeId, float>* target_lookahead_costs_;
 };
 
 } /* end namespace openfpga */
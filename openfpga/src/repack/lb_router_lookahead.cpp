@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Memember functions for data structure LbRouterLookahead
+ ******************************************************************************/
+#include "lb_router_lookahead.h"
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "vtr_assert.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+LbRouterLookahead::LbRouterLookahead(const LbRRGraph& lb_rr_graph)
+  : lb_rr_graph_(lb_rr_graph) {
+  VTR_ASSERT(true == lb_rr_graph_.frozen());
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+size_t LbRouterLookahead::num_sinks() const { return sink_costs_.size(); }
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+/********************************************************************
+ * The router adds the intrinsic costs of an edge and its sink node when
+ * expanding through the edge. Therefore, walking backward from the sink,
+ * the cost of the source node of an edge is the cost of its sink node plus
+ * the intrinsic costs of the edge and its sink node
+ *******************************************************************/
+const vtr::vector<LbRRNodeId, float>& LbRouterLookahead::sink_costs(
+  const LbRRNodeId& sink) {
+  VTR_ASSERT(true == lb_rr_graph_.valid_node_id(sink));
+
+  auto result = sink_costs_.find(size_t(sink));
+  if (result != sink_costs_.end()) {
+    return result->second;
+  }
+
+  vtr::vector<LbRRNodeId, float>& costs = sink_costs_[size_t(sink)];
+  costs.resize(lb_rr_graph_.nodes().size(),
+               std::numeric_limits<float>::infinity());
+
+  typedef std::pair<float, LbRRNodeId> t_cost_node;
+  std::priority_queue<t_cost_node, std::vector<t_cost_node>,
+                      std::greater<t_cost_node>>
+    pq;
+  costs[sink] = 0.;
+  pq.push(t_cost_node(0., sink));
+  while (!pq.empty()) {
+    t_cost_node cur = pq.top();
+    pq.pop();
+    /* Skip the outdated entries */
+    if (cur.first > costs[cur.second]) {
+      continue;
+    }
+    float node_cost = lb_rr_graph_.node_intrinsic_cost(cur.second);
+    for (const LbRREdgeId& edge : lb_rr_graph_.node_in_edge_range(cur.second)) {
+      LbRRNodeId src_node = lb_rr_graph_.edge_src_node(edge);
+      float src_cost =
+        cur.first + node_cost + lb_rr_graph_.edge_intrinsic_cost(edge);
+      if (src_cost < costs[src_node]) {
+        costs[src_node] = src_cost;
+        pq.push(t_cost_node(src_cost, src_node));
+      }
+    }
+  }
+
+  return costs;
+}
+
+} /* end namespace openfpga */
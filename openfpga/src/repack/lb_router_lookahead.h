@@ -0,0 +1,51 @@
+#ifndef LB_ROUTER_LOOKAHEAD_H
+#define LB_ROUTER_LOOKAHEAD_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <unordered_map>
+
+#include "lb_rr_graph.h"
+#include "vtr_vector.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A lookahead for the router of programmable logic blocks, which provides
+ * the lower bound of the cost from any node to a sink node of a LbRRGraph.
+ *
+ * The lower bound is the minimum sum of the intrinsic costs of the nodes
+ * and edges on any path from a node to the sink, regardless of the modes
+ * and the congestion. The lower bounds to a sink are computed by a
+ * backward Dijkstra search when the sink is queried for the first time,
+ * and then cached. Since all the logic blocks of the same type share one
+ * LbRRGraph, the lookahead is computed only once for each type.
+ *
+ * Note:
+ *   - The LbRRGraph must be frozen
+ *   - The lookahead is bound to the LbRRGraph used to build it
+ *******************************************************************/
+class LbRouterLookahead {
+ public: /* Public constructors */
+  LbRouterLookahead(const LbRRGraph& lb_rr_graph);
+
+ public: /* Public accessors */
+  /* Number of sinks whose lower bounds have been computed */
+  size_t num_sinks() const;
+
+ public: /* Public mutators */
+  /* Get the lower bound costs from all the nodes to a sink, which are
+   * computed if not available yet. Nodes which cannot reach the sink have
+   * an infinite cost */
+  const vtr::vector<LbRRNodeId, float>& sink_costs(const LbRRNodeId& sink);
+
+ private: /* Internal data */
+  const LbRRGraph& lb_rr_graph_;
+  std::unordered_map<size_t, vtr::vector<LbRRNodeId, float>> sink_costs_;
+};
+
+} /* end namespace openfpga */
+
+#endif
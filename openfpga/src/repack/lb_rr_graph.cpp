@@ -14,6 +14,7 @@ namespace openfpga {
  * Public Constructors
  *************************************************/
 LbRRGraph::LbRRGraph() {
+  frozen_ = false;
   ext_source_node_ = LbRRNodeId::INVALID();
   ext_sink_node_ = LbRRNodeId::INVALID();
 }
@@ -54,6 +55,10 @@ float LbRRGraph::node_intrinsic_cost(const LbRRNodeId& node) const {
 
 std::vector<LbRREdgeId> LbRRGraph::node_in_edges(const LbRRNodeId& node) const {
   VTR_ASSERT(true == valid_node_id(node));
+  if (true == frozen_) {
+    edge_list_range in_edges = node_in_edge_range(node);
+    return std::vector<LbRREdgeId>(in_edges.begin(), in_edges.end());
+  }
   return node_in_edges_[node];
 }
 
@@ -62,7 +67,7 @@ std::vector<LbRREdgeId> LbRRGraph::node_in_edges(const LbRRNodeId& node,
   std::vector<LbRREdgeId> in_edges;
 
   VTR_ASSERT(true == valid_node_id(node));
-  for (const LbRREdgeId& edge : node_in_edges_[node]) {
+  for (const LbRREdgeId& edge : node_in_edges(node)) {
     if (mode == edge_mode(edge)) {
       in_edges.push_back(edge);
     }
@@ -74,14 +79,22 @@ std::vector<LbRREdgeId> LbRRGraph::node_in_edges(const LbRRNodeId& node,
 std::vector<LbRREdgeId> LbRRGraph::node_out_edges(
   const LbRRNodeId& node) const {
   VTR_ASSERT(true == valid_node_id(node));
+  if (true == frozen_) {
+    edge_list_range out_edges = node_out_edge_range(node);
+    return std::vector<LbRREdgeId>(out_edges.begin(), out_edges.end());
+  }
   return node_out_edges_[node];
 }
 
 std::vector<LbRREdgeId> LbRRGraph::node_out_edges(const LbRRNodeId& node,
                                                   t_mode* mode) const {
-  std::vector<LbRREdgeId> out_edges;
-
   VTR_ASSERT(true == valid_node_id(node));
+  if (true == frozen_) {
+    edge_list_range out_edges = node_out_edge_range(node, mode);
+    return std::vector<LbRREdgeId>(out_edges.begin(), out_edges.end());
+  }
+
+  std::vector<LbRREdgeId> out_edges;
   for (const LbRREdgeId& edge : node_out_edges_[node]) {
     if (mode == edge_mode(edge)) {
       out_edges.push_back(edge);
@@ -91,17 +104,60 @@ std::vector<LbRREdgeId> LbRRGraph::node_out_edges(const LbRRNodeId& node,
   return out_edges;
 }
 
+LbRRGraph::edge_list_range LbRRGraph::node_in_edge_range(
+  const LbRRNodeId& node) const {
+  VTR_ASSERT(true == valid_node_id(node));
+  VTR_ASSERT(true == frozen_);
+  return vtr::make_range(
+    csr_in_edges_.begin() + csr_in_edge_offsets_[size_t(node)],
+    csr_in_edges_.begin() + csr_in_edge_offsets_[size_t(node) + 1]);
+}
+
+LbRRGraph::edge_list_range LbRRGraph::node_out_edge_range(
+  const LbRRNodeId& node) const {
+  VTR_ASSERT(true == valid_node_id(node));
+  VTR_ASSERT(true == frozen_);
+  return vtr::make_range(
+    csr_out_edges_.begin() + csr_out_edge_offsets_[size_t(node)],
+    csr_out_edges_.begin() + csr_out_edge_offsets_[size_t(node) + 1]);
+}
+
+LbRRGraph::edge_list_range LbRRGraph::node_out_edge_range(
+  const LbRRNodeId& node, t_mode* mode) const {
+  VTR_ASSERT(true == valid_node_id(node));
+  VTR_ASSERT(true == frozen_);
+  /* A node has only a few modes, a linear search is fast enough */
+  for (size_t irange = csr_out_mode_offsets_[size_t(node)];
+       irange < csr_out_mode_offsets_[size_t(node) + 1]; ++irange) {
+    const t_mode_edge_range& mode_range = csr_out_mode_ranges_[irange];
+    if (mode == mode_range.mode) {
+      return vtr::make_range(csr_out_mode_edges_.begin() + mode_range.begin,
+                             csr_out_mode_edges_.begin() + mode_range.end);
+    }
+  }
+  /* No edges under the mode, return an empty range */
+  return vtr::make_range(csr_out_mode_edges_.end(), csr_out_mode_edges_.end());
+}
+
 LbRRNodeId LbRRGraph::find_node(const e_lb_rr_type& type,
                                 const t_pb_graph_pin* pb_graph_pin) const {
-  if (size_t(type) >= node_lookup_.size()) {
+  if ((nullptr == pb_graph_pin) || (size_t(type) >= node_lookup_.size())) {
     return LbRRNodeId::INVALID();
   }
 
-  if (0 == node_lookup_[size_t(type)].count(pb_graph_pin)) {
+  size_t pin_index = size_t(pb_graph_pin->pin_count_in_cluster);
+  if (pin_index >= node_lookup_[size_t(type)].size()) {
     return LbRRNodeId::INVALID();
   }
 
-  return node_lookup_[size_t(type)].at(pb_graph_pin);
+  LbRRNodeId node = node_lookup_[size_t(type)][pin_index];
+  /* The pin may come from another pb_graph, where its index in cluster may
+   * point to a different pin */
+  if ((false == valid_node_id(node)) ||
+      (pb_graph_pin != node_pb_graph_pins_[node])) {
+    return LbRRNodeId::INVALID();
+  }
+  return node;
 }
 
 LbRRNodeId LbRRGraph::ext_source_node() const { return ext_source_node_; }
@@ -111,6 +167,14 @@ LbRRNodeId LbRRGraph::ext_sink_node() const { return ext_sink_node_; }
 std::vector<LbRREdgeId> LbRRGraph::find_edge(
   const LbRRNodeId& src_node, const LbRRNodeId& sink_node) const {
   std::vector<LbRREdgeId> edges;
+  if (true == frozen_) {
+    for (const LbRREdgeId& edge : node_out_edge_range(src_node)) {
+      if (sink_node == edge_sink_node(edge)) {
+        edges.push_back(edge);
+      }
+    }
+    return edges;
+  }
   for (const LbRREdgeId& edge : node_out_edges_[src_node]) {
     if (sink_node == edge_sink_node(edge)) {
       edges.push_back(edge);
@@ -139,6 +203,8 @@ t_mode* LbRRGraph::edge_mode(const LbRREdgeId& edge) const {
   return edge_modes_[edge];
 }
 
+bool LbRRGraph::frozen() const { return frozen_; }
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
@@ -163,6 +229,9 @@ void LbRRGraph::reserve_edges(const unsigned long& num_edges) {
 }
 
 LbRRNodeId LbRRGraph::create_node(const e_lb_rr_type& type) {
+  /* A frozen graph can not be modified */
+  VTR_ASSERT(false == frozen_);
+
   /* Create an new id */
   LbRRNodeId node = LbRRNodeId(node_ids_.size());
   node_ids_.push_back(node);
@@ -210,19 +279,31 @@ void LbRRGraph::set_node_pb_graph_pin(const LbRRNodeId& node,
   VTR_ASSERT(true == valid_node_id(node));
   node_pb_graph_pins_[node] = pb_graph_pin;
 
+  /* Only nodes with a pb_graph_pin can be found in the fast node look-up */
+  if (nullptr == pb_graph_pin) {
+    return;
+  }
+
   /* Register in fast node look-up */
   if (node_type(node) >= node_lookup_.size()) {
     node_lookup_.resize(node_type(node) + 1);
   }
 
-  if (0 < node_lookup_[node_type(node)].count(pb_graph_pin)) {
+  VTR_ASSERT(0 <= pb_graph_pin->pin_count_in_cluster);
+  size_t pin_index = size_t(pb_graph_pin->pin_count_in_cluster);
+  std::vector<LbRRNodeId>& type_lookup = node_lookup_[node_type(node)];
+  if (pin_index >= type_lookup.size()) {
+    type_lookup.resize(pin_index + 1, LbRRNodeId::INVALID());
+  }
+
+  if (true == valid_node_id(type_lookup[pin_index])) {
     VTR_LOG_WARN(
       "Detect pb_graph_pin '%s[%lu]' is mapped to LbRRGraph nodes (exist: %lu) "
       "and (to be mapped: %lu). Overwrite is done\n",
       pb_graph_pin->port->name, pb_graph_pin->pin_number,
-      size_t(node_lookup_[node_type(node)].at(pb_graph_pin)), size_t(node));
+      size_t(type_lookup[pin_index]), size_t(node));
   }
-  node_lookup_[node_type(node)][pb_graph_pin] = node;
+  type_lookup[pin_index] = node;
 }
 
 void LbRRGraph::set_node_intrinsic_cost(const LbRRNodeId& node,
@@ -235,6 +316,8 @@ LbRREdgeId LbRRGraph::create_edge(const LbRRNodeId& source,
                                   const LbRRNodeId& sink, t_mode* mode) {
   VTR_ASSERT(true == valid_node_id(source));
   VTR_ASSERT(true == valid_node_id(sink));
+  /* A frozen graph can not be modified */
+  VTR_ASSERT(false == frozen_);
 
   /* Create an new id */
   LbRREdgeId edge = LbRREdgeId(edge_ids_.size());
@@ -258,6 +341,86 @@ void LbRRGraph::set_edge_intrinsic_cost(const LbRREdgeId& edge,
   edge_intrinsic_costs_[edge] = cost;
 }
 
+/******************************************************************************
+ * Pack the edges of all the nodes in a compressed-sparse-row format
+ * - The incoming and outgoing edges are stored in the same sequence as they
+ *   were added to the nodes
+ * - The outgoing edges are also grouped by modes, where the modes follow the
+ *   sequence of their first edges and the edges of each mode keep their
+ *   sequence. So, the edge list of a mode is the same as a filtered one
+ ******************************************************************************/
+void LbRRGraph::freeze() {
+  if (true == frozen_) {
+    return;
+  }
+
+  size_t num_nodes = node_ids_.size();
+  size_t num_edges = edge_ids_.size();
+
+  csr_in_edge_offsets_.clear();
+  csr_in_edge_offsets_.reserve(num_nodes + 1);
+  csr_in_edges_.clear();
+  csr_in_edges_.reserve(num_edges);
+  csr_out_edge_offsets_.clear();
+  csr_out_edge_offsets_.reserve(num_nodes + 1);
+  csr_out_edges_.clear();
+  csr_out_edges_.reserve(num_edges);
+  csr_out_mode_offsets_.clear();
+  csr_out_mode_offsets_.reserve(num_nodes + 1);
+  csr_out_mode_ranges_.clear();
+  csr_out_mode_edges_.clear();
+  csr_out_mode_edges_.reserve(num_edges);
+
+  csr_in_edge_offsets_.push_back(0);
+  csr_out_edge_offsets_.push_back(0);
+  csr_out_mode_offsets_.push_back(0);
+  for (const LbRRNodeId& node : nodes()) {
+    csr_in_edges_.insert(csr_in_edges_.end(), node_in_edges_[node].begin(),
+                         node_in_edges_[node].end());
+    csr_in_edge_offsets_.push_back(csr_in_edges_.size());
+
+    csr_out_edges_.insert(csr_out_edges_.end(), node_out_edges_[node].begin(),
+                          node_out_edges_[node].end());
+    csr_out_edge_offsets_.push_back(csr_out_edges_.size());
+
+    /* Find the modes in the sequence of their first edges */
+    size_t first_range = csr_out_mode_ranges_.size();
+    for (const LbRREdgeId& edge : node_out_edges_[node]) {
+      bool mode_exist = false;
+      for (size_t irange = first_range; irange < csr_out_mode_ranges_.size();
+           ++irange) {
+        if (edge_modes_[edge] == csr_out_mode_ranges_[irange].mode) {
+          mode_exist = true;
+          break;
+        }
+      }
+      if (false == mode_exist) {
+        csr_out_mode_ranges_.push_back({edge_modes_[edge], 0, 0});
+      }
+    }
+    /* Group the edges by modes */
+    for (size_t irange = first_range; irange < csr_out_mode_ranges_.size();
+         ++irange) {
+      t_mode_edge_range& mode_range = csr_out_mode_ranges_[irange];
+      mode_range.begin = csr_out_mode_edges_.size();
+      for (const LbRREdgeId& edge : node_out_edges_[node]) {
+        if (edge_modes_[edge] == mode_range.mode) {
+          csr_out_mode_edges_.push_back(edge);
+        }
+      }
+      mode_range.end = csr_out_mode_edges_.size();
+    }
+    csr_out_mode_offsets_.push_back(csr_out_mode_ranges_.size());
+  }
+  csr_out_mode_ranges_.shrink_to_fit();
+
+  /* Release the edge lists used by the build */
+  node_in_edges_ = vtr::vector<LbRRNodeId, std::vector<LbRREdgeId>>();
+  node_out_edges_ = vtr::vector<LbRRNodeId, std::vector<LbRREdgeId>>();
+
+  frozen_ = true;
+}
+
 /******************************************************************************
  * Public validators/invalidators
  ******************************************************************************/
@@ -315,8 +478,11 @@ bool LbRRGraph::validate_node_sizes() const {
          node_capacities_.size() == num_nodes &&
          node_pb_graph_pins_.size() == num_nodes &&
          node_intrinsic_costs_.size() == num_nodes &&
-         node_in_edges_.size() == num_nodes &&
-         node_out_edges_.size() == num_nodes;
+         (frozen_ ? (csr_in_edge_offsets_.size() == num_nodes + 1 &&
+                     csr_out_edge_offsets_.size() == num_nodes + 1 &&
+                     csr_out_mode_offsets_.size() == num_nodes + 1)
+                  : (node_in_edges_.size() == num_nodes &&
+                     node_out_edges_.size() == num_nodes));
 }
 
 bool LbRRGraph::validate_edge_sizes() const {
@@ -49,6 +49,13 @@
  *     // If you only want to learn the number of fan-out edges
  *     size_t num_out_edges = rr_graph.node_fan_out(node_id);
  *
+ *     // Once the graph is frozen, edges can be accessed without any
+ *     // memory allocation, which is preferred by routers
+ *     for (const LbRREdgeId& out_edge_id :
+ *          lb_rr_graph.node_out_edge_range(node_id, mode)) {
+ *       // Do something with out_edge
+ *     }
+ *
  * Please refer to the detailed comments on each public accessors
  *
  * For those want to build/modify a LbRRGraph
@@ -70,6 +77,13 @@
  *    ... // Building RRGraph
  *    lb_rr_graph.validate();
  *
+ * When the build is finished, please freeze the LbRRGraph, which packs the
+ *edges of all the nodes in a compressed-sparse-row (CSR) format. No more nodes
+ *and edges can be added to a frozen graph.
+ *
+ * Example:
+ *    lb_rr_graph.freeze();
+ *
  * Optionally, we strongly recommend developers to run an advance check in
  *check_rr_graph() This guarantees legal and routable RRGraph for VPR routers.
  *
@@ -177,6 +191,11 @@ class LbRRGraph {
   typedef vtr::Range<node_iterator> node_range;
   typedef vtr::Range<edge_iterator> edge_range;
 
+  /* Ranges of the edges of a node, which are only available in a frozen graph
+   */
+  typedef std::vector<LbRREdgeId>::const_iterator edge_list_iterator;
+  typedef vtr::Range<edge_list_iterator> edge_list_range;
+
  public: /* Constructors */
   LbRRGraph();
 
@@ -216,6 +235,14 @@ class LbRRGraph {
   std::vector<LbRREdgeId> node_out_edges(const LbRRNodeId& node,
                                          t_mode* mode) const;
 
+  /* Get the incoming/outgoing edges of a node without any memory allocation.
+   * The edges are in the same sequence as node_in_edges() and
+   * node_out_edges(). Only available when the graph is frozen */
+  edge_list_range node_in_edge_range(const LbRRNodeId& node) const;
+  edge_list_range node_out_edge_range(const LbRRNodeId& node) const;
+  edge_list_range node_out_edge_range(const LbRRNodeId& node,
+                                      t_mode* mode) const;
+
   /* General method to look up a node with type and only pb_graph_pin
    * information */
   LbRRNodeId find_node(const e_lb_rr_type& type,
@@ -235,6 +262,10 @@ class LbRRGraph {
   float edge_intrinsic_cost(const LbRREdgeId& edge) const;
   t_mode* edge_mode(const LbRREdgeId& edge) const;
 
+  /* Identify if the graph is frozen, i.e., edges are stored in the CSR format
+   */
+  bool frozen() const;
+
  public: /* Mutators */
   /* Reserve the lists of nodes, edges, switches etc. to be memory efficient.
    * This function is mainly used to reserve memory space inside RRGraph,
@@ -281,6 +312,11 @@ class LbRRGraph {
                          t_mode* mode);
   void set_edge_intrinsic_cost(const LbRREdgeId& edge, const float& cost);
 
+  /* Pack the edges of all the nodes in a compressed-sparse-row (CSR) format,
+   * which should be called once the build is finished. The graph can no longer
+   * be modified except the costs */
+  void freeze();
+
  public: /* Public validators */
   /* Validate is the node id does exist in the RRGraph */
   bool valid_node_id(const LbRRNodeId& node) const;
@@ -318,10 +354,34 @@ class LbRRGraph {
 
   vtr::vector<LbRRNodeId, float> node_intrinsic_costs_;
 
-  /* Edges per node is sorted by modes: [<mode_id>][<in_edges...><out_edges>] */
+  /* Edges per node is sorted by modes: [<mode_id>][<in_edges...><out_edges>]
+   * Only used during the build. Released when the graph is frozen */
   vtr::vector<LbRRNodeId, std::vector<LbRREdgeId>> node_in_edges_;
   vtr::vector<LbRRNodeId, std::vector<LbRREdgeId>> node_out_edges_;
 
+  /* Edges of a frozen graph in CSR format:
+   * The incoming edges of node i are the elements of csr_in_edges_ in the
+   * range [csr_in_edge_offsets_[i], csr_in_edge_offsets_[i + 1]), and so are
+   * the outgoing edges.
+   * The outgoing edges are also grouped by modes in csr_out_mode_edges_.
+   * The ranges of each mode of node i are the elements of
+   * csr_out_mode_ranges_ in the range
+   * [csr_out_mode_offsets_[i], csr_out_mode_offsets_[i + 1])
+   */
+  struct t_mode_edge_range {
+    t_mode* mode;
+    size_t begin;
+    size_t end;
+  };
+  bool frozen_;
+  std::vector<size_t> csr_in_edge_offsets_;
+  std::vector<LbRREdgeId> csr_in_edges_;
+  std::vector<size_t> csr_out_edge_offsets_;
+  std::vector<LbRREdgeId> csr_out_edges_;
+  std::vector<size_t> csr_out_mode_offsets_;
+  std::vector<t_mode_edge_range> csr_out_mode_ranges_;
+  std::vector<LbRREdgeId> csr_out_mode_edges_;
+
   /* Edge related data */
   /* Range of edge ids, use the unsigned long as
    * the number of edges could be >10 times larger than the number of nodes!
@@ -332,11 +392,12 @@ class LbRRGraph {
   vtr::vector<LbRREdgeId, float> edge_intrinsic_costs_;
   vtr::vector<LbRREdgeId, t_mode*> edge_modes_;
 
-  /* Fast look-up to search a node by its type, coordinator and ptc_num
-   * Indexing of fast look-up: [0..NUM_TYPES-1][t_pb_graph_pin*]
+  /* Fast look-up to search a node by its type and pb_graph_pin
+   * Indexing of fast look-up: [0..NUM_TYPES-1][pin_count_in_cluster]
+   * The pin_count_in_cluster is unique for each pb_graph_pin in a pb_graph
    */
-  typedef std::vector<std::map<const t_pb_graph_pin*, LbRRNodeId>> NodeLookup;
-  mutable NodeLookup node_lookup_;
+  typedef std::vector<std::vector<LbRRNodeId>> NodeLookup;
+  NodeLookup node_lookup_;
 
   /* Special node look-up */
   LbRRNodeId ext_source_node_;
@@ -0,0 +1,155 @@
+/********************************************************************
+ * This file includes functions that are shared by the reader and writer
+ * of the binary files of physical lb_rr_graphs
+ *******************************************************************/
+#include "lb_rr_graph_bin_utils.h"
+
+#include <string>
+
+#include "pb_type_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Version of the binary format, which is mixed into the fingerprint so that
+ * files written by an incompatible version are rejected */
+constexpr uint64_t LB_RR_GRAPH_BIN_VERSION = 1;
+
+/********************************************************************
+ * A FNV-1a hash, which is stable across platforms and runs, unlike
+ * std::hash, so that it can be stored in files
+ *******************************************************************/
+static void fingerprint_bytes(uint64_t& fingerprint, const void* data,
+                              const size_t& num_bytes) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t ibyte = 0; ibyte < num_bytes; ++ibyte) {
+    fingerprint ^= bytes[ibyte];
+    fingerprint *= 0x100000001b3ULL;
+  }
+}
+
+static void fingerprint_int(uint64_t& fingerprint, const int64_t& value) {
+  fingerprint_bytes(fingerprint, &value, sizeof(value));
+}
+
+static void fingerprint_string(uint64_t& fingerprint, const char* str) {
+  std::string value(nullptr == str ? "" : str);
+  fingerprint_int(fingerprint, value.size());
+  fingerprint_bytes(fingerprint, value.data(), value.size());
+}
+
+/********************************************************************
+ * Collect all the modes in the pb_type hierarchy in a depth-first order.
+ * The index of a mode in the list is used to refer to it in binary files
+ *******************************************************************/
+static void rec_collect_pb_type_modes(t_pb_type* pb_type,
+                                      std::vector<t_mode*>& modes) {
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    t_mode* mode = &(pb_type->modes[imode]);
+    modes.push_back(mode);
+    for (int ichild = 0; ichild < mode->num_pb_type_children; ++ichild) {
+      rec_collect_pb_type_modes(&(mode->pb_type_children[ichild]), modes);
+    }
+  }
+}
+
+std::vector<t_mode*> collect_pb_type_modes(t_pb_type* top_pb_type) {
+  std::vector<t_mode*> modes;
+  rec_collect_pb_type_modes(top_pb_type, modes);
+  return modes;
+}
+
+static void fingerprint_pb_graph_pin(uint64_t& fingerprint,
+                                     t_pb_graph_pin* pb_pin) {
+  fingerprint_string(fingerprint, pb_pin->port->name);
+  fingerprint_int(fingerprint, pb_pin->port->type);
+  fingerprint_int(fingerprint, int64_t(pb_pin->port->equivalent));
+  fingerprint_int(fingerprint, pb_pin->pin_number);
+  fingerprint_int(fingerprint, pb_pin->pin_count_in_cluster);
+  fingerprint_int(fingerprint, pb_pin->num_output_edges);
+  for (int iedge = 0; iedge < pb_pin->num_output_edges; ++iedge) {
+    t_pb_graph_edge* edge = pb_pin->output_edges[iedge];
+    fingerprint_string(fingerprint, edge->interconnect->name);
+    fingerprint_string(fingerprint, edge->interconnect->parent_mode->name);
+    fingerprint_int(fingerprint, edge->num_output_pins);
+    for (int ipin = 0; ipin < edge->num_output_pins; ++ipin) {
+      fingerprint_int(fingerprint,
+                      edge->output_pins[ipin]->pin_count_in_cluster);
+    }
+  }
+}
+
+/********************************************************************
+ * Fingerprint the pins and their fan-out edges of a pb_graph_node and
+ * all its children in the physical modes, which are what a physical
+ * lb_rr_graph is built from
+ *******************************************************************/
+static void rec_fingerprint_physical_pb_graph_node(
+  uint64_t& fingerprint, t_pb_graph_node* pb_graph_node,
+  const VprDeviceAnnotation& device_annotation) {
+  t_pb_type* pb_type = pb_graph_node->pb_type;
+  fingerprint_string(fingerprint, pb_type->name);
+  fingerprint_int(fingerprint, pb_type->num_pb);
+  fingerprint_int(fingerprint, pb_graph_node->placement_index);
+
+  for (int iport = 0; iport < pb_graph_node->num_input_ports; ++iport) {
+    for (int ipin = 0; ipin < pb_graph_node->num_input_pins[iport]; ++ipin) {
+      fingerprint_pb_graph_pin(fingerprint,
+                               &(pb_graph_node->input_pins[iport][ipin]));
+    }
+  }
+  for (int iport = 0; iport < pb_graph_node->num_clock_ports; ++iport) {
+    for (int ipin = 0; ipin < pb_graph_node->num_clock_pins[iport]; ++ipin) {
+      fingerprint_pb_graph_pin(fingerprint,
+                               &(pb_graph_node->clock_pins[iport][ipin]));
+    }
+  }
+  for (int iport = 0; iport < pb_graph_node->num_output_ports; ++iport) {
+    for (int ipin = 0; ipin < pb_graph_node->num_output_pins[iport]; ++ipin) {
+      fingerprint_pb_graph_pin(fingerprint,
+                               &(pb_graph_node->output_pins[iport][ipin]));
+    }
+  }
+
+  if (true == is_primitive_pb_type(pb_type)) {
+    return;
+  }
+
+  t_mode* physical_mode = device_annotation.physical_mode(pb_type);
+  fingerprint_string(fingerprint, physical_mode->name);
+  fingerprint_int(fingerprint, physical_mode->index);
+  for (int ipb_type = 0; ipb_type < physical_mode->num_pb_type_children;
+       ++ipb_type) {
+    for (int ipb = 0; ipb < physical_mode->pb_type_children[ipb_type].num_pb;
+         ++ipb) {
+      rec_fingerprint_physical_pb_graph_node(
+        fingerprint,
+        &(pb_graph_node
+            ->child_pb_graph_nodes[physical_mode->index][ipb_type][ipb]),
+        device_annotation);
+    }
+  }
+}
+
+/********************************************************************
+ * Fingerprint everything that a physical lb_rr_graph depends on, i.e.,
+ * - the pb_graph in the physical modes, including the pins and edges
+ * - the list of modes in the pb_type hierarchy, which are referred to by
+ *   index in binary files
+ *******************************************************************/
+uint64_t physical_lb_rr_graph_fingerprint(
+  t_pb_graph_node* pb_graph_head,
+  const VprDeviceAnnotation& device_annotation) {
+  uint64_t fingerprint = 0xcbf29ce484222325ULL;
+  fingerprint_int(fingerprint, LB_RR_GRAPH_BIN_VERSION);
+  fingerprint_int(fingerprint, pb_graph_head->total_pb_pins);
+  for (t_mode* mode : collect_pb_type_modes(pb_graph_head->pb_type)) {
+    fingerprint_string(fingerprint, mode->parent_pb_type->name);
+    fingerprint_string(fingerprint, mode->name);
+  }
+  rec_fingerprint_physical_pb_graph_node(fingerprint, pb_graph_head,
+                                         device_annotation);
+  return fingerprint;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,27 @@
+#ifndef LB_RR_GRAPH_BIN_UTILS_H
+#define LB_RR_GRAPH_BIN_UTILS_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <cstdint>
+#include <vector>
+
+#include "physical_types.h"
+#include "vpr_device_annotation.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+std::vector<t_mode*> collect_pb_type_modes(t_pb_type* top_pb_type);
+
+uint64_t physical_lb_rr_graph_fingerprint(
+  t_pb_graph_node* pb_graph_head, const VprDeviceAnnotation& device_annotation);
+
+} /* end namespace openfpga */
+
+#endif
@@ -0,0 +1,193 @@
+/********************************************************************
+ * This file includes functions to read the physical lb_rr_graphs of
+ * logical tiles from a binary file, so that they do not have to be built
+ * again by the repacker
+ *******************************************************************/
+#include "read_lb_rr_graph_bin.h"
+
+#include <capnp/message.h>
+#include <capnp/serialize.h>
+
+#include <limits>
+#include <string>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+#include "check_lb_rr_graph.h"
+#include "command_exit_codes.h"
+#include "lb_rr_graph.capnp.h"
+#include "lb_rr_graph_bin_utils.h"
+#include "mmap_file.h"
+#include "vpr_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+static e_lb_rr_type bin_to_lb_rr_type(const lbrrcap::NodeType& type) {
+  if (lbrrcap::NodeType::SOURCE == type) {
+    return LB_SOURCE;
+  }
+  if (lbrrcap::NodeType::SINK == type) {
+    return LB_SINK;
+  }
+  VTR_ASSERT(lbrrcap::NodeType::INTERMEDIATE == type);
+  return LB_INTERMEDIATE;
+}
+
+/********************************************************************
+ * Restore a physical lb_rr_graph from a capnp reader. The indices of
+ * pb_graph_pins and modes are resolved to the pointers of the current run.
+ * Return false if any index is out of range, which means the file is
+ * corrupted
+ *******************************************************************/
+static bool read_bin_lb_rr_graph(LbRRGraph& lb_rr_graph,
+                                 const lbrrcap::LbRRGraph::Reader& bin_graph,
+                                 t_logical_block_type_ptr lb_type) {
+  auto bin_nodes = bin_graph.getNodes();
+  auto bin_edges = bin_graph.getEdges();
+  lb_rr_graph.reserve_nodes(bin_nodes.size());
+  lb_rr_graph.reserve_edges(bin_edges.size());
+
+  int num_pins = lb_type->pb_graph_head->total_pb_pins;
+  t_pb_graph_pin** pb_graph_pin_lookup_from_index =
+    alloc_and_load_pb_graph_pin_lookup_from_index(lb_type);
+
+  bool valid = true;
+  for (size_t inode = 0; inode < bin_nodes.size(); ++inode) {
+    auto bin_node = bin_nodes[inode];
+    e_lb_rr_type type = bin_to_lb_rr_type(bin_node.getType());
+    LbRRNodeId node;
+    if (int(inode) == bin_graph.getExtSourceNode()) {
+      node = lb_rr_graph.create_ext_source_node(type);
+    } else if (int(inode) == bin_graph.getExtSinkNode()) {
+      node = lb_rr_graph.create_ext_sink_node(type);
+    } else {
+      node = lb_rr_graph.create_node(type);
+    }
+    lb_rr_graph.set_node_capacity(node, bin_node.getCapacity());
+    lb_rr_graph.set_node_intrinsic_cost(node, bin_node.getIntrinsicCost());
+    int pin_index = bin_node.getPinCountInCluster();
+    if (-1 == pin_index) {
+      continue;
+    }
+    if (pin_index < 0 || pin_index >= num_pins) {
+      valid = false;
+      break;
+    }
+    lb_rr_graph.set_node_pb_graph_pin(
+      node, pb_graph_pin_lookup_from_index[pin_index]);
+  }
+
+  free_pb_graph_pin_lookup_from_index(pb_graph_pin_lookup_from_index);
+
+  if (false == valid) {
+    return false;
+  }
+
+  std::vector<t_mode*> modes = collect_pb_type_modes(lb_type->pb_type);
+  for (auto bin_edge : bin_edges) {
+    if (bin_edge.getSrcNode() >= bin_nodes.size() ||
+        bin_edge.getSinkNode() >= bin_nodes.size() ||
+        bin_edge.getMode() < -1 || bin_edge.getMode() >= int(modes.size())) {
+      return false;
+    }
+    t_mode* mode = nullptr;
+    if (-1 != bin_edge.getMode()) {
+      mode = modes[bin_edge.getMode()];
+    }
+    LbRREdgeId edge =
+      lb_rr_graph.create_edge(LbRRNodeId(bin_edge.getSrcNode()),
+                              LbRRNodeId(bin_edge.getSinkNode()), mode);
+    lb_rr_graph.set_edge_intrinsic_cost(edge, bin_edge.getIntrinsicCost());
+  }
+
+  lb_rr_graph.freeze();
+
+  return true;
+}
+
+/********************************************************************
+ * Read the physical lb_rr_graphs of logical tiles from a binary file and
+ * add them to the device annotation. A graph is loaded only when its
+ * fingerprint matches the pb_type hierarchy of the current architecture.
+ * Otherwise it is skipped with a warning and will be built by the repacker
+ *******************************************************************/
+int read_bin_lb_rr_graphs(const char* fname, const DeviceContext& device_ctx,
+                          VprDeviceAnnotation& device_annotation,
+                          const bool& verbose) {
+  vtr::ScopedStartFinishTimer timer(
+    "Read routing resource graphs of logical tiles from binary file");
+
+  MmapFile f(fname);
+  /* A graph may have millions of nodes and edges, which exceeds the default
+   * traversal limit of capnp */
+  ::capnp::ReaderOptions opts = ::capnp::ReaderOptions();
+  opts.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
+  ::capnp::FlatArrayMessageReader reader(f.getData(), opts);
+  auto bin_root = reader.getRoot<lbrrcap::LbRRGraphs>();
+
+  size_t num_loaded_graphs = 0;
+  for (auto bin_graph : bin_root.getGraphs()) {
+    std::string pb_type_name = bin_graph.getPbType().cStr();
+    t_logical_block_type_ptr lb_type = nullptr;
+    for (const t_logical_block_type& cand : device_ctx.logical_block_types) {
+      if (nullptr != cand.pb_graph_head &&
+          pb_type_name == std::string(cand.pb_graph_head->pb_type->name)) {
+        lb_type = &cand;
+        break;
+      }
+    }
+    if (nullptr == lb_type) {
+      VTR_LOG_WARN(
+        "Skip routing resource graph for logical tile '%s' which does not "
+        "exist in the architecture!\n",
+        pb_type_name.c_str());
+      continue;
+    }
+
+    if (bin_graph.getFingerprint() !=
+        physical_lb_rr_graph_fingerprint(lb_type->pb_graph_head,
+                                         device_annotation)) {
+      VTR_LOG_WARN(
+        "Skip stale routing resource graph for logical tile '%s' whose "
+        "fingerprint does not match the architecture!\n",
+        pb_type_name.c_str());
+      continue;
+    }
+
+    LbRRGraph lb_rr_graph;
+    if (false == read_bin_lb_rr_graph(lb_rr_graph, bin_graph, lb_type)) {
+      VTR_LOG_ERROR(
+        "Invalid routing resource graph for logical tile '%s' in file '%s'!\n",
+        pb_type_name.c_str(), fname);
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    if (false == lb_rr_graph.validate() ||
+        false == check_lb_rr_graph(lb_rr_graph)) {
+      VTR_LOG_ERROR(
+        "Invalid routing resource graph for logical tile '%s' in file '%s'!\n",
+        pb_type_name.c_str(), fname);
+      return CMD_EXEC_FATAL_ERROR;
+    }
+
+    device_annotation.add_physical_lb_rr_graph(lb_type->pb_graph_head,
+                                               lb_rr_graph);
+    num_loaded_graphs++;
+
+    VTR_LOGV(verbose,
+             "Read routing resource graph for logical tile '%s' (%lu nodes, "
+             "%lu edges)\n",
+             pb_type_name.c_str(), lb_rr_graph.nodes().size(),
+             lb_rr_graph.edges().size());
+  }
+
+  VTR_LOG("Read %lu routing resource graphs of logical tiles from '%s'\n",
+          num_loaded_graphs, fname);
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
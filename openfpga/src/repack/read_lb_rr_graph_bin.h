@@ -0,0 +1,23 @@
+#ifndef READ_LB_RR_GRAPH_BIN_H
+#define READ_LB_RR_GRAPH_BIN_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "vpr_context.h"
+#include "vpr_device_annotation.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+int read_bin_lb_rr_graphs(const char* fname, const DeviceContext& device_ctx,
+                          VprDeviceAnnotation& device_annotation,
+                          const bool& verbose);
+
+} /* end namespace openfpga */
+
+#endif
@@ -2,6 +2,8 @@
  * This file includes functions that are used to redo packing for physical pbs
  ***************************************************************************************/
 
+#include <map>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -942,19 +944,22 @@ static void add_lb_router_nets(
  * This function will do
  * - Find the lb_rr_graph that is affiliated to the clustered block
  *   and initilize the logcial tile router
+ *   The router is shared by all the clustered blocks of the same type,
+ *   so that its internal memory is allocated only once
  * - Create nets to be routed, including the source nodes and terminals
  *   This should consider the net remapping in the clustering_annotation
  * - Run the router to finish the repacking
  * - Output routing results to data structure PhysicalPb and store it in
  *clustering annotation
  ***************************************************************************************/
-static void repack_cluster(const AtomContext& atom_ctx,
-                           const ClusteringContext& clustering_ctx,
-                           const VprDeviceAnnotation& device_annotation,
-                           VprClusteringAnnotation& clustering_annotation,
-                           const VprBitstreamAnnotation& bitstream_annotation,
-                           const ClusterBlockId& block_id,
-                           const RepackOption& options) {
+static void repack_cluster(
+  std::map<t_logical_block_type_ptr, LbRouter>& lb_routers,
+  std::vector<size_t>& iteration_num_reroutes, size_t& num_explored_nodes,
+  const AtomContext& atom_ctx, const ClusteringContext& clustering_ctx,
+  const VprDeviceAnnotation& device_annotation,
+  VprClusteringAnnotation& clustering_annotation,
+  const VprBitstreamAnnotation& bitstream_annotation,
+  const ClusterBlockId& block_id, const RepackOption& options) {
   /* Get the pb graph that current clustered block is mapped to */
   t_logical_block_type_ptr lb_type =
     clustering_ctx.clb_nlist.block_type(block_id);
@@ -971,8 +976,15 @@ static void repack_cluster(const AtomContext& atom_ctx,
           clustering_ctx.clb_nlist.block_name(block_id).c_str());
   VTR_LOGV(verbose, "\n");
 
-  /* Initialize the router */
-  LbRouter lb_router(lb_rr_graph, lb_type);
+  /* Initialize the router, or reuse the one of the same type */
+  auto router_it = lb_routers.find(lb_type);
+  if (router_it == lb_routers.end()) {
+    router_it =
+      lb_routers.emplace(lb_type, LbRouter(lb_rr_graph, lb_type)).first;
+  }
+  LbRouter& lb_router = router_it->second;
+  lb_router.clear_nets();
+  lb_router.set_astar(options.astar());
 
   /* Add nets to be routed with source and terminals */
   add_lb_router_nets(
@@ -998,6 +1010,16 @@ static void repack_cluster(const AtomContext& atom_ctx,
   VTR_ASSERT(true == route_success);
   VTR_LOGV(verbose, "Reroute succeed\n");
 
+  /* Accumulate the number of rerouted nets in each iteration */
+  std::vector<size_t> cluster_num_reroutes = lb_router.iteration_num_reroutes();
+  if (iteration_num_reroutes.size() < cluster_num_reroutes.size()) {
+    iteration_num_reroutes.resize(cluster_num_reroutes.size(), 0);
+  }
+  for (size_t iter = 0; iter < cluster_num_reroutes.size(); ++iter) {
+    iteration_num_reroutes[iter] += cluster_num_reroutes[iter];
+  }
+  num_explored_nodes += lb_router.num_explored_nodes();
+
   /* Annotate routing results to physical pb */
   PhysicalPb phy_pb;
   alloc_physical_pb_from_pb_graph(phy_pb, pb_graph_head, device_annotation);
@@ -1028,11 +1050,28 @@ static void repack_clusters(const AtomContext& atom_ctx,
   vtr::ScopedStartFinishTimer timer(
     "Repack clustered blocks to physical implementation of logical tile");
 
+  std::map<t_logical_block_type_ptr, LbRouter> lb_routers;
+  std::vector<size_t> iteration_num_reroutes;
+  size_t num_explored_nodes = 0;
   for (auto blk_id : clustering_ctx.clb_nlist.blocks()) {
-    repack_cluster(atom_ctx, clustering_ctx, device_annotation,
+    repack_cluster(lb_routers, iteration_num_reroutes, num_explored_nodes,
+                   atom_ctx, clustering_ctx, device_annotation,
                    clustering_annotation, bitstream_annotation, blk_id,
                    options);
   }
+
+  /* Report the number of rerouted nets in each iteration over all the
+   * clustered blocks */
+  size_t total_num_reroutes = 0;
+  for (size_t iter = 0; iter < iteration_num_reroutes.size(); ++iter) {
+    VTR_LOGV(options.verbose_output(),
+             "Routing iteration %lu: rerouted %lu nets\n", iter,
+             iteration_num_reroutes[iter]);
+    total_num_reroutes += iteration_num_reroutes[iter];
+  }
+  VTR_LOG("Rerouted %lu nets in total\n", total_num_reroutes);
+  VTR_LOG("Explored %lu routing resource nodes in total (A*: %s)\n",
+          num_explored_nodes, options.astar() ? "on" : "off");
 }
 
 /***************************************************************************************
@@ -18,6 +18,7 @@ namespace openfpga {
  * Public Constructors
  *************************************************/
 RepackOption::RepackOption() {
+  astar_ = false;
   verbose_output_ = false;
   num_parse_errors_ = 0;
 }
@@ -64,6 +65,8 @@ bool RepackOption::net_is_specified_to_be_ignored(std::string cluster_net_name,
   return false;
 }
 
+bool RepackOption::astar() const { return astar_; }
+
 bool RepackOption::verbose_output() const { return verbose_output_; }
 
 /******************************************************************************
@@ -138,6 +141,8 @@ void RepackOption::set_ignore_global_nets_on_pins(const std::string& content) {
   }
 }
 
+void RepackOption::set_astar(const bool& enabled) { astar_ = enabled; }
+
 void RepackOption::set_verbose_output(const bool& enabled) {
   verbose_output_ = enabled;
 }
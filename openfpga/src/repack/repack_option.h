@@ -28,12 +28,14 @@ class RepackOption {
   bool net_is_specified_to_be_ignored(std::string cluster_net_name,
                                       std::string pb_type_name,
                                       const BasicPort& pin) const;
+  bool astar() const;
   bool verbose_output() const;
 
  public: /* Public mutators */
   void set_design_constraints(
     const RepackDesignConstraints& design_constraints);
   void set_ignore_global_nets_on_pins(const std::string& content);
+  void set_astar(const bool& enabled);
   void set_verbose_output(const bool& enabled);
 
  public: /* Public validators */
@@ -51,6 +53,7 @@ class RepackOption {
    */
   std::map<std::string, std::vector<BasicPort>> ignore_global_nets_on_pins_;
 
+  bool astar_;
   bool verbose_output_;
 
   /* A flag to indicate if the data parse is invalid or not */
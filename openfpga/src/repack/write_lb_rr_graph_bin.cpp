@@ -0,0 +1,144 @@
+/********************************************************************
+ * This file includes functions to write the physical lb_rr_graphs of
+ * logical tiles to a binary file, which can be loaded by later runs
+ * instead of building the graphs again
+ *******************************************************************/
+#include "write_lb_rr_graph_bin.h"
+
+#include <capnp/message.h>
+
+#include <unordered_map>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_digest.h"
+
+#include "command_exit_codes.h"
+#include "lb_rr_graph.capnp.h"
+#include "lb_rr_graph_bin_utils.h"
+#include "serdes_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+static lbrrcap::NodeType lb_rr_type_to_bin(const e_lb_rr_type& type) {
+  if (LB_SOURCE == type) {
+    return lbrrcap::NodeType::SOURCE;
+  }
+  if (LB_SINK == type) {
+    return lbrrcap::NodeType::SINK;
+  }
+  VTR_ASSERT(LB_INTERMEDIATE == type);
+  return lbrrcap::NodeType::INTERMEDIATE;
+}
+
+/********************************************************************
+ * Write a physical lb_rr_graph to a capnp builder. Pointers to the
+ * pb_graph_pins and modes are replaced by their indices, i.e., the
+ * pin_count_in_cluster of a pin and the index of a mode in the pb_type
+ * hierarchy, so that they can be restored in another run
+ *******************************************************************/
+static void write_bin_lb_rr_graph(
+  lbrrcap::LbRRGraph::Builder& bin_graph, const LbRRGraph& lb_rr_graph,
+  t_pb_graph_node* pb_graph_head,
+  const VprDeviceAnnotation& device_annotation) {
+  bin_graph.setPbType(pb_graph_head->pb_type->name);
+  bin_graph.setFingerprint(
+    physical_lb_rr_graph_fingerprint(pb_graph_head, device_annotation));
+  if (lb_rr_graph.valid_node_id(lb_rr_graph.ext_source_node())) {
+    bin_graph.setExtSourceNode(size_t(lb_rr_graph.ext_source_node()));
+  }
+  if (lb_rr_graph.valid_node_id(lb_rr_graph.ext_sink_node())) {
+    bin_graph.setExtSinkNode(size_t(lb_rr_graph.ext_sink_node()));
+  }
+
+  auto bin_nodes = bin_graph.initNodes(lb_rr_graph.nodes().size());
+  for (const LbRRNodeId& node : lb_rr_graph.nodes()) {
+    auto bin_node = bin_nodes[size_t(node)];
+    bin_node.setType(lb_rr_type_to_bin(lb_rr_graph.node_type(node)));
+    bin_node.setCapacity(lb_rr_graph.node_capacity(node));
+    bin_node.setIntrinsicCost(lb_rr_graph.node_intrinsic_cost(node));
+    t_pb_graph_pin* pb_pin = lb_rr_graph.node_pb_graph_pin(node);
+    if (nullptr != pb_pin) {
+      bin_node.setPinCountInCluster(pb_pin->pin_count_in_cluster);
+    }
+  }
+
+  std::unordered_map<t_mode*, int> mode_indices;
+  std::vector<t_mode*> modes = collect_pb_type_modes(pb_graph_head->pb_type);
+  for (size_t imode = 0; imode < modes.size(); ++imode) {
+    mode_indices[modes[imode]] = imode;
+  }
+
+  auto bin_edges = bin_graph.initEdges(lb_rr_graph.edges().size());
+  for (const LbRREdgeId& edge : lb_rr_graph.edges()) {
+    auto bin_edge = bin_edges[size_t(edge)];
+    bin_edge.setSrcNode(size_t(lb_rr_graph.edge_src_node(edge)));
+    bin_edge.setSinkNode(size_t(lb_rr_graph.edge_sink_node(edge)));
+    bin_edge.setIntrinsicCost(lb_rr_graph.edge_intrinsic_cost(edge));
+    t_mode* mode = lb_rr_graph.edge_mode(edge);
+    if (nullptr != mode) {
+      VTR_ASSERT(0 < mode_indices.count(mode));
+      bin_edge.setMode(mode_indices.at(mode));
+    }
+  }
+}
+
+/********************************************************************
+ * Write the physical lb_rr_graphs of all the logical tiles to a binary
+ * file. Each graph is tagged with a fingerprint of the pb_type hierarchy
+ * it is built from, so that the reader can reject stale graphs
+ *******************************************************************/
+int write_bin_lb_rr_graphs(const char* fname, const DeviceContext& device_ctx,
+                           const VprDeviceAnnotation& device_annotation,
+                           const bool& verbose) {
+  vtr::ScopedStartFinishTimer timer(
+    "Write routing resource graphs of logical tiles to binary file");
+
+  /* Create directories */
+  create_directory(find_path_dir_name(std::string(fname)));
+
+  std::vector<t_pb_graph_node*> pb_graph_heads;
+  for (const t_logical_block_type& lb_type : device_ctx.logical_block_types) {
+    if (nullptr == lb_type.pb_graph_head) {
+      continue;
+    }
+    if (device_annotation.physical_lb_rr_graph(lb_type.pb_graph_head)
+          .empty()) {
+      VTR_LOG_WARN(
+        "No routing resource graph has been built for logical tile '%s'!\n",
+        lb_type.pb_graph_head->pb_type->name);
+      continue;
+    }
+    pb_graph_heads.push_back(lb_type.pb_graph_head);
+  }
+
+  ::capnp::MallocMessageBuilder builder;
+  auto bin_root = builder.initRoot<lbrrcap::LbRRGraphs>();
+  auto bin_graphs = bin_root.initGraphs(pb_graph_heads.size());
+  for (size_t igraph = 0; igraph < pb_graph_heads.size(); ++igraph) {
+    const LbRRGraph& lb_rr_graph =
+      device_annotation.physical_lb_rr_graph(pb_graph_heads[igraph]);
+    auto bin_graph = bin_graphs[igraph];
+    write_bin_lb_rr_graph(bin_graph, lb_rr_graph, pb_graph_heads[igraph],
+                          device_annotation);
+    VTR_LOGV(verbose,
+             "Wrote routing resource graph for logical tile '%s' (%lu nodes, "
+             "%lu edges)\n",
+             pb_graph_heads[igraph]->pb_type->name, lb_rr_graph.nodes().size(),
+             lb_rr_graph.edges().size());
+  }
+
+  writeMessageToFile(fname, &builder);
+
+  VTR_LOG("Wrote %lu routing resource graphs of logical tiles to '%s'\n",
+          pb_graph_heads.size(), fname);
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
@@ -3,6 +3,11 @@
  * between tiles (programmable blocks)
  ***************************************************************************************/
 
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -153,29 +158,104 @@ static bool is_grid_coordinate_exist_in_device(
 }
 
 /********************************************************************
- * Find the coordinate of a grid in a specific column
- * with a given type
- * This function will return the coordinate of the grid that satifies
- * the type requirement
+ * An index of the core grids, i.e., excluding the grids on the border of
+ * the fabric, by their physical tile types. For each type, it records
+ * - the sorted list of columns (rows) which contain any grid of the type
+ * - in each column (row), the sorted list of y (x) coordinates of the grids
+ *   of the type
+ * The index is built once for all the direct connections, so that the
+ * first grid of a type in a given search direction is found by a binary
+ * search rather than by comparing the type names of each grid
  *******************************************************************/
-static vtr::Point<size_t> find_grid_coordinate_given_type(
-  const DeviceGrid& grids,
-  const std::vector<vtr::Point<size_t>>& candidate_coords,
-  const std::string& wanted_grid_type_name) {
-  for (vtr::Point<size_t> coord : candidate_coords) {
-    /* If the next column is not longer in device range, we can return */
-    if (false == is_grid_coordinate_exist_in_device(grids, coord)) {
-      continue;
+class GridTypeIndex {
+ public: /* Constructors */
+  GridTypeIndex(const DeviceGrid& grids) {
+    for (size_t ix = 1; ix + 1 < grids.width(); ++ix) {
+      for (size_t iy = 1; iy + 1 < grids.height(); ++iy) {
+        std::string type_name(
+          grids.get_physical_type(t_physical_tile_loc(ix, iy, 0))->name);
+        auto result = type_ids_.emplace(type_name, type_ids_.size());
+        size_t type = result.first->second;
+        if (true == result.second) {
+          columns_.emplace_back();
+          rows_.emplace_back();
+          column_coords_.emplace_back(grids.width());
+          row_coords_.emplace_back(grids.height());
+        }
+        /* Grids are visited in ascending order of x and then of y, so that
+         * all the lists are naturally sorted */
+        if (true == column_coords_[type][ix].empty()) {
+          columns_[type].push_back(ix);
+        }
+        column_coords_[type][ix].push_back(iy);
+        row_coords_[type][iy].push_back(ix);
+      }
+    }
+    for (size_t type = 0; type < rows_.size(); ++type) {
+      for (size_t iy = 0; iy < grids.height(); ++iy) {
+        if (false == row_coords_[type][iy].empty()) {
+          rows_[type].push_back(iy);
+        }
+      }
+    }
+  }
+
+ public: /* Public accessors */
+  /* Return an invalid id if no core grid has the type */
+  size_t type_id(const std::string& type_name) const {
+    auto result = type_ids_.find(type_name);
+    if (result == type_ids_.end()) {
+      return size_t(-1);
     }
-    if (wanted_grid_type_name ==
-        std::string(
-          grids.get_physical_type(t_physical_tile_loc(coord.x(), coord.y(), 0))
-            ->name)) {
-      return coord;
+    return result->second;
+  }
+  bool valid_type_id(const size_t& type) const {
+    return type < columns_.size();
+  }
+  const std::vector<size_t>& columns(const size_t& type) const {
+    return columns_[type];
+  }
+  const std::vector<size_t>& rows(const size_t& type) const {
+    return rows_[type];
+  }
+  const std::vector<size_t>& column_coords(const size_t& type,
+                                           const size_t& x) const {
+    return column_coords_[type][x];
+  }
+  const std::vector<size_t>& row_coords(const size_t& type,
+                                        const size_t& y) const {
+    return row_coords_[type][y];
+  }
+
+ private: /* Internal data */
+  std::map<std::string, size_t> type_ids_;
+  std::vector<std::vector<size_t>> columns_;
+  std::vector<std::vector<size_t>> rows_;
+  std::vector<std::vector<std::vector<size_t>>> column_coords_;
+  std::vector<std::vector<std::vector<size_t>>> row_coords_;
+};
+
+/********************************************************************
+ * Find the closest value after (positive direction) or before (negative
+ * direction) a given value in a sorted list.
+ * Return an invalid value if there is none
+ *******************************************************************/
+static size_t find_closest_sorted_value(const std::vector<size_t>& values,
+                                        const size_t& value,
+                                        const e_direct_direction& dir) {
+  if (POSITIVE_DIR == dir) {
+    auto result = std::upper_bound(values.begin(), values.end(), value);
+    if (result == values.end()) {
+      return size_t(-1);
     }
+    return *result;
   }
-  /* Return an valid coordinate */
-  return vtr::Point<size_t>(grids.width(), grids.height());
+  VTR_ASSERT(NEGATIVE_DIR == dir);
+  auto result = std::lower_bound(values.begin(), values.end(), value);
+  if (result == values.begin()) {
+    return size_t(-1);
+  }
+  return *(result - 1);
 }
 
 /********************************************************************
@@ -183,165 +263,63 @@ static vtr::Point<size_t> find_grid_coordinate_given_type(
  * considering intra column/row direct connections in core grids
  *******************************************************************/
 static vtr::Point<size_t> find_inter_direct_destination_coordinate(
-  const DeviceGrid& grids, const vtr::Point<size_t>& src_coord,
-  const std::string des_tile_type_name, const ArchDirect& arch_direct,
-  const ArchDirectId& arch_direct_id) {
+  const DeviceGrid& grids, const GridTypeIndex& grid_type_index,
+  const vtr::Point<size_t>& src_coord, const size_t& des_tile_type,
+  const ArchDirect& arch_direct, const ArchDirectId& arch_direct_id) {
   vtr::Point<size_t> des_coord(grids.width(), grids.height());
 
-  std::vector<size_t> first_search_space;
-  std::vector<size_t> second_search_space;
-
   /* Cross column connection from Bottom to Top on Right
    * The next column may NOT have the grid type we want!
    * Think about heterogeneous architecture!
-   * Our search space will start from the next column
-   * and ends at the RIGHT side of fabric
+   * Our search space starts from the next column which contains the grid
+   * type we want, in the x-direction of the connection:
+   *
+   *      x      ...      nx
+   *   +-----+
+   *   |Grid |  ----->
+   *   +-----+
+   *
+   * In the column, our search space is in y-direction. For positive
+   * direction, the search starts from the top, otherwise from the bottom
    */
   if (e_direct_type::INTER_COLUMN == arch_direct.type(arch_direct_id)) {
-    if (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id)) {
-      /* Our first search space will be in x-direction:
-       *
-       *      x      ...      nx
-       *   +-----+
-       *   |Grid |  ----->
-       *   +-----+
-       */
-      for (size_t ix = src_coord.x() + 1; ix < grids.width() - 1; ++ix) {
-        first_search_space.push_back(ix);
-      }
-    } else {
-      VTR_ASSERT(NEGATIVE_DIR == arch_direct.x_dir(arch_direct_id));
-      /* Our first search space will be in x-direction:
-       *
-       *    1   ...      x
-       *              +-----+
-       *     < -------|Grid |
-       *              +-----+
-       */
-      for (size_t ix = src_coord.x() - 1; ix >= 1; --ix) {
-        first_search_space.push_back(ix);
-      }
-    }
-
-    /* Our second search space will be in y-direction:
-     *
-     *  +------+
-     *  | Grid | ny
-     *  +------+
-     *     ^     .
-     *     |     .
-     *     |     .
-     *  +------+
-     *  | Grid | 1
-     *  +------+
-     */
-    for (size_t iy = 1; iy < grids.height() - 1; ++iy) {
-      second_search_space.push_back(iy);
+    size_t des_x = find_closest_sorted_value(
+      grid_type_index.columns(des_tile_type), src_coord.x(),
+      arch_direct.x_dir(arch_direct_id));
+    if (size_t(-1) == des_x) {
+      return des_coord;
     }
-
-    /* For negative direction, our second search space will be in y-direction:
-     *
-     *  +------+
-     *  | Grid | ny
-     *  +------+
-     *     |     .
-     *     |     .
-     *     v     .
-     *  +------+
-     *  | Grid | 1
-     *  +------+
-     */
+    const std::vector<size_t>& des_ys =
+      grid_type_index.column_coords(des_tile_type, des_x);
     if (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-      std::reverse(second_search_space.begin(), second_search_space.end());
+      return vtr::Point<size_t>(des_x, des_ys.back());
     }
+    return vtr::Point<size_t>(des_x, des_ys.front());
   }
 
   /* Cross row connection from Bottom to Top on Right
-   * The next column may NOT have the grid type we want!
-   * Think about heterogeneous architecture!
-   * Our search space will start from the next column
-   * and ends at the RIGHT side of fabric
+   * The next row may NOT have the grid type we want!
+   * Our search space starts from the next row which contains the grid
+   * type we want, in the y-direction of the connection.
+   *
+   * In the row, our search space is in x-direction. For positive
+   * direction, the search starts from the right, otherwise from the left
    */
   if (e_direct_type::INTER_ROW == arch_direct.type(arch_direct_id)) {
-    if (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-      /* Our first search space will be in y-direction:
-       *
-       *  +------+
-       *  | Grid | ny
-       *  +------+
-       *     ^     .
-       *     |     .
-       *     |     .
-       *  +------+
-       *  | Grid | y
-       *  +------+
-       */
-      for (size_t iy = src_coord.y() + 1; iy < grids.height() - 1; ++iy) {
-        first_search_space.push_back(iy);
-      }
-    } else {
-      VTR_ASSERT(NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id));
-      /* For negative y-direction,
-       * Our first search space will be in y-direction:
-       *
-       *  +------+
-       *  | Grid | ny
-       *  +------+
-       *     |     .
-       *     |     .
-       *     v     .
-       *  +------+
-       *  | Grid | y
-       *  +------+
-       */
-      for (size_t iy = src_coord.y() - 1; iy >= 1; --iy) {
-        first_search_space.push_back(iy);
-      }
-    }
-
-    /* Our second search space will be in x-direction:
-     *
-     *     1      ...     nx
-     *  +------+       +------+
-     *  | Grid |<------| Grid |
-     *  +------+       +------+
-     */
-    for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
-      second_search_space.push_back(ix);
+    size_t des_y = find_closest_sorted_value(
+      grid_type_index.rows(des_tile_type), src_coord.y(),
+      arch_direct.y_dir(arch_direct_id));
+    if (size_t(-1) == des_y) {
+      return des_coord;
     }
-
-    /* For negative direction,
-     * our second search space will be in x-direction:
-     *
-     *     1      ...     nx
-     *  +------+       +------+
-     *  | Grid |------>| Grid |
-     *  +------+       +------+
-     */
+    const std::vector<size_t>& des_xs =
+      grid_type_index.row_coords(des_tile_type, des_y);
     if (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id)) {
-      std::reverse(second_search_space.begin(), second_search_space.end());
+      return vtr::Point<size_t>(des_xs.back(), des_y);
     }
+    return vtr::Point<size_t>(des_xs.front(), des_y);
   }
 
-  for (size_t ix : first_search_space) {
-    std::vector<vtr::Point<size_t>> next_col_row_coords;
-    for (size_t iy : second_search_space) {
-      if (e_direct_type::INTER_COLUMN == arch_direct.type(arch_direct_id)) {
-        next_col_row_coords.push_back(vtr::Point<size_t>(ix, iy));
-      } else {
-        VTR_ASSERT(e_direct_type::INTER_ROW ==
-                   arch_direct.type(arch_direct_id));
-        /* For cross-row connection, our search space is flipped */
-        next_col_row_coords.push_back(vtr::Point<size_t>(iy, ix));
-      }
-    }
-    vtr::Point<size_t> des_coord_cand = find_grid_coordinate_given_type(
-      grids, next_col_row_coords, des_tile_type_name);
-    /* For a valid coordinate, we can return */
-    if (true == is_grid_coordinate_exist_in_device(grids, des_coord_cand)) {
-      return des_coord_cand;
-    }
-  }
   return des_coord;
 }
 
@@ -532,8 +510,9 @@ static void build_inner_column_row_tile_direct(
  *******************************************************************/
 static void build_inter_column_row_tile_direct(
   TileDirect& tile_direct, const t_direct_inf& vpr_direct,
-  const DeviceContext& device_ctx, const ArchDirect& arch_direct,
-  const ArchDirectId& arch_direct_id, const bool& verbose) {
+  const DeviceContext& device_ctx, const GridTypeIndex& grid_type_index,
+  const ArchDirect& arch_direct, const ArchDirectId& arch_direct_id,
+  const bool& verbose) {
   /* Get the source tile and pin information */
   std::string from_tile_name =
     parse_direct_tile_name(std::string(vpr_direct.from_pin));
@@ -554,6 +533,13 @@ static void build_inter_column_row_tile_direct(
       (e_direct_type::INTER_ROW != arch_direct.type(arch_direct_id))) {
     return;
   }
+  /* Nothing to build if any of the tiles is not in the core grids */
+  size_t from_tile_type = grid_type_index.type_id(from_tile_name);
+  size_t to_tile_type = grid_type_index.type_id(to_tile_name);
+  if ((false == grid_type_index.valid_type_id(from_tile_type)) ||
+      (false == grid_type_index.valid_type_id(to_tile_type))) {
+    return;
+  }
   /* For cross-column connection, we will search the first valid grid in each
    * column from y = 1 to y = ny
    *
@@ -570,26 +556,15 @@ static void build_inter_column_row_tile_direct(
    *
    */
   if (e_direct_type::INTER_COLUMN == arch_direct.type(arch_direct_id)) {
-    for (size_t ix = 1; ix < device_ctx.grid.width() - 1; ++ix) {
-      std::vector<vtr::Point<size_t>> next_col_src_grid_coords;
-      /* For negative y- direction, we should start from y = ny */
-      for (size_t iy = 1; iy < device_ctx.grid.height() - 1; ++iy) {
-        next_col_src_grid_coords.push_back(vtr::Point<size_t>(ix, iy));
-      }
-      /* For positive y- direction, we should start from y = 1 */
+    /* Bypass the columns that do not contain any grid of the from_tile */
+    for (size_t ix : grid_type_index.columns(from_tile_type)) {
+      const std::vector<size_t>& from_ys =
+        grid_type_index.column_coords(from_tile_type, ix);
+      /* For negative y- direction, we should start from y = ny
+       * For positive y- direction, we should start from y = 1 */
+      vtr::Point<size_t> from_grid_coord(ix, from_ys.front());
       if (NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-        std::reverse(next_col_src_grid_coords.begin(),
-                     next_col_src_grid_coords.end());
-      }
-
-      /* Bypass the grid that does not fit the from_tile name */
-      vtr::Point<size_t> from_grid_coord = find_grid_coordinate_given_type(
-        device_ctx.grid, next_col_src_grid_coords, from_tile_name);
-      /* Skip if we do not have a valid coordinate for source CLB/heterogeneous
-       * block */
-      if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
-                                                      from_grid_coord)) {
-        continue;
+        from_grid_coord.set_y(from_ys.back());
       }
 
       /* Search all the sides, the from pin may locate any side!
@@ -614,8 +589,8 @@ static void build_inter_column_row_tile_direct(
          * clb */
         vtr::Point<size_t> to_grid_coord =
           find_inter_direct_destination_coordinate(
-            device_ctx.grid, from_grid_coord, to_tile_name, arch_direct,
-            arch_direct_id);
+            device_ctx.grid, grid_type_index, from_grid_coord, to_tile_type,
+            arch_direct, arch_direct_id);
         /* If destination clb is valid, we should add something */
         if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
                                                         to_grid_coord)) {
@@ -682,25 +657,15 @@ static void build_inter_column_row_tile_direct(
    *   +------+               +------+
    *
    */
-  for (size_t iy = 1; iy < device_ctx.grid.height() - 1; ++iy) {
-    std::vector<vtr::Point<size_t>> next_col_src_grid_coords;
-    /* For negative x- direction, we should start from x = nx */
-    for (size_t ix = 1; ix < device_ctx.grid.width() - 1; ++ix) {
-      next_col_src_grid_coords.push_back(vtr::Point<size_t>(ix, iy));
-    }
-    /* For positive x- direction, we should start from x = 1 */
+  /* Bypass the rows that do not contain any grid of the from_tile */
+  for (size_t iy : grid_type_index.rows(from_tile_type)) {
+    const std::vector<size_t>& from_xs =
+      grid_type_index.row_coords(from_tile_type, iy);
+    /* For negative x- direction, we should start from x = nx
+     * For positive x- direction, we should start from x = 1 */
+    vtr::Point<size_t> from_grid_coord(from_xs.front(), iy);
     if (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id)) {
-      std::reverse(next_col_src_grid_coords.begin(),
-                   next_col_src_grid_coords.end());
-    }
-
-    vtr::Point<size_t> from_grid_coord = find_grid_coordinate_given_type(
-      device_ctx.grid, next_col_src_grid_coords, from_tile_name);
-    /* Skip if we do not have a valid coordinate for source CLB/heterogeneous
-     * block */
-    if (false ==
-        is_grid_coordinate_exist_in_device(device_ctx.grid, from_grid_coord)) {
-      continue;
+      from_grid_coord.set_x(from_xs.back());
     }
 
     /* Search all the sides, the from pin may locate any side!
@@ -724,9 +689,9 @@ static void build_inter_column_row_tile_direct(
       /* For a valid coordinate, we can find the coordinate of the destination
        * clb */
       vtr::Point<size_t> to_grid_coord =
-        find_inter_direct_destination_coordinate(device_ctx.grid,
-                                                 from_grid_coord, to_tile_name,
-                                                 arch_direct, arch_direct_id);
+        find_inter_direct_destination_coordinate(
+          device_ctx.grid, grid_type_index, from_grid_coord, to_tile_type,
+          arch_direct, arch_direct_id);
       /* If destination clb is valid, we should add something */
       if (false ==
           is_grid_coordinate_exist_in_device(device_ctx.grid, to_grid_coord)) {
@@ -793,6 +758,10 @@ TileDirect build_device_tile_direct(const DeviceContext& device_ctx,
 
   TileDirect tile_direct;
 
+  /* Index the core grids by types once for all the inter-column/row direct
+   * connections */
+  GridTypeIndex grid_type_index(device_ctx.grid);
+
   /* Walk through each direct definition in the VPR arch */
   for (int idirect = 0; idirect < device_ctx.arch->num_directs; ++idirect) {
     ArchDirectId arch_direct_id =
@@ -815,8 +784,8 @@ TileDirect build_device_tile_direct(const DeviceContext& device_ctx,
     }
     /* Build from OpenFPGA arch definition */
     build_inter_column_row_tile_direct(
-      tile_direct, device_ctx.arch->Directs[idirect], device_ctx, arch_direct,
-      arch_direct_id, verbose);
+      tile_direct, device_ctx.arch->Directs[idirect], device_ctx,
+      grid_type_index, arch_direct, arch_direct_id, verbose);
   }
 
   VTR_LOG(
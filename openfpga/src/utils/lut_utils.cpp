@@ -2,7 +2,8 @@
  * This file includes most utilized functions to manipulate LUTs,
  * especially their truth tables, in the OpenFPGA context
  *******************************************************************/
-#include <cmath>
+#include <algorithm>
+#include <cstdint>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -10,7 +11,6 @@
 
 /* Headers from openfpgautil library */
 #include "lut_utils.h"
-#include "openfpga_decode.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -53,11 +53,13 @@ AtomNetlist::TruthTable lut_truth_table_adaption(
   const AtomNetlist::TruthTable& orig_tt,
   const std::vector<int>& rotated_pin_map) {
   AtomNetlist::TruthTable tt;
+  tt.reserve(orig_tt.size());
 
-  for (auto row : orig_tt) {
+  for (const std::vector<vtr::LogicValue>& row : orig_tt) {
     VTR_ASSERT(row.size() - 1 <= rotated_pin_map.size());
 
     std::vector<vtr::LogicValue> tt_line;
+    tt_line.reserve(rotated_pin_map.size() + 1);
     /* We do not care about the last digit, which is the output value */
     for (size_t i = 0; i < rotated_pin_map.size(); ++i) {
       if (-1 == rotated_pin_map[i]) {
@@ -71,7 +73,7 @@ AtomNetlist::TruthTable lut_truth_table_adaption(
 
     /* Do not miss the last digit in the final result */
     tt_line.push_back(row.back());
-    tt.push_back(tt_line);
+    tt.push_back(std::move(tt_line));
   }
 
   return tt;
@@ -189,6 +191,7 @@ AtomNetlist::TruthTable adapt_truth_table_for_frac_lut(
   }
 
   AtomNetlist::TruthTable adapt_truth_table;
+  adapt_truth_table.reserve(truth_table.size());
 
   /* Apply modification to the truth table */
   for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
@@ -204,25 +207,22 @@ AtomNetlist::TruthTable adapt_truth_table_for_frac_lut(
       continue;
     }
     /* Modify bits starting from lut_frac_level */
-    /* Decode the lut_output_mask to LUT input codes */
-    int temp = pow(2., num_mask_bits) - 1 - lut_output_mask;
-    VTR_ASSERT(0 <= temp);
-    std::vector<size_t> mask_bits_vec = itobin_vec(temp, num_mask_bits);
+    /* Decode the lut_output_mask to LUT input codes, where the i-th mask bit
+     * is the i-th bit (starting from the LSB) of the code */
+    VTR_ASSERT(num_mask_bits < 64);
+    size_t all_ones = (size_t(1) << num_mask_bits) - 1;
+    VTR_ASSERT(lut_output_mask <= all_ones);
+    size_t mask_code = all_ones - lut_output_mask;
     /* Copy the bits to the truth table line */
     std::vector<vtr::LogicValue> adapt_tt_line = tt_line;
-    for (size_t itt = lut_frac_level;
-         itt < lut_frac_level + mask_bits_vec.size(); ++itt) {
-      vtr::LogicValue logic_val = vtr::LogicValue::FALSE;
-      VTR_ASSERT((1 == mask_bits_vec[itt - lut_frac_level]) ||
-                 (0 == mask_bits_vec[itt - lut_frac_level]));
-      if (1 == mask_bits_vec[itt - lut_frac_level]) {
-        logic_val = vtr::LogicValue::TRUE;
-      }
-      adapt_tt_line[itt] = logic_val;
+    for (int ibit = 0; ibit < num_mask_bits; ++ibit) {
+      adapt_tt_line[lut_frac_level + ibit] = (1 & (mask_code >> ibit))
+                                               ? vtr::LogicValue::TRUE
+                                               : vtr::LogicValue::FALSE;
     }
 
     /* Push to adapted truth table */
-    adapt_truth_table.push_back(adapt_tt_line);
+    adapt_truth_table.push_back(std::move(adapt_tt_line));
   }
 
   return adapt_truth_table;
@@ -264,114 +264,127 @@ bool lut_truth_table_use_on_set(const AtomNetlist::TruthTable& truth_table) {
 }
 
 /********************************************************************
- * Complete a line in truth table with a given lut size
- * Due to the size of truth table may be less than the lut size.
+ * LUT bitstreams are built in a packed format, where each word contains 64
+ * bits of the bitstream. The i-th bit of the bitstream is the (i % 64)-th bit
+ * of the (i / 64)-th word.
+ *
+ * The index of a bit in the bitstream is decoded from the input values of
+ * the LUT, where the i-th input is the i-th bit of the index:
+ * We assume the 1-lut pass sram1 when input = 0,
+ * and the 1-lut pass sram0 when input = 1
+ *******************************************************************/
+typedef uint64_t t_lut_word;
+constexpr size_t LUT_WORD_SIZE = 64;
+constexpr size_t LUT_WORD_NUM_INPUTS = 6; /* log2(LUT_WORD_SIZE) */
+
+/* The bits in a word whose index has the i-th bit set, i.e., the bits
+ * selected when the i-th input of the LUT is '0' */
+static const t_lut_word LUT_WORD_INPUT_MASKS[LUT_WORD_NUM_INPUTS] = {
+  0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+  0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+
+/********************************************************************
+ * Encode a line of truth table to a cube, which consists of
+ * - care bits: the i-th bit is set when the i-th input is either '0' or '1'
+ * - index bits: the i-th bit is set when the i-th input is '0'
+ * The size of truth table may be less than the lut size.
  * i.e. in LUT-6 architecture, there exists LUT1-6 in technology-mapped netlists
  * So, in truth table line, there may be 10- 1
- * In this case, we should complete it by --10- 1
+ * The missing inputs are considered as don't care, i.e., --10- 1
  *******************************************************************/
-static std::vector<vtr::LogicValue> complete_truth_table_line(
-  const size_t& lut_size, const std::vector<vtr::LogicValue>& tt_line) {
-  std::vector<vtr::LogicValue> ret;
-
+static void encode_truth_table_line(const size_t& lut_size,
+                                    const std::vector<vtr::LogicValue>& tt_line,
+                                    size_t& care_bits, size_t& index_bits) {
   VTR_ASSERT(0 < tt_line.size());
-
-  /* Complete the truth table line*/
   size_t cover_len = tt_line.size() - 1;
   VTR_ASSERT(cover_len <= lut_size);
 
-  /* Copy the original truth table line */
-  ret = tt_line;
-  /* Kick out the last value for now as it is the output value */
-  ret.pop_back();
-
-  /* Add the number of '-' we should add in the back !!! */
-  for (size_t j = cover_len; j < lut_size; ++j) {
-    ret.push_back(vtr::LogicValue::DONT_CARE);
-  }
-
-  /* Copy the original truth table line */
-  ret.push_back(tt_line.back());
-
-  /* Check if the size of ret matches our expectation */
-  VTR_ASSERT(lut_size + 1 == ret.size());
-
-  return ret;
-}
-
-/********************************************************************
- * For each lut_bit_lines, we should recover the truth table,
- * and then set the sram bits to "1" if the truth table defines so.
- * Start_point: the position we start converting don't care sign '-'
- *              to explicit '0' or '1'
- *******************************************************************/
-static void rec_build_lut_bitstream_per_line(
-  std::vector<bool>& lut_bitstream, const size_t& lut_size,
-  const std::vector<vtr::LogicValue>& tt_line, const size_t& start_point) {
-  std::vector<vtr::LogicValue> temp_line = tt_line;
-
-  /* Check the length of sram bits and truth table line */
-  VTR_ASSERT(lut_size + 1 == tt_line.size()); /* lut_size + '1|0' */
-
-  /* End of truth_table_line should be "space" and "1" */
-  VTR_ASSERT((vtr::LogicValue::TRUE == tt_line.back()) ||
-             (vtr::LogicValue::FALSE == tt_line.back()));
-
-  /* Make sure before start point there is no '-' */
-  VTR_ASSERT(start_point < tt_line.size());
-  for (size_t i = 0; i < start_point; ++i) {
-    VTR_ASSERT(vtr::LogicValue::DONT_CARE != tt_line[i]);
-  }
-
-  /* Configure sram bits recursively */
-  for (size_t i = start_point; i < lut_size; ++i) {
-    if (vtr::LogicValue::DONT_CARE == tt_line[i]) {
-      /* if we find a dont_care, we don't do configure now but recursively*/
-      /* '0' branch */
-      temp_line[i] = vtr::LogicValue::FALSE;
-      rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, temp_line,
-                                       start_point + 1);
-      /* '1' branch */
-      temp_line[i] = vtr::LogicValue::TRUE;
-      rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, temp_line,
-                                       start_point + 1);
-      return;
-    }
-  }
-
-  /* TODO: Use MuxGraph to decode this!!! */
-  /* Decode bitstream only when there are only 0 or 1 in the truth table */
-  size_t sram_id = 0;
-  for (size_t i = 0; i < lut_size; ++i) {
-    /* Should be either '0' or '1' */
+  care_bits = 0;
+  index_bits = 0;
+  for (size_t i = 0; i < cover_len; ++i) {
     switch (tt_line[i]) {
       case vtr::LogicValue::FALSE:
-        /* We assume the 1-lut pass sram1 when input = 0 */
-        sram_id += (size_t)pow(2., (double)(i));
+        care_bits |= (size_t(1) << i);
+        index_bits |= (size_t(1) << i);
         break;
       case vtr::LogicValue::TRUE:
-        /* We assume the 1-lut pass sram0 when input = 1 */
+        care_bits |= (size_t(1) << i);
         break;
       case vtr::LogicValue::DONT_CARE:
+        break;
       default:
         VTR_LOGF_ERROR(__FILE__, __LINE__,
-                       "Invalid truth_table bit '%s', should be [0|1|]!\n",
+                       "Invalid truth_table bit '%s', should be [0|1|-]!\n",
                        vtr::LOGIC_VALUE_STRING[size_t(tt_line[i])]);
         exit(1);
     }
   }
-  /* Set the sram bit to '1'*/
-  VTR_ASSERT(sram_id < lut_bitstream.size());
+}
+
+/********************************************************************
+ * Set the bits covered by a line of truth table to the output value of
+ * the line.
+ * Rather than expanding each don't care to '0' and '1' and decoding bit by
+ * bit, the bits are updated word by word:
+ * - The first 6 inputs select bits inside a word, which are found by
+ *   combining the input masks
+ * - The other inputs select words, which are enumerated as all the
+ *   combinations of the don't care inputs
+ *******************************************************************/
+static void build_lut_bitstream_words_per_line(
+  std::vector<t_lut_word>& lut_words, const size_t& lut_size,
+  const std::vector<vtr::LogicValue>& tt_line) {
+  size_t care_bits = 0;
+  size_t index_bits = 0;
+  encode_truth_table_line(lut_size, tt_line, care_bits, index_bits);
+
+  /* Find the bits inside a word */
+  t_lut_word word_mask = ~t_lut_word(0);
+  for (size_t i = 0; i < std::min(lut_size, LUT_WORD_NUM_INPUTS); ++i) {
+    if (0 == (1 & (care_bits >> i))) {
+      continue;
+    }
+    if (1 & (index_bits >> i)) {
+      word_mask &= LUT_WORD_INPUT_MASKS[i];
+    } else {
+      word_mask &= ~LUT_WORD_INPUT_MASKS[i];
+    }
+  }
+
+  /* Find the words */
+  size_t num_word_inputs = 0;
+  if (lut_size > LUT_WORD_NUM_INPUTS) {
+    num_word_inputs = lut_size - LUT_WORD_NUM_INPUTS;
+  }
+  size_t word_dont_cares = ~(care_bits >> LUT_WORD_NUM_INPUTS) &
+                           ((size_t(1) << num_word_inputs) - 1);
+  size_t word_index_base = index_bits >> LUT_WORD_NUM_INPUTS;
+
+  bool output_value = false;
   if (vtr::LogicValue::TRUE == tt_line.back()) {
-    lut_bitstream[sram_id] = true; /* on set*/
+    output_value = true; /* on set */
   } else if (vtr::LogicValue::FALSE == tt_line.back()) {
-    lut_bitstream[sram_id] = false; /* off set */
+    output_value = false; /* off set */
   } else {
     VTR_LOGF_ERROR(__FILE__, __LINE__,
                    "Invalid truth_table_line ending '%s'!\n",
                    vtr::LOGIC_VALUE_STRING[size_t(tt_line.back())]);
     exit(1);
   }
+
+  /* Walk through all the subsets of the don't care bits */
+  size_t word_dont_care_subset = 0;
+  do {
+    size_t word_index = word_index_base | word_dont_care_subset;
+    VTR_ASSERT(word_index < lut_words.size());
+    if (true == output_value) {
+      lut_words[word_index] |= word_mask;
+    } else {
+      lut_words[word_index] &= ~word_mask;
+    }
+    word_dont_care_subset =
+      (word_dont_care_subset - word_dont_cares) & word_dont_cares;
+  } while (0 != word_dont_care_subset);
 }
 
 /********************************************************************
@@ -379,14 +392,12 @@ static void rec_build_lut_bitstream_per_line(
  * As truth tables may come from different logic blocks, truth tables could be
  *in on and off sets We first build a base SRAM bits, where different parts are
  *set to tbe on/off sets Then, we can decode SRAM bits as regular process
+ * The bitstream is returned in the packed format
  *******************************************************************/
-static std::vector<bool> build_single_output_lut_bitstream(
-  const AtomNetlist::TruthTable& truth_table, const MuxGraph& lut_mux_graph,
+static std::vector<t_lut_word> build_single_output_lut_bitstream(
+  const AtomNetlist::TruthTable& truth_table, const size_t& lut_size,
   const size_t& default_sram_bit_value) {
-  size_t lut_size = lut_mux_graph.num_memory_bits();
-  size_t bitstream_size = lut_mux_graph.num_inputs();
-  std::vector<bool> lut_bitstream(bitstream_size, false);
-  AtomNetlist::TruthTable completed_truth_table;
+  VTR_ASSERT(lut_size < 64);
   bool on_set = false;
   bool off_set = false;
 
@@ -412,28 +423,21 @@ static std::vector<bool> build_single_output_lut_bitstream(
     off_set = !on_set;
   }
 
+  /* Initial all the bits in the bitstream
+   * By default, the lut_bitstream is initialize for on_set
+   * For off set, it should be flipped
+   */
+  size_t num_words =
+    ((size_t(1) << lut_size) + LUT_WORD_SIZE - 1) / LUT_WORD_SIZE;
+  std::vector<t_lut_word> lut_words(
+    num_words, (true == off_set) ? ~t_lut_word(0) : t_lut_word(0));
+
   /* Read in truth table lines, decode one by one */
   for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
-    /* Complete the truth table line by line*/
-    completed_truth_table.push_back(
-      complete_truth_table_line(lut_size, tt_line));
-  }
-
-  /* Initial all the bits in the bitstream */
-  if (true == off_set) {
-    /* By default, the lut_bitstream is initialize for on_set
-     * For off set, it should be flipped
-     */
-    lut_bitstream.clear();
-    lut_bitstream.resize(bitstream_size, true);
+    build_lut_bitstream_words_per_line(lut_words, lut_size, tt_line);
   }
 
-  for (const std::vector<vtr::LogicValue>& tt_line : completed_truth_table) {
-    /* Update the truth table, sram_bits */
-    rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, tt_line, 0);
-  }
-
-  return lut_bitstream;
+  return lut_words;
 }
 
 /********************************************************************
@@ -447,12 +451,10 @@ std::vector<bool> build_frac_lut_bitstream(
   const VprDeviceAnnotation& device_annotation,
   const std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable>& truth_tables,
   const size_t& default_sram_bit_value) {
-  /* Initialization */
-  std::vector<bool> lut_bitstream(lut_mux_graph.num_inputs(),
-                                  default_sram_bit_value);
-
-  for (std::pair<const t_pb_graph_pin*, AtomNetlist::TruthTable> element :
-       truth_tables) {
+  std::vector<size_t> lut_frac_levels;
+  std::vector<size_t> lut_output_masks;
+  std::vector<AtomNetlist::TruthTable> output_truth_tables;
+  for (const auto& element : truth_tables) {
     /* Find the corresponding circuit model output port and assoicated
      * lut_output_mask */
     CircuitPortId lut_model_output_port =
@@ -470,49 +472,58 @@ std::vector<bool> build_frac_lut_bitstream(
     size_t lut_output_mask = circuit_lib.port_lut_output_mask(
       lut_model_output_port)[element.first->pin_number];
 
+    lut_frac_levels.push_back(lut_frac_level);
+    lut_output_masks.push_back(lut_output_mask);
+    output_truth_tables.push_back(element.second);
+  }
+
+  return build_frac_lut_bitstream(
+    lut_mux_graph.num_memory_bits(), lut_mux_graph.num_inputs(),
+    lut_frac_levels, lut_output_masks, output_truth_tables,
+    default_sram_bit_value);
+}
+
+/********************************************************************
+ * Generate bitstream for a fracturable LUT from the truth tables of its
+ * outputs, where the i-th output has a frac level and an output mask,
+ * which decide the segment of the bitstream that it drives.
+ * This is the core of the function above, which does not require any
+ * architecture data structure
+ *******************************************************************/
+std::vector<bool> build_frac_lut_bitstream(
+  const size_t& lut_size, const size_t& bitstream_size,
+  const std::vector<size_t>& lut_frac_levels,
+  const std::vector<size_t>& lut_output_masks,
+  const std::vector<AtomNetlist::TruthTable>& truth_tables,
+  const size_t& default_sram_bit_value) {
+  VTR_ASSERT(lut_frac_levels.size() == truth_tables.size());
+  VTR_ASSERT(lut_output_masks.size() == truth_tables.size());
+  VTR_ASSERT(bitstream_size <= (size_t(1) << lut_size));
+
+  /* Initialization */
+  std::vector<bool> lut_bitstream(bitstream_size, default_sram_bit_value);
+
+  for (size_t ioutput = 0; ioutput < truth_tables.size(); ++ioutput) {
     /* Decode lut sram bits */
-    std::vector<bool> temp_bitstream = build_single_output_lut_bitstream(
-      element.second, lut_mux_graph, default_sram_bit_value);
+    std::vector<t_lut_word> temp_bitstream = build_single_output_lut_bitstream(
+      truth_tables[ioutput], lut_size, default_sram_bit_value);
 
     /* Depending on the frac-level, we get the location(starting/end points) of
      * sram bits */
-    size_t length_of_temp_bitstream_to_copy =
-      (size_t)pow(2., (double)(lut_frac_level));
+    size_t length_of_temp_bitstream_to_copy = size_t(1)
+                                              << lut_frac_levels[ioutput];
     size_t bitstream_offset =
-      length_of_temp_bitstream_to_copy * lut_output_mask;
+      length_of_temp_bitstream_to_copy * lut_output_masks[ioutput];
     /* Ensure the offset is in range */
     VTR_ASSERT(bitstream_offset < lut_bitstream.size());
     VTR_ASSERT(bitstream_offset + length_of_temp_bitstream_to_copy <=
                lut_bitstream.size());
 
-    /* Print debug information
-    bool verbose = true;
-    VTR_LOGV(verbose, "Full truth table\n");
-    for (const std::string& tt_line : truth_table_to_string(element.second)) {
-      VTR_LOGV(verbose, "\t%s\n", tt_line.c_str());
-    }
-    VTR_LOGV(verbose, "\n");
-
-    VTR_LOGV(verbose, "Bitstream (size = %ld)\n", temp_bitstream.size());
-    for (const bool& bit : temp_bitstream) {
-      if (true == bit) {
-        VTR_LOGV(verbose, "1");
-      } else {
-        VTR_ASSERT(false == bit);
-        VTR_LOGV(verbose, "0");
-      }
-    }
-    VTR_LOGV(verbose, "\n");
-
-    VTR_LOGV(verbose, "Bitstream offset = %d\n", bitstream_offset);
-    VTR_LOGV(verbose, "Bitstream length to be used = %d\n",
-    length_of_temp_bitstream_to_copy);
-     */
-
     /* Copy to the segment of bitstream */
     for (size_t bit = bitstream_offset;
          bit < bitstream_offset + length_of_temp_bitstream_to_copy; ++bit) {
-      lut_bitstream[bit] = temp_bitstream[bit];
+      lut_bitstream[bit] =
+        1 & (temp_bitstream[bit / LUT_WORD_SIZE] >> (bit % LUT_WORD_SIZE));
     }
   }
 
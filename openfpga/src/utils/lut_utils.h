@@ -42,6 +42,13 @@ std::vector<bool> build_frac_lut_bitstream(
   const std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable>& truth_tables,
   const size_t& default_sram_bit_value);
 
+std::vector<bool> build_frac_lut_bitstream(
+  const size_t& lut_size, const size_t& bitstream_size,
+  const std::vector<size_t>& lut_frac_levels,
+  const std::vector<size_t>& lut_output_masks,
+  const std::vector<AtomNetlist::TruthTable>& truth_tables,
+  const size_t& default_sram_bit_value);
+
 bool is_wired_lut(const std::vector<AtomNetId>& input_nets,
                   const AtomNetId& output_net);
 
@@ -0,0 +1,137 @@
+/***************************************************************************************
+ * Report the statistics of module graph, considering the whole hierarchy
+ ***************************************************************************************/
+/* Headers from system goes first */
+#include <chrono>
+#include <ctime>
+#include <string>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil library */
+#include "command_exit_codes.h"
+#include "openfpga_digest.h"
+#include "report_fabric_statistics.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * Top-level function
+ *******************************************************************/
+int report_fabric_statistics(const std::string& fname,
+                             const std::string& module_name,
+                             const ModuleManager& module_manager,
+                             const bool& include_time_stamp,
+                             const bool& verbose) {
+  vtr::ScopedStartFinishTimer timer("Report fabric statistics");
+
+  ModuleId root_module = module_manager.find_module(module_name);
+  if (false == module_manager.valid_module_id(root_module)) {
+    VTR_LOG_ERROR("Module %s doesn't exist\n", module_name.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Statistics of all the modules are computed once here */
+  ModuleHierarchyStatistics statistics(module_manager);
+
+  show_fabric_statistics(root_module, module_manager, statistics, verbose);
+
+  if (fname.empty()) {
+    return CMD_EXEC_SUCCESS;
+  }
+  return write_fabric_statistics_to_file(fname.c_str(), root_module,
+                                         module_manager, statistics,
+                                         include_time_stamp);
+}
+
+/********************************************************************
+ * Show the statistics of a root module. When verbose is enabled, show
+ * the statistics of each unique module under the root module as well
+ *******************************************************************/
+void show_fabric_statistics(const ModuleId& root_module,
+                            const ModuleManager& module_manager,
+                            const ModuleHierarchyStatistics& statistics,
+                            const bool& verbose) {
+  std::vector<ModuleId> hie_modules =
+    statistics.hierarchy_modules(root_module);
+
+  VTR_LOG("Module '%s':\n", module_manager.module_name(root_module).c_str());
+  VTR_LOG("  Unique modules: %lu\n", hie_modules.size());
+  VTR_LOG("  Instances: %lu\n", statistics.num_instances(root_module));
+  VTR_LOG("  Configuration bits: %lu\n",
+          statistics.num_config_bits(root_module));
+  VTR_LOG("  Nets: %lu\n", statistics.num_hierarchy_nets(root_module));
+  VTR_LOG("  Depth: %lu\n", statistics.depth(root_module));
+
+  if (!verbose) {
+    return;
+  }
+
+  vtr::vector<ModuleId, size_t> instance_counts =
+    statistics.hierarchy_instance_counts(root_module);
+  VTR_LOG(
+    "----------------------------------------------------------------------\n");
+  VTR_LOG("%-40s %10s %6s %12s %10s\n", "Module", "Instances", "Depth",
+          "Config bits", "Nets");
+  VTR_LOG(
+    "----------------------------------------------------------------------\n");
+  for (const ModuleId& module : hie_modules) {
+    VTR_LOG("%-40s %10lu %6lu %12lu %10lu\n",
+            module_manager.module_name(module).c_str(), instance_counts[module],
+            statistics.depth(module), statistics.num_config_bits(module),
+            statistics.num_nets(module));
+  }
+  VTR_LOG(
+    "----------------------------------------------------------------------\n");
+}
+
+/********************************************************************
+ * Write the statistics of each unique module under a root module to a
+ * given file in YAML format
+ *******************************************************************/
+int write_fabric_statistics_to_file(
+  const char* fname, const ModuleId& root_module,
+  const ModuleManager& module_manager,
+  const ModuleHierarchyStatistics& statistics, const bool& include_time_stamp) {
+  std::fstream fp;
+  fp.open(std::string(fname), std::fstream::out | std::fstream::trunc);
+  openfpga::check_file_stream(fname, fp);
+
+  if (include_time_stamp) {
+    auto end = std::chrono::system_clock::now();
+    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
+    fp << "Date: " << std::ctime(&end_time) << std::endl;
+  }
+
+  vtr::vector<ModuleId, size_t> instance_counts =
+    statistics.hierarchy_instance_counts(root_module);
+
+  fp << "#instances are counted under module '"
+     << module_manager.module_name(root_module) << "'" << std::endl;
+  fp << "#config_bits, hierarchy_nets and depth consider all the modules "
+        "under each module"
+     << std::endl;
+  fp << "modules:" << std::endl;
+  for (const ModuleId& module : statistics.hierarchy_modules(root_module)) {
+    fp << "- module: " << module_manager.module_name(module) << std::endl
+       << "  instances: " << instance_counts[module] << std::endl
+       << "  child_instances: " << statistics.num_child_instances(module)
+       << std::endl
+       << "  hierarchy_instances: " << statistics.num_instances(module)
+       << std::endl
+       << "  config_bits: " << statistics.num_config_bits(module) << std::endl
+       << "  nets: " << statistics.num_nets(module) << std::endl
+       << "  hierarchy_nets: " << statistics.num_hierarchy_nets(module)
+       << std::endl
+       << "  depth: " << statistics.depth(module) << std::endl;
+  }
+
+  fp.close();
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,35 @@
+#ifndef REPORT_FABRIC_STATISTICS_H
+#define REPORT_FABRIC_STATISTICS_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+#include "module_hierarchy_statistics.h"
+#include "module_manager.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+int report_fabric_statistics(const std::string& fname,
+                             const std::string& module_name,
+                             const ModuleManager& module_manager,
+                             const bool& include_time_stamp,
+                             const bool& verbose);
+
+void show_fabric_statistics(const ModuleId& root_module,
+                            const ModuleManager& module_manager,
+                            const ModuleHierarchyStatistics& statistics,
+                            const bool& verbose);
+
+int write_fabric_statistics_to_file(
+  const char* fname, const ModuleId& root_module,
+  const ModuleManager& module_manager,
+  const ModuleHierarchyStatistics& statistics, const bool& include_time_stamp);
+} /* end namespace openfpga */
+
+#endif
@@ -0,0 +1,280 @@
+/********************************************************************
+ * Unit test functions to validate the correctness of LUT bitstreams
+ * The bitstreams built by lut_utils are compared with those built by a
+ * reference implementation, which expands each don't care of a truth
+ * table line recursively and decodes the bitstream bit by bit.
+ * Random truth tables are tested on
+ * 1. single-output LUTs of 1 to 10 inputs, including those whose
+ *    bitstreams are shorter than a 64-bit word
+ * 2. fracturable LUTs, where each output drives a segment of the
+ *    bitstream, decided by its frac level and output mask
+ *
+ * Usage: test_lut_utils [<number of random tests per LUT size>]
+ *******************************************************************/
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_decode.h"
+
+/* Headers from openfpga library */
+#include "lut_utils.h"
+
+namespace openfpga {
+
+constexpr size_t TEST_MAX_LUT_SIZE = 10;
+constexpr size_t TEST_MAX_NUM_TRUTH_TABLE_LINES = 6;
+
+/********************************************************************
+ * Reference implementation of adapting the truth table of an output of a
+ * fracturable LUT, where the mask bits are decoded one by one
+ *******************************************************************/
+static AtomNetlist::TruthTable reference_adapt_truth_table_for_frac_lut(
+  const size_t& lut_frac_level, const size_t& lut_output_mask,
+  const AtomNetlist::TruthTable& truth_table) {
+  AtomNetlist::TruthTable adapt_truth_table;
+  for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
+    size_t lut_size = tt_line.size() - 1;
+    size_t num_mask_bits = lut_size - lut_frac_level;
+    std::vector<vtr::LogicValue> adapt_tt_line = tt_line;
+    if (0 < num_mask_bits) {
+      std::vector<size_t> mask_bits_vec = itobin_vec(
+        (size_t(1) << num_mask_bits) - 1 - lut_output_mask, num_mask_bits);
+      for (size_t ibit = 0; ibit < mask_bits_vec.size(); ++ibit) {
+        adapt_tt_line[lut_frac_level + ibit] = (1 == mask_bits_vec[ibit])
+                                                 ? vtr::LogicValue::TRUE
+                                                 : vtr::LogicValue::FALSE;
+      }
+    }
+    adapt_truth_table.push_back(adapt_tt_line);
+  }
+  return adapt_truth_table;
+}
+
+/********************************************************************
+ * Reference implementation of setting the bits covered by a line of
+ * truth table, where the line is completed with don't cares to the LUT
+ * size, and each don't care is expanded to '0' and '1' recursively
+ *******************************************************************/
+static void rec_reference_build_lut_bitstream_per_line(
+  std::vector<bool>& lut_bitstream, const size_t& lut_size,
+  std::vector<vtr::LogicValue>& tt_line, const size_t& start_point) {
+  for (size_t i = start_point; i < lut_size; ++i) {
+    if (vtr::LogicValue::DONT_CARE == tt_line[i]) {
+      tt_line[i] = vtr::LogicValue::FALSE;
+      rec_reference_build_lut_bitstream_per_line(lut_bitstream, lut_size,
+                                                 tt_line, i + 1);
+      tt_line[i] = vtr::LogicValue::TRUE;
+      rec_reference_build_lut_bitstream_per_line(lut_bitstream, lut_size,
+                                                 tt_line, i + 1);
+      tt_line[i] = vtr::LogicValue::DONT_CARE;
+      return;
+    }
+  }
+
+  /* The 1-lut pass sram1 when input = 0, and sram0 when input = 1 */
+  size_t sram_id = 0;
+  for (size_t i = 0; i < lut_size; ++i) {
+    if (vtr::LogicValue::FALSE == tt_line[i]) {
+      sram_id += size_t(1) << i;
+    }
+  }
+  VTR_ASSERT(sram_id < lut_bitstream.size());
+  lut_bitstream[sram_id] = (vtr::LogicValue::TRUE == tt_line.back());
+}
+
+/********************************************************************
+ * Reference implementation of building the bitstream of a fracturable LUT
+ *******************************************************************/
+static std::vector<bool> reference_build_frac_lut_bitstream(
+  const size_t& lut_size, const std::vector<size_t>& lut_frac_levels,
+  const std::vector<size_t>& lut_output_masks,
+  const std::vector<AtomNetlist::TruthTable>& truth_tables,
+  const size_t& default_sram_bit_value) {
+  size_t bitstream_size = size_t(1) << lut_size;
+  std::vector<bool> lut_bitstream(bitstream_size, default_sram_bit_value);
+
+  for (size_t ioutput = 0; ioutput < truth_tables.size(); ++ioutput) {
+    bool on_set = (0 == default_sram_bit_value);
+    if (false == truth_tables[ioutput].empty()) {
+      on_set = lut_truth_table_use_on_set(truth_tables[ioutput]);
+    }
+    std::vector<bool> temp_bitstream(bitstream_size, !on_set);
+    for (const std::vector<vtr::LogicValue>& tt_line : truth_tables[ioutput]) {
+      std::vector<vtr::LogicValue> completed_line(tt_line.begin(),
+                                                  tt_line.end() - 1);
+      completed_line.resize(lut_size, vtr::LogicValue::DONT_CARE);
+      completed_line.push_back(tt_line.back());
+      rec_reference_build_lut_bitstream_per_line(temp_bitstream, lut_size,
+                                                 completed_line, 0);
+    }
+
+    size_t length = size_t(1) << lut_frac_levels[ioutput];
+    size_t offset = length * lut_output_masks[ioutput];
+    for (size_t bit = offset; bit < offset + length; ++bit) {
+      lut_bitstream[bit] = temp_bitstream[bit];
+    }
+  }
+
+  return lut_bitstream;
+}
+
+/********************************************************************
+ * Create a random truth table whose lines have a given number of inputs.
+ * Most of the truth tables are either on-sets or off-sets, while a few
+ * mix both of them
+ *******************************************************************/
+static AtomNetlist::TruthTable random_truth_table(std::mt19937& rng,
+                                                  const size_t& num_inputs) {
+  size_t num_lines = rng() % (TEST_MAX_NUM_TRUTH_TABLE_LINES + 1);
+  bool mixed = (0 == rng() % 8);
+  vtr::LogicValue output =
+    (rng() % 2) ? vtr::LogicValue::TRUE : vtr::LogicValue::FALSE;
+
+  AtomNetlist::TruthTable truth_table;
+  for (size_t iline = 0; iline < num_lines; ++iline) {
+    std::vector<vtr::LogicValue> tt_line;
+    for (size_t i = 0; i < num_inputs; ++i) {
+      switch (rng() % 3) {
+        case 0:
+          tt_line.push_back(vtr::LogicValue::FALSE);
+          break;
+        case 1:
+          tt_line.push_back(vtr::LogicValue::TRUE);
+          break;
+        default:
+          tt_line.push_back(vtr::LogicValue::DONT_CARE);
+          break;
+      }
+    }
+    if (true == mixed) {
+      output = (rng() % 2) ? vtr::LogicValue::TRUE : vtr::LogicValue::FALSE;
+    }
+    tt_line.push_back(output);
+    truth_table.push_back(tt_line);
+  }
+  return truth_table;
+}
+
+static std::string bitstream_to_string(const std::vector<bool>& bitstream) {
+  std::string bits;
+  for (const bool& bit : bitstream) {
+    bits.push_back(bit ? '1' : '0');
+  }
+  return bits;
+}
+
+/********************************************************************
+ * Build the bitstream of a LUT with random outputs and compare it with
+ * the reference. Return the number of mismatches
+ *******************************************************************/
+static size_t test_random_lut(std::mt19937& rng, const size_t& lut_size,
+                              const bool& fracturable) {
+  size_t num_mismatches = 0;
+
+  /* A single-output LUT uses the whole bitstream. Each output of a
+   * fracturable LUT uses a segment, selected by its output mask */
+  size_t lut_frac_level = lut_size;
+  if (true == fracturable) {
+    lut_frac_level = 1 + rng() % (lut_size - 1);
+  }
+  size_t num_segments = size_t(1) << (lut_size - lut_frac_level);
+  size_t default_sram_bit_value = rng() % 2;
+
+  std::vector<size_t> lut_frac_levels;
+  std::vector<size_t> lut_output_masks;
+  std::vector<AtomNetlist::TruthTable> truth_tables;
+  for (size_t mask = 0; mask < num_segments; ++mask) {
+    /* Leave some segments unused */
+    if ((1 < num_segments) && (0 == rng() % 3)) {
+      continue;
+    }
+    /* Truth tables of a single-output LUT may have less inputs than the
+     * LUT, while those of a fracturable LUT have been adapted to the LUT
+     * size so that the mask bits can be applied */
+    size_t num_inputs = lut_size;
+    if (false == fracturable) {
+      num_inputs = rng() % (lut_size + 1);
+    }
+    AtomNetlist::TruthTable truth_table = random_truth_table(rng, num_inputs);
+    if (true == fracturable) {
+      AtomNetlist::TruthTable adapt_truth_table =
+        adapt_truth_table_for_frac_lut(lut_frac_level, mask, truth_table);
+      if (adapt_truth_table != reference_adapt_truth_table_for_frac_lut(
+                                 lut_frac_level, mask, truth_table)) {
+        VTR_LOG_ERROR(
+          "Mismatch in adapting truth table for LUT%lu with frac level %lu "
+          "and output mask %lu\n",
+          lut_size, lut_frac_level, mask);
+        num_mismatches++;
+      }
+      truth_table = adapt_truth_table;
+    }
+    lut_frac_levels.push_back(lut_frac_level);
+    lut_output_masks.push_back(mask);
+    truth_tables.push_back(truth_table);
+  }
+
+  std::vector<bool> bitstream = build_frac_lut_bitstream(
+    lut_size, size_t(1) << lut_size, lut_frac_levels, lut_output_masks,
+    truth_tables, default_sram_bit_value);
+  std::vector<bool> ref_bitstream = reference_build_frac_lut_bitstream(
+    lut_size, lut_frac_levels, lut_output_masks, truth_tables,
+    default_sram_bit_value);
+  if (bitstream != ref_bitstream) {
+    VTR_LOG_ERROR(
+      "Mismatch in bitstream of LUT%lu with frac level %lu:\n\tExpect:  "
+      "%s\n\tActual:  %s\n",
+      lut_size, lut_frac_level, bitstream_to_string(ref_bitstream).c_str(),
+      bitstream_to_string(bitstream).c_str());
+    for (size_t ioutput = 0; ioutput < truth_tables.size(); ++ioutput) {
+      VTR_LOG("\tOutput mask %lu:\n", lut_output_masks[ioutput]);
+      for (const std::string& tt_line :
+           truth_table_to_string(truth_tables[ioutput])) {
+        VTR_LOG("\t\t%s\n", tt_line.c_str());
+      }
+    }
+    num_mismatches++;
+  }
+
+  return num_mismatches;
+}
+
+} /* end namespace openfpga */
+
+int main(int argc, const char** argv) {
+  /* Ensure we have only one or zero argument */
+  VTR_ASSERT((1 == argc) || (2 == argc));
+
+  size_t num_tests = 1000;
+  if (2 == argc) {
+    num_tests = std::atoi(argv[1]);
+  }
+
+  std::mt19937 rng(1);
+  size_t num_mismatches = 0;
+  for (size_t lut_size = 1; lut_size <= openfpga::TEST_MAX_LUT_SIZE;
+       ++lut_size) {
+    for (size_t itest = 0; itest < num_tests; ++itest) {
+      num_mismatches += openfpga::test_random_lut(rng, lut_size, false);
+      if (1 < lut_size) {
+        num_mismatches += openfpga::test_random_lut(rng, lut_size, true);
+      }
+    }
+    VTR_LOG("Tested %lu random LUT%lu bitstreams\n",
+            (1 < lut_size) ? 2 * num_tests : num_tests, lut_size);
+  }
+
+  if (0 < num_mismatches) {
+    VTR_LOG_ERROR("Found %lu mismatches in LUT bitstreams\n", num_mismatches);
+    return 1;
+  }
+  VTR_LOG("All the LUT bitstreams match the reference\n");
+  return 0;
+}
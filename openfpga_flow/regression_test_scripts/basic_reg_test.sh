@@ -118,6 +118,18 @@ echo -e "Testing Verilog testbench generation only";
 run-task basic_tests/generate_testbench $@
 run-task basic_tests/generate_template_testbench $@
 
+echo -e "Testing commands with multiple threads";
+run-task basic_tests/multi_thread/build_fabric $@
+run-task basic_tests/multi_thread/link_openfpga_arch $@
+run-task basic_tests/multi_thread/check_netlist_naming_conflict $@
+
+echo -e "Testing incremental fabric generation";
+run-task basic_tests/incremental_fabric/unchanged_arch $@
+run-task basic_tests/incremental_fabric/changed_circuit_model $@
+
+echo -e "Testing fabric statistics report";
+run-task basic_tests/report_fabric_statistics $@
+
 echo -e "Testing separated Verilog fabric netlists and testbench locations";
 run-task basic_tests/custom_fabric_netlist_location $@
 
@@ -253,6 +265,7 @@ run-task basic_tests/clock_network/homo_1clock_1reset_2layer_dec $@
 run-task basic_tests/clock_network/homo_1clock_2layer_full_tb $@
 run-task basic_tests/clock_network/homo_2clock_2layer $@
 run-task basic_tests/clock_network/homo_2clock_2layer_disable_unused $@
+run-task basic_tests/clock_network/homo_2clock_2layer_multi_thread $@
 run-task basic_tests/clock_network/homo_2clock_2layer_disable_unused_tree $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer $@
 run-task basic_tests/clock_network/homo_1clock_1reset_3layer_2entry $@
@@ -261,6 +274,7 @@ run-task basic_tests/clock_network/homo_1clock_1reset_2layer_y_entry $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut_pb_pin_fixup $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut_pb_pin_fixup_msb $@
+run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut_pb_pin_fixup_multi_thread $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_syntax $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_disable_unused_spines $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_internal_driver $@
@@ -33,6 +33,9 @@ run-task fpga_bitstream/repack_wire_lut $@
 run-task fpga_bitstream/repack_wire_lut_strong $@
 run-task fpga_bitstream/repack_ignore_nets $@
 
+echo -e "Testing repacker with the routing resource graphs of logical tiles loaded from a file";
+run-task fpga_bitstream/repack_lb_rr_graph_cache $@
+
 echo -e "Testing overloading default paths for programmable interconnect when generating bitstream";
 run-task fpga_bitstream/overload_mux_default_path $@
 echo -e "Testing overloading mode bits for DSP blocks when generating bitstream";
@@ -44,9 +47,12 @@ run-task fpga_bitstream/write_io_mapping $@
 echo -e "Testing report bitstream distribution to file";
 run-task fpga_bitstream/report_bitstream_distribution/default_depth $@
 run-task fpga_bitstream/report_bitstream_distribution/custom_depth $@
+run-task fpga_bitstream/report_bitstream_distribution/csv_format $@
+run-task fpga_bitstream/report_bitstream_distribution/json_format $@
 
 echo -e "Testing bitstream file with don't care bits";
 run-task fpga_bitstream/dont_care_bits/ql_memory_bank_flatten $@
+run-task fpga_bitstream/dont_care_bits/ql_memory_bank_flatten_fast_write $@
 run-task fpga_bitstream/dont_care_bits/ql_memory_bank_shift_register $@
 
 echo -e "Testing bitstream file with selective contents";
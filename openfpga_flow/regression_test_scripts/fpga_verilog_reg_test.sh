@@ -157,3 +157,6 @@ run-task fpga_verilog/verilog_netlist_formats/embed_bitstream_modelsim $@
 echo -e "Testing the netlist generation by forcing the use of relative paths";
 run-task fpga_verilog/verilog_netlist_formats/use_relative_path $@
 run-task fpga_verilog/verilog_netlist_formats/preconfig_testbench_use_relative_path $@
+
+echo -e "Testing the generation of compressed netlists";
+run-task fpga_verilog/verilog_netlist_formats/compressed_netlist $@
@@ -17,4 +17,9 @@ run-task benchmark_sweep/mac_units $@
 run-task benchmark_sweep/mcnc_big20 $@
 #python3 openfpga_flow/scripts/run_modelsim.py mcnc_big20 --run_sim
 
+# Measure the runtime of repacking large fracturable-LUT clusters
+run-task benchmark_sweep/repack_frac_lut $@
+run-task benchmark_sweep/repack_frac_lut_astar $@
+run-task benchmark_sweep/repack_frac_lut_lb_rr_graph_cache $@
+
 run-task benchmark_sweep/signal_gen $@
@@ -0,0 +1,163 @@
+#####################################################################
+# Python script to check that a variant of an OpenFPGA flow produces
+# the same outputs as the flow itself, e.g., a multi-thread run against
+# a single-thread run.
+# This script is called by ext_exec at the end of an OpenFPGA script and
+#   - Copies the OpenFPGA script (<top>_run.openfpga) and its input files
+#     to a sub-directory, dropping all the ext_exec commands
+#   - Applies the requested text replacements to the copied script
+#   - Runs the copied script with OpenFPGA
+#   - Checks the log of the rerun with the requested patterns
+#   - Compares the requested output files/directories of both runs
+#####################################################################
+
+import os
+import shutil
+import re
+import glob
+import filecmp
+import argparse
+import logging
+
+#####################################################################
+# Initialize logger
+#####################################################################
+logging.basicConfig(format="%(levelname)s: %(message)s", level=logging.DEBUG)
+
+#####################################################################
+# Parse the options
+#####################################################################
+parser = argparse.ArgumentParser(
+    description="Rerun a variant of an OpenFPGA flow and compare the outputs"
+)
+parser.add_argument(
+    "--openfpga_path",
+    required=True,
+    help="Specify the root directory of OpenFPGA, where the executable is built",
+)
+parser.add_argument(
+    "--rerun_dir",
+    default="rerun",
+    help="Specify the sub-directory where the variant is run",
+)
+parser.add_argument(
+    "--replace",
+    nargs=2,
+    action="append",
+    default=[],
+    metavar=("OLD", "NEW"),
+    help="Replace a text in the OpenFPGA script. '\\n' in the new text starts a new line",
+)
+parser.add_argument(
+    "--compare",
+    action="append",
+    default=[],
+    help="Specify an output file or directory which should be the same in both runs",
+)
+parser.add_argument(
+    "--expect_log",
+    action="append",
+    default=[],
+    help="Specify a regular expression which should be found in the log of the rerun",
+)
+parser.add_argument(
+    "--reject_log",
+    action="append",
+    default=[],
+    help="Specify a regular expression which should not be found in the log of the rerun",
+)
+args = parser.parse_args()
+
+openfpga_exe = os.path.abspath(os.path.join(args.openfpga_path, "build/openfpga/openfpga"))
+if not os.path.isfile(openfpga_exe):
+    logging.error("Cannot find OpenFPGA executable: " + openfpga_exe)
+    exit(1)
+
+run_scripts = glob.glob("*_run.openfpga")
+if 1 != len(run_scripts):
+    logging.error("Expect 1 OpenFPGA script but found " + str(len(run_scripts)))
+    exit(1)
+run_script = run_scripts[0]
+
+#####################################################################
+# Prepare the variant in the sub-directory
+# The input files (netlists, activity files etc.) are referred by
+# relative paths, so all the files are copied
+#####################################################################
+shutil.rmtree(args.rerun_dir, ignore_errors=True)
+os.mkdir(args.rerun_dir)
+for fname in os.listdir("."):
+    if os.path.isfile(fname) and fname != run_script:
+        shutil.copyfile(fname, os.path.join(args.rerun_dir, fname))
+
+script = ""
+with open(run_script, "r") as original_script:
+    for line in original_script:
+        if line.startswith("ext_exec"):
+            continue
+        script += line
+for old, new in args.replace:
+    if old not in script:
+        logging.error("Cannot find '" + old + "' in " + run_script)
+        exit(1)
+    script = script.replace(old, new.replace("\\n", "\n"))
+with open(os.path.join(args.rerun_dir, run_script), "w") as rerun_script:
+    rerun_script.write(script)
+
+#####################################################################
+# Run the variant
+#####################################################################
+cmd = "cd " + args.rerun_dir + " && " + openfpga_exe + " -batch -f " + run_script + " > rerun.log"
+if 0 != os.system(cmd):
+    logging.error("Failed to rerun OpenFPGA. See " + os.path.join(args.rerun_dir, "rerun.log"))
+    exit(1)
+
+#####################################################################
+# Check the log of the variant
+#####################################################################
+check_error_count = 0
+with open(os.path.join(args.rerun_dir, "rerun.log"), "r") as rerun_log:
+    log = rerun_log.read()
+for pattern in args.expect_log:
+    if not re.search(pattern, log, re.MULTILINE):
+        logging.error("Cannot find '" + pattern + "' in the log of the rerun")
+        check_error_count += 1
+for pattern in args.reject_log:
+    if re.search(pattern, log, re.MULTILINE):
+        logging.error("Unexpected '" + pattern + "' in the log of the rerun")
+        check_error_count += 1
+
+
+#####################################################################
+# Compare the outputs of both runs
+#####################################################################
+def compare_dirs(dir_a, dir_b):
+    num_diffs = 0
+    comparison = filecmp.dircmp(dir_a, dir_b)
+    for fname in comparison.left_only + comparison.right_only:
+        logging.error("File '" + fname + "' exists only in one of " + dir_a + " and " + dir_b)
+        num_diffs += 1
+    match, mismatch, errors = filecmp.cmpfiles(dir_a, dir_b, comparison.common_files, shallow=False)
+    for fname in mismatch + errors:
+        logging.error("File '" + os.path.join(dir_a, fname) + "' differs in the rerun")
+        num_diffs += 1
+    for subdir in comparison.common_dirs:
+        num_diffs += compare_dirs(os.path.join(dir_a, subdir), os.path.join(dir_b, subdir))
+    return num_diffs
+
+
+for path in args.compare:
+    rerun_path = os.path.join(args.rerun_dir, path)
+    if os.path.isdir(path) and os.path.isdir(rerun_path):
+        check_error_count += compare_dirs(path, rerun_path)
+    elif os.path.isfile(path) and os.path.isfile(rerun_path):
+        if not filecmp.cmp(path, rerun_path, shallow=False):
+            logging.error("File '" + path + "' differs in the rerun")
+            check_error_count += 1
+    else:
+        logging.error("Cannot find '" + path + "' in both runs")
+        check_error_count += 1
+
+logging.info("See " + str(check_error_count) + " failures when comparing with the rerun")
+if 0 < check_error_count:
+    exit(1)
@@ -0,0 +1,28 @@
+import sys
+import xml.etree.ElementTree as ET
+
+# Write a variant of an OpenFPGA architecture where a few circuit models are changed
+#   Usage: test.py <input architecture file> <output architecture file>
+# - The routing multiplexers change from a 2-level structure to a tree-like
+#   structure, which changes the ports of the multiplexer and memory modules
+#   instanciated by the routing modules
+# - The intermediate buffers of the LUTs change, which only changes the
+#   multiplexer modules inside the LUT modules. The logical tile modules only
+#   instanciate the LUT modules, so they depend on the change indirectly
+assert len(sys.argv) == 3
+
+tree = ET.parse(sys.argv[1])
+circuit_models = {}
+for circuit_model in tree.getroot().iter("circuit_model"):
+    circuit_models[circuit_model.attrib["name"]] = circuit_model
+
+mux_tech = circuit_models["mux_2level_tapbuf"].find("design_technology")
+assert mux_tech.attrib["structure"] == "multi_level"
+mux_tech.attrib["structure"] = "tree"
+del mux_tech.attrib["num_level"]
+
+lut_buffer = circuit_models["frac_lut6"].find("lut_intermediate_buffer")
+assert lut_buffer.attrib["circuit_model_name"] == "buf4"
+lut_buffer.attrib["circuit_model_name"] = "tap_buf4"
+
+tree.write(sys.argv[2])
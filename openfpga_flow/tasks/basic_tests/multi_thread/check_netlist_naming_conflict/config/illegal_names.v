@@ -0,0 +1,17 @@
+/////////////////////////////////////////
+//  Functionality: XOR of a rotated bus and the AND of two buses
+////////////////////////////////////////
+`timescale 1ns / 1ps
+
+module illegal_names(
+  a,
+  b,
+  c);
+
+input wire [7:0] a;
+input wire [7:0] b;
+output wire [7:0] c;
+
+assign c = (a & b) ^ {a[0], a[7:1]};
+
+endmodule
@@ -0,0 +1,58 @@
+import xml.etree.ElementTree as ET
+import sys
+
+# Validate the statistics of a fabric reported by report_fabric_statistics
+#   Usage: test.py <fabric_statistics.yaml> <fabric_bitstream.xml>
+# The statistics of the top module should be consistent with those of the
+# unique modules and with the fabric bitstream of a configuration chain
+assert len(sys.argv) == 3
+
+
+def read_statistics(file):
+
+    # Each module is {key : value}, where the first module is the top module
+    modules = []
+    for line in open(file):
+        line = line.rstrip("\n")
+        if line.startswith("- module: "):
+            modules.append({"module": line[len("- module: ") :]})
+        elif line.startswith("  ") and ": " in line:
+            assert len(modules), "Statistics is found before any module"
+            key, value = line.strip().split(": ")
+            modules[-1][key] = int(value)
+    return modules
+
+
+modules = read_statistics(sys.argv[1])
+assert len(modules), "No module is found in '%s'" % sys.argv[1]
+top = modules[0]
+assert top["instances"] == 1, "Top module '%s' is instantiated" % top["module"]
+assert len(set(module["module"] for module in modules)) == len(modules), "Module is reported twice"
+
+# Each instance under the top module is an instance of a unique module
+assert top["hierarchy_instances"] == sum(
+    module["instances"] for module in modules[1:]
+), "Number of instances under the top module mismatches the unique modules"
+
+# Each net under the top module belongs to an instance of a unique module
+assert top["hierarchy_nets"] == sum(
+    module["instances"] * module["nets"] for module in modules
+), "Number of nets under the top module mismatches the unique modules"
+
+for module in modules:
+    if module["child_instances"] == 0:
+        assert module["depth"] == 0, "Module '%s' has no child but a depth" % module["module"]
+        assert module["hierarchy_instances"] == 0
+        assert module["hierarchy_nets"] == module["nets"]
+    else:
+        assert module["depth"] > 0
+        assert module["hierarchy_instances"] >= module["child_instances"]
+
+# Each bit of a configuration chain is a configuration bit
+num_bits = len(list(ET.parse(sys.argv[2]).getroot().iter("bit")))
+assert top["config_bits"] == num_bits, "%d configuration bits are reported but %d in bitstream" % (
+    top["config_bits"],
+    num_bits,
+)
+
+exit(0)
@@ -0,0 +1,106 @@
+import xml.etree.ElementTree as ET
+import sys
+
+# Validate a plain text bitstream of a QL memory bank using flatten BL/WL
+# protocols against a bit-by-bit reference writer, which follows the original
+# implementation of the plain text writer.
+#   Usage: test.py <fabric_bitstream.xml> <fabric_bitstream.bit> [options]
+#   Options: --fast_configuration --keep_dont_care_bits --wl_decremental_order
+assert len(sys.argv) >= 3
+for option in sys.argv[3:] :
+  assert option in ["--fast_configuration", "--keep_dont_care_bits", "--wl_decremental_order"], "Unknown option '%s'" % option
+fast_configuration = "--fast_configuration" in sys.argv[3:]
+dont_care_bit = "x" if "--keep_dont_care_bits" in sys.argv[3:] else "0"
+wl_incremental_order = "--wl_decremental_order" not in sys.argv[3:]
+
+def read_memory_bank_xml(file) :
+
+  # Each region is [bl_length, wl_length, {wl : {bl : value}}]
+  regions = []
+  tree = ET.parse(file)
+  root = tree.getroot()
+  assert root.tag == "fabric_bitstream", "Root tag is not 'fabric_bitstream', but '%s'" % root.tag
+  for region in root :
+    assert region.tag == "region", "fabric_bitstream child node tag is not 'region', but '%s'" % region.tag
+    assert int(region.attrib["id"]) == len(regions)
+    lengths = None
+    wls = {}
+    for bit in region :
+      assert bit.tag == "bit", "region child node tag is not 'bit', but '%s'" % bit.tag
+      assert bit.attrib["value"] in ["0", "1"]
+      bl_addr = bit.find("bl").attrib["address"]
+      wl_addr = bit.find("wl").attrib["address"]
+      # Addresses are one-hot
+      assert bl_addr.count("1") == 1 and wl_addr.count("1") == 1
+      if lengths is None :
+        lengths = [len(bl_addr), len(wl_addr)]
+      assert lengths == [len(bl_addr), len(wl_addr)]
+      bls = wls.setdefault(wl_addr.index("1"), {})
+      assert bl_addr.index("1") not in bls, "BL/WL is used by two bits"
+      bls[bl_addr.index("1")] = bit.attrib["value"]
+    if lengths is None :
+      # A region without any bit has no BL/WL in the plain text file
+      # This is only expected for the last regions
+      break
+    regions.append(lengths + [wls])
+  for region in root[len(regions):] :
+    assert len(region) == 0, "Region '%s' follows a region without any bit" % region.attrib["id"]
+  return regions
+
+def write_reference_text(regions, bit_value_to_skip) :
+
+  num_wls = [max(wls.keys()) + 1 if wls else 0 for (bl, wl, wls) in regions]
+  wls_to_skip = []
+  for (bl, wl, wls), num_wl in zip(regions, num_wls) :
+    skipped = set()
+    if fast_configuration :
+      for iwl in range(num_wl) :
+        if all(value == bit_value_to_skip for value in wls.get(iwl, {}).values()) :
+          skipped.add(iwl)
+    wls_to_skip.append(skipped)
+  length = max([num_wl - len(skipped) for num_wl, skipped in zip(num_wls, wls_to_skip)] + [0])
+  lines = ["// Bitstream length: %d" % length]
+  lines.append("// Bitstream width (LSB -> MSB): <bl_address %d bits><wl_address %d bits>" % (sum(r[0] for r in regions), sum(r[1] for r in regions)))
+  step = 1 if wl_incremental_order else -1
+  wl_indexes = [0 if wl_incremental_order else num_wl - 1 for num_wl in num_wls]
+  for iline in range(length) :
+    line = ""
+    for iregion, (bl, wl, wls) in enumerate(regions) :
+      while wl_indexes[iregion] in wls_to_skip[iregion] :
+        wl_indexes[iregion] += step
+      current_wl = wl_indexes[iregion]
+      if 0 <= current_wl < num_wls[iregion] :
+        bls = wls.get(current_wl, {})
+        line += "".join(bls.get(ibl, dont_care_bit) for ibl in range(bl))
+      else :
+        line += dont_care_bit * bl
+    for iregion, (bl, wl, wls) in enumerate(regions) :
+      current_wl = wl_indexes[iregion]
+      if 0 <= current_wl < num_wls[iregion] :
+        line += "".join("1" if iwl == current_wl else "0" for iwl in range(wl))
+        wl_indexes[iregion] += step
+      else :
+        line += dont_care_bit * wl
+    lines.append(line)
+  return lines
+
+def read_text(file) :
+
+  # Skip the file head, which may contain a time stamp
+  lines = [line.rstrip("\n") for line in open(file)]
+  start = [i for i, line in enumerate(lines) if line.startswith("// Bitstream length:")]
+  assert len(start) == 1, "Cannot find bitstream length in '%s'" % file
+  lines = lines[start[0]:]
+  while len(lines) and lines[-1] == "" :
+    lines.pop()
+  return lines
+
+regions = read_memory_bank_xml(sys.argv[1])
+lines = read_text(sys.argv[2])
+# The value to skip depends on the set/reset ports of the fabric, which is
+# decided by the fast configuration, not by the writer
+candidates = ["0", "1"] if fast_configuration else ["0"]
+references = [write_reference_text(regions, value) for value in candidates]
+assert lines in references, "'%s' differs from the reference writer" % sys.argv[2]
+
+exit(0)
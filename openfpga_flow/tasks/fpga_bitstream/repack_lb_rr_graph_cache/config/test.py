@@ -0,0 +1,51 @@
+import sys
+import re
+import shutil
+import os
+import glob
+import filecmp
+
+# Run the flow of this task again in a sub-directory, where the cached
+# routing resource graphs of logical tiles are loaded before the first repack
+#   Usage: test.py <openfpga_path>
+assert len(sys.argv) >= 2
+openfpga_exe = os.path.abspath("%s/build/openfpga/openfpga" % sys.argv[1])
+assert os.path.exists(openfpga_exe)
+
+run_scripts = glob.glob("*_run.openfpga")
+assert len(run_scripts) == 1, "Expect 1 OpenFPGA script but found %d" % len(run_scripts)
+top = run_scripts[0][:-len("_run.openfpga")]
+
+shutil.rmtree("cached", ignore_errors=True)
+os.mkdir("cached")
+original_openfpga = open(run_scripts[0])
+cached_openfpga = open("cached/%s" % run_scripts[0], "w")
+repacked = False
+for line in original_openfpga :
+  if line.find("ext_exec") == 0 or line.find("write_lb_rr_graph") == 0 :
+    continue
+  if line.find("repack") == 0 and not repacked :
+    cached_openfpga.write("read_lb_rr_graph --file ../lb_rr_graph.bin\n")
+    repacked = True
+  cached_openfpga.write(line)
+cached_openfpga.close()
+original_openfpga.close()
+assert repacked, "Cannot find repack in '%s'" % run_scripts[0]
+shutil.copyfile("%s.blif" % top, "cached/%s.blif" % top)
+shutil.copyfile("%s_ace_out.act" % top, "cached/%s_ace_out.act" % top)
+cmd = "cd cached && %s -batch -f %s > cached.log" % (openfpga_exe, run_scripts[0])
+assert os.system(cmd) == 0
+
+# The loaded graphs should be reused rather than built again
+log = open("cached/cached.log").read()
+assert log.find("Reuse the loaded routing resource graph for logical tile") != -1, "Loaded routing resource graphs are not reused"
+assert log.find("Building routing resource graph for logical tile") == -1, "Routing resource graphs are built again"
+counts = re.findall(r"Reused (\d+) loaded and built (\d+) routing resource graphs of logical tiles", log)
+assert len(counts) != 0, "Cannot find the number of reused routing resource graphs"
+for num_reused, num_built in counts :
+  assert int(num_reused) > 0 and int(num_built) == 0, "Reused %s and built %s routing resource graphs" % (num_reused, num_built)
+
+# The repack result should be the same as building the graphs
+assert filecmp.cmp("arch_bitstream.xml", "cached/arch_bitstream.xml", shallow=False), "Repack result is different when using the cached routing resource graphs"
+
+exit(0)
@@ -0,0 +1,50 @@
+import gzip
+import os
+import sys
+
+# Validate the netlists written by write_fabric_verilog --compress
+#   Usage: test.py <uncompressed netlist directory> <compressed netlist directory>
+# Each netlist of the uncompressed directory should be found in the compressed
+# directory, either as <name>.gz which decompresses to the same content, or as
+# <name> with the same content for the netlists which are not compressed,
+# e.g., fabric_netlists.v, which includes the others by their uncompressed names.
+# The compressed directory should not contain any other file.
+assert len(sys.argv) == 3
+plain_dir = sys.argv[1]
+compressed_dir = sys.argv[2]
+
+
+def list_files(root_dir):
+
+    files = set()
+    for dir_path, dir_names, file_names in os.walk(root_dir):
+        for fname in file_names:
+            files.add(os.path.relpath(os.path.join(dir_path, fname), root_dir))
+    return files
+
+
+plain_files = list_files(plain_dir)
+compressed_files = list_files(compressed_dir)
+assert len(plain_files), "No netlist is found in '%s'" % plain_dir
+
+num_gzip_files = 0
+for fname in sorted(plain_files):
+    content = open(os.path.join(plain_dir, fname), "rb").read()
+    if fname + ".gz" in compressed_files:
+        assert fname not in compressed_files, "'%s' is written with and without .gz" % fname
+        with gzip.open(os.path.join(compressed_dir, fname + ".gz"), "rb") as gzip_file:
+            assert gzip_file.read() == content, "'%s.gz' differs after decompression" % fname
+        compressed_files.remove(fname + ".gz")
+        num_gzip_files += 1
+    else:
+        assert fname in compressed_files, "Cannot find '%s' or '%s.gz'" % (fname, fname)
+        with open(os.path.join(compressed_dir, fname), "rb") as plain_file:
+            assert plain_file.read() == content, "'%s' differs" % fname
+        compressed_files.remove(fname)
+
+assert len(compressed_files) == 0, "Unexpected files: %s" % ", ".join(sorted(compressed_files))
+assert num_gzip_files, "No netlist is compressed"
+assert "fabric_netlists.v" in plain_files, "Cannot find 'fabric_netlists.v'"
+assert "fabric_netlists.v.gz" not in list_files(compressed_dir), "'fabric_netlists.v' is compressed"
+
+exit(0)